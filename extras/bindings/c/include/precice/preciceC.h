@@ -74,6 +74,12 @@ PRECICE_API void precicec_initialize();
  */
 PRECICE_API void precicec_advance(double computedTimeStepSize);
 
+/// @copydoc precice::Participant::startAdvance()
+PRECICE_API void precicec_startAdvance(double computedTimeStepSize);
+
+/// @copydoc precice::Participant::finishAdvance()
+PRECICE_API void precicec_finishAdvance();
+
 /**
  * @brief Finalizes the coupling to the coupling supervisor.
  */
@@ -73,6 +73,22 @@ try {
   std::abort();
 }
 
+void precicec_startAdvance(double computedTimeStepSize)
+try {
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  impl->startAdvance(computedTimeStepSize);
+} catch (::precice::Error &e) {
+  std::abort();
+}
+
+void precicec_finishAdvance()
+try {
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  impl->finishAdvance();
+} catch (::precice::Error &e) {
+  std::abort();
+}
+
 void precicec_finalize()
 try {
   PRECICE_CHECK(impl != nullptr, errormsg);
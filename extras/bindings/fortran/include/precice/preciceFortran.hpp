@@ -69,6 +69,27 @@ PRECICE_API void precicef_initialize_();
  */
 PRECICE_API void precicef_advance_(const double *timeStepSize);
 
+/**
+ * Fortran syntax:
+ * precicef_start_advance( DOUBLE PRECISION timeStepSize )
+ *
+ * IN:  timeStepSize
+ * OUT: -
+ *
+ * @copydoc precice::Participant::startAdvance()
+ *
+ */
+PRECICE_API void precicef_start_advance_(const double *timeStepSize);
+
+/**
+ * Fortran syntax:
+ * precicef_finish_advance()
+ *
+ * @copydoc precice::Participant::finishAdvance()
+ *
+ */
+PRECICE_API void precicef_finish_advance_();
+
 /**
  * Fortran syntax:
  * precicef_finalize();
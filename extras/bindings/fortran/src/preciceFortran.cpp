@@ -72,6 +72,23 @@ try {
   std::abort();
 }
 
+void precicef_start_advance_(
+    const double *timeStepSize)
+try {
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  impl->startAdvance(*timeStepSize);
+} catch (::precice::Error &e) {
+  std::abort();
+}
+
+void precicef_finish_advance_()
+try {
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  impl->finishAdvance();
+} catch (::precice::Error &e) {
+  std::abort();
+}
+
 void precicef_finalize_()
 try {
   PRECICE_CHECK(impl != nullptr, errormsg);
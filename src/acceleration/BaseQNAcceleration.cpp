@@ -38,17 +38,21 @@ BaseQNAcceleration::BaseQNAcceleration(
     int                     filter,
     double                  singularityLimit,
     std::vector<int>        dataIDs,
-    impl::PtrPreconditioner preconditioner)
+    impl::PtrPreconditioner preconditioner,
+    bool                    reducedPrecisionStorage)
     : _preconditioner(std::move(preconditioner)),
       _initialRelaxation(initialRelaxation),
       _maxIterationsUsed(maxIterationsUsed),
       _timeWindowsReused(timeWindowsReused),
       _primaryDataIDs(std::move(dataIDs)),
       _forceInitialRelaxation(forceInitialRelaxation),
+      _matrixW(reducedPrecisionStorage),
       _qrV(filter),
       _filter(filter),
       _singularityLimit(singularityLimit),
-      _infostringstream(std::ostringstream::ate)
+      _infostringstream(std::ostringstream::ate),
+      _matrixVBackup(reducedPrecisionStorage),
+      _matrixWBackup(reducedPrecisionStorage)
 {
   PRECICE_CHECK((_initialRelaxation > 0.0) && (_initialRelaxation <= 1.0),
                 "Initial relaxation factor for QN acceleration has to "
@@ -252,7 +256,7 @@ void BaseQNAcceleration::updateDifferenceMatrices(
       if (not columnLimitReached && overdetermined) {
 
         utils::appendFront(_matrixV, deltaR);
-        utils::appendFront(_matrixW, deltaXTilde);
+        _matrixW.appendFront(deltaXTilde);
 
         // insert column deltaR = _primaryResiduals - _oldPrimaryResiduals at pos. 0 (front) into the
         // QR decomposition and update decomposition
@@ -264,7 +268,7 @@ void BaseQNAcceleration::updateDifferenceMatrices(
         _matrixCols.front()++;
       } else {
         utils::shiftSetFirst(_matrixV, deltaR);
-        utils::shiftSetFirst(_matrixW, deltaXTilde);
+        _matrixW.shiftSetFirst(deltaXTilde);
 
         // inserts column deltaR at pos. 0 to the QR decomposition and deletes the last column
         // the QR decomposition of V is updated
@@ -337,7 +341,7 @@ void BaseQNAcceleration::performAcceleration(
       PRECICE_DEBUG("   Last time window converged after one iteration. Need to restore the matrices from backup.");
 
       _matrixCols = _matrixColsBackup;
-      _matrixV    = _matrixVBackup;
+      _matrixV    = _matrixVBackup.toDouble();
       _matrixW    = _matrixWBackup;
 
       // re-computation of QR decomposition from _matrixV = _matrixVBackup
@@ -400,7 +404,7 @@ void BaseQNAcceleration::performAcceleration(
       // after the first iteration (no new data, i.e., V = W = 0)
       if (getLSSystemCols() > 0) {
         _matrixColsBackup = _matrixCols;
-        _matrixVBackup    = _matrixV;
+        _matrixVBackup.assign(_matrixV);
         _matrixWBackup    = _matrixW;
       }
       // if no time windows reused, the matrix data needs to be cleared as it was only needed for the
@@ -408,7 +412,7 @@ void BaseQNAcceleration::performAcceleration(
       // time window instead of doing a underrelaxation)
       if (not _firstTimeWindow) {
         _matrixV.resize(0, 0);
-        _matrixW.resize(0, 0);
+        _matrixW.clear();
         _matrixCols.clear();
         _matrixCols.push_front(0); // vital after clear()
         _qrV.reset();
@@ -530,7 +534,7 @@ void BaseQNAcceleration::iterationsConverged(
   if (_timeWindowsReused == 0) {
     if (_forceInitialRelaxation) {
       _matrixV.resize(0, 0);
-      _matrixW.resize(0, 0);
+      _matrixW.clear();
       _qrV.reset();
       // set the number of global rows in the QRFactorization.
       _qrV.setGlobalRows(getPrimaryLSSystemRows());
@@ -553,7 +557,7 @@ void BaseQNAcceleration::iterationsConverged(
     // remove columns
     for (int i = 0; i < toRemove; i++) {
       utils::removeColumnFromMatrix(_matrixV, _matrixV.cols() - 1);
-      utils::removeColumnFromMatrix(_matrixW, _matrixW.cols() - 1);
+      _matrixW.removeColumn(_matrixW.cols() - 1);
       // also remove the corresponding columns from the dynamic QR-descomposition of _matrixV
       _qrV.popBack();
     }
@@ -579,7 +583,7 @@ void BaseQNAcceleration::removeMatrixColumn(
 
   PRECICE_ASSERT(_matrixV.cols() > 1);
   utils::removeColumnFromMatrix(_matrixV, columnIndex);
-  utils::removeColumnFromMatrix(_matrixW, columnIndex);
+  _matrixW.removeColumn(columnIndex);
 
   // Reduce column count
   std::deque<int>::iterator iter = _matrixCols.begin();
@@ -9,6 +9,7 @@
 #include <string>
 #include <vector>
 #include "acceleration/Acceleration.hpp"
+#include "acceleration/impl/HistoryMatrix.hpp"
 #include "acceleration/impl/QRFactorization.hpp"
 #include "acceleration/impl/SharedPointer.hpp"
 #include "logging/Logger.hpp"
@@ -70,7 +71,8 @@ public:
       int                     filter,
       double                  singularityLimit,
       std::vector<int>        dataIDs,
-      impl::PtrPreconditioner preconditioner);
+      impl::PtrPreconditioner preconditioner,
+      bool                    reducedPrecisionStorage = false);
 
   /**
    * @brief Destructor, empty.
@@ -200,8 +202,11 @@ protected:
   /// @brief Stores residual deltas.
   Eigen::MatrixXd _matrixV;
 
-  /// @brief Stores x tilde deltas, where x tilde are values computed by solvers.
-  Eigen::MatrixXd _matrixW;
+  /** @brief Stores x tilde deltas, where x tilde are values computed by solvers.
+   *
+   * W is only read when computing the quasi-Newton update, hence it may be stored in reduced precision.
+   */
+  impl::HistoryMatrix _matrixW;
 
   /// @brief Stores the current QR decomposition ov _matrixV, can be updated via deletion/insertion of columns
   impl::QRFactorization _qrV;
@@ -296,8 +301,8 @@ private:
    *  initial relaxation, if previous time window converged within one iteration i.e., V and W
    *  are empty -- in this case restore V and W with time window t-2.
    */
-  Eigen::MatrixXd _matrixVBackup;
-  Eigen::MatrixXd _matrixWBackup;
+  impl::HistoryMatrix _matrixVBackup;
+  impl::HistoryMatrix _matrixWBackup;
   std::deque<int> _matrixColsBackup;
 
   /// Number of filtered out columns in this time window
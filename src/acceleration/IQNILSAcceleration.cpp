@@ -32,9 +32,10 @@ IQNILSAcceleration::IQNILSAcceleration(
     int                     filter,
     double                  singularityLimit,
     std::vector<int>        dataIDs,
-    impl::PtrPreconditioner preconditioner)
+    impl::PtrPreconditioner preconditioner,
+    bool                    reducedPrecisionStorage)
     : BaseQNAcceleration(initialRelaxation, forceInitialRelaxation, maxIterationsUsed, pastTimeWindowsReused,
-                         filter, singularityLimit, std::move(dataIDs), std::move(preconditioner))
+                         filter, singularityLimit, std::move(dataIDs), std::move(preconditioner), reducedPrecisionStorage)
 {
 }
 
@@ -117,7 +118,7 @@ void IQNILSAcceleration::computeQNUpdate(Eigen::VectorXd &xUpdate)
 
   PRECICE_DEBUG("   Apply Newton factors");
   // compute x updates from W and coefficients c, i.e, xUpdate = c*W
-  xUpdate = _matrixW * c;
+  xUpdate = _matrixW.multiply(c);
 }
 
 void IQNILSAcceleration::specializedIterationsConverged(
@@ -6,6 +6,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 
 #include "acceleration/IQNIMVJAcceleration.hpp"
@@ -41,9 +42,11 @@ IQNIMVJAcceleration::IQNIMVJAcceleration(
     int                            imvjRestartType,
     int                            chunkSize,
     int                            RSLSreusedTimeWindows,
-    double                         RSSVDtruncationEps)
+    double                         RSSVDtruncationEps,
+    bool                           reducedPrecisionStorage,
+    int                            numThreads)
     : BaseQNAcceleration(initialRelaxation, forceInitialRelaxation, maxIterationsUsed, pastTimeWindowsReused,
-                         filter, singularityLimit, std::move(dataIDs), preconditioner),
+                         filter, singularityLimit, std::move(dataIDs), preconditioner, reducedPrecisionStorage),
       //  _secondaryOldXTildes(),
       _invJacobian(),
       _oldInvJacobian(),
@@ -60,6 +63,7 @@ IQNIMVJAcceleration::IQNIMVJAcceleration(
       _imvjRestart(false),
       _chunkSize(chunkSize),
       _RSLSreusedTimeWindows(RSLSreusedTimeWindows),
+      _numThreads(numThreads == 0 ? static_cast<int>(std::max(std::thread::hardware_concurrency(), 1u)) : numThreads),
       _nbRestarts(0),
       _avgRank(0)
 {
@@ -92,7 +96,7 @@ void IQNIMVJAcceleration::initialize(
 
   // initialize parallel matrix-matrix operation module
   _parMatrixOps = std::make_shared<impl::ParallelMatrixOperations>();
-  _parMatrixOps->initialize(not _imvjRestart);
+  _parMatrixOps->initialize(not _imvjRestart, _numThreads);
   _svdJ.initialize(_parMatrixOps, global_n, getLSSystemRows());
 
   if (not _imvjRestart) {
@@ -103,7 +107,7 @@ void IQNIMVJAcceleration::initialize(
 
   // initialize parallel matrix-matrix operation module
   _parMatrixOps = std::make_shared<impl::ParallelMatrixOperations>();
-  _parMatrixOps->initialize(not _imvjRestart);
+  _parMatrixOps->initialize(not _imvjRestart, _numThreads);
   _svdJ.initialize(_parMatrixOps, global_n, getLSSystemRows());
 
   // initialize V, W matrices for the LS restart
@@ -115,7 +119,7 @@ void IQNIMVJAcceleration::initialize(
   _Wtil = Eigen::MatrixXd::Zero(cplDataEntries, 0);
 
   if (utils::IntraComm::isPrimary() || !utils::IntraComm::isParallel()) {
-    _infostringstream << " IMVJ restart mode: " << _imvjRestart << "\n chunk size: " << _chunkSize << "\n trunc eps: " << _svdJ.getThreshold() << "\n R_RS: " << _RSLSreusedTimeWindows << "\n--------\n"
+    _infostringstream << " IMVJ restart mode: " << _imvjRestart << "\n chunk size: " << _chunkSize << "\n trunc eps: " << _svdJ.getThreshold() << "\n R_RS: " << _RSLSreusedTimeWindows << "\n threads: " << _numThreads << "\n--------\n"
                       << '\n';
   }
 }
@@ -295,7 +299,7 @@ void IQNIMVJAcceleration::buildWtil()
 
   // W_til = (W-J_inv_n*V) = (W-V_tilde)
   _Wtil *= -1.;
-  _Wtil = _Wtil + _matrixW;
+  _matrixW.addTo(_Wtil);
 
   _resetLS = false;
   //  e.stop(true);
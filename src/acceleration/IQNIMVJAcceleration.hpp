@@ -54,7 +54,9 @@ public:
       int                            imvjRestartType,
       int                            chunkSize,
       int                            RSLSreusedTimeWindows,
-      double                         RSSVDtruncationEps);
+      double                         RSSVDtruncationEps,
+      bool                           reducedPrecisionStorage = false,
+      int                            numThreads              = 1);
 
   /**
    * @brief Destructor, empty.
@@ -131,6 +133,9 @@ private:
   /// @brief: Number of reused time windows at restart if restart-mode = RS-LS
   int _RSLSreusedTimeWindows;
 
+  /// @brief: Number of threads used for the rank-local dense matrix-matrix products, 0 is resolved to all hardware threads
+  int _numThreads;
+
   /// @brief tracks the number of restarts of IMVJ
   int _nbRestarts;
 
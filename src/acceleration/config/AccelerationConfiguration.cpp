@@ -48,6 +48,8 @@ AccelerationConfiguration::AccelerationConfiguration(
       ATTR_SINGULARITYLIMIT("limit"),
       ATTR_TYPE("type"),
       ATTR_BUILDJACOBIAN("always-build-jacobian"),
+      ATTR_REDUCED_PRECISION("reduced-precision"),
+      ATTR_N_THREADS("n-threads"),
       ATTR_IMVJCHUNKSIZE("chunk-size"),
       ATTR_RSLS_REUSED_TIME_WINDOWS("reused-time-windows-at-restart"),
       ATTR_RSSVD_TRUNCATIONEPS("truncation-threshold"),
@@ -101,6 +103,7 @@ void AccelerationConfiguration::connectTags(xml::XMLTag &parent)
   {
     XMLTag tag(*this, VALUE_IQNILS, occ, TAG);
     tag.setDocumentation("Accelerates coupling data with the interface quasi-Newton inverse least-squares method.");
+    addReducedPrecisionAttribute(tag);
     addTypeSpecificSubtags(tag);
     tags.push_back(tag);
   }
@@ -113,6 +116,12 @@ void AccelerationConfiguration::connectTags(xml::XMLTag &parent)
                                                     " in each coupling iteration, which is inefficient. If set to false (or not set)"
                                                     " the Jacobian is only build in the last iteration and the updates are computed using (relatively) cheap MATVEC products.");
     tag.addAttribute(alwaybuildJacobian);
+    auto attrNThreads = makeXMLAttribute(ATTR_N_THREADS, 1)
+                            .setDocumentation("Number of threads per rank used for the dense matrix-matrix products of the IMVJ, "
+                                              "such as the update of the Jacobian. A value of \"0\" uses all hardware threads. "
+                                              "Products of small matrices are always computed by a single thread.");
+    tag.addAttribute(attrNThreads);
+    addReducedPrecisionAttribute(tag);
 
     addTypeSpecificSubtags(tag);
     tags.push_back(tag);
@@ -137,8 +146,16 @@ void AccelerationConfiguration::xmlTagCallback(
   if (callingTag.getNamespace() == TAG) {
     _config.type = callingTag.getName();
 
-    if (_config.type == VALUE_IQNIMVJ)
+    if (_config.type == VALUE_IQNIMVJ) {
       _config.alwaysBuildJacobian = callingTag.getBooleanAttributeValue(ATTR_BUILDJACOBIAN);
+      _config.imvjNThreads        = callingTag.getIntAttributeValue(ATTR_N_THREADS);
+      PRECICE_CHECK(_config.imvjNThreads >= 0,
+                    "The number of threads of the acceleration IQN-IMVJ cannot be negative, but is {}. "
+                    "Please set the attribute \"{}\" to a positive value or to \"0\" to use all hardware threads.",
+                    _config.imvjNThreads, ATTR_N_THREADS);
+    }
+    if (_config.type == VALUE_IQNILS || _config.type == VALUE_IQNIMVJ)
+      _config.reducedPrecisionStorage = callingTag.getBooleanAttributeValue(ATTR_REDUCED_PRECISION);
   }
   if (callingTag.getName() == TAG_RELAX) {
     _config.relaxationFactor = callingTag.getDoubleAttributeValue(ATTR_VALUE);
@@ -278,7 +295,8 @@ void AccelerationConfiguration::xmlEndTagCallback(
               _config.timeWindowsReused,
               _config.filter, _config.singularityLimit,
               _config.dataIDs,
-              _preconditioner));
+              _preconditioner,
+              _config.reducedPrecisionStorage));
     } else if (callingTag.getName() == VALUE_IQNIMVJ) {
 #ifndef PRECICE_NO_MPI
       _config.relaxationFactor  = (_userDefinitions.definedRelaxationFactor) ? _config.relaxationFactor : _defaultValuesIQNIMVJ.relaxationFactor;
@@ -299,7 +317,9 @@ void AccelerationConfiguration::xmlEndTagCallback(
               _config.imvjRestartType,
               _config.imvjChunkSize,
               _config.imvjRSLS_reusedTimeWindows,
-              _config.imvjRSSVD_truncationEps));
+              _config.imvjRSSVD_truncationEps,
+              _config.reducedPrecisionStorage,
+              _config.imvjNThreads));
 #else
       PRECICE_ERROR("Acceleration IQN-IMVJ only works if preCICE is compiled with MPI");
 #endif
@@ -316,6 +336,14 @@ void AccelerationConfiguration::clear()
   _neededMeshes.clear();
 }
 
+void AccelerationConfiguration::addReducedPrecisionAttribute(xml::XMLTag &tag)
+{
+  auto attrReducedPrecision = xml::makeXMLAttribute(ATTR_REDUCED_PRECISION, false)
+                                  .setDocumentation("If set to true, the matrix W of the quasi-Newton history and the backups of V and W are stored in single precision, "
+                                                    "which halves their memory footprint. The values are widened to double precision for the computation of the update.");
+  tag.addAttribute(attrReducedPrecision);
+}
+
 void AccelerationConfiguration::addCommonIQNSubtags(xml::XMLTag &tag)
 {
   using namespace precice::xml;
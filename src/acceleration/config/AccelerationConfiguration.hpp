@@ -61,6 +61,8 @@ private:
   const std::string ATTR_SINGULARITYLIMIT;
   const std::string ATTR_TYPE;
   const std::string ATTR_BUILDJACOBIAN;
+  const std::string ATTR_REDUCED_PRECISION;
+  const std::string ATTR_N_THREADS;
   const std::string ATTR_IMVJCHUNKSIZE;
   const std::string ATTR_RSLS_REUSED_TIME_WINDOWS;
   const std::string ATTR_RSSVD_TRUNCATIONEPS;
@@ -107,12 +109,14 @@ private:
     int                   filter                     = Acceleration::NOFILTER;
     int                   imvjRestartType            = 0;
     int                   imvjChunkSize              = 0;
+    int                   imvjNThreads               = 1;
     int                   imvjRSLS_reusedTimeWindows = 0;
     int                   precond_nbNonConstTWindows = -1;
     double                singularityLimit           = 0;
     double                imvjRSSVD_truncationEps    = 0;
     bool                  estimateJacobian           = false;
     bool                  alwaysBuildJacobian        = false;
+    bool                  reducedPrecisionStorage    = false;
     std::string           preconditionerType;
 
     std::vector<double> scalingFactorsInOrder() const;
@@ -148,6 +152,7 @@ private:
 
   void addTypeSpecificSubtags(xml::XMLTag &tag);
   void addCommonIQNSubtags(xml::XMLTag &tag);
+  void addReducedPrecisionAttribute(xml::XMLTag &tag);
 };
 } // namespace acceleration
 } // namespace precice
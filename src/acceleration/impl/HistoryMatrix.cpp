@@ -0,0 +1,130 @@
+#include "acceleration/impl/HistoryMatrix.hpp"
+#include "utils/EigenHelperFunctions.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice::acceleration::impl {
+
+HistoryMatrix::HistoryMatrix(bool reducedPrecision)
+    : _reducedPrecision(reducedPrecision)
+{
+}
+
+Eigen::Index HistoryMatrix::rows() const
+{
+  return _reducedPrecision ? _reduced.rows() : _full.rows();
+}
+
+Eigen::Index HistoryMatrix::cols() const
+{
+  return _reducedPrecision ? _reduced.cols() : _full.cols();
+}
+
+void HistoryMatrix::appendFront(const Eigen::VectorXd &v)
+{
+  if (not _reducedPrecision) {
+    Eigen::VectorXd copy = v;
+    utils::appendFront(_full, copy);
+    return;
+  }
+  const auto n = _reduced.rows();
+  const auto m = _reduced.cols();
+  if (n <= 0 && m <= 0) {
+    _reduced = v.cast<float>();
+    return;
+  }
+  PRECICE_ASSERT(v.size() == n, v.size(), n);
+  _reduced.conservativeResize(n, m + 1);
+  for (auto i = _reduced.cols() - 1; i > 0; i--) {
+    _reduced.col(i) = _reduced.col(i - 1);
+  }
+  _reduced.col(0) = v.cast<float>();
+}
+
+void HistoryMatrix::shiftSetFirst(const Eigen::VectorXd &v)
+{
+  if (not _reducedPrecision) {
+    utils::shiftSetFirst(_full, v);
+    return;
+  }
+  PRECICE_ASSERT(v.size() == _reduced.rows(), v.size(), _reduced.rows());
+  for (auto i = _reduced.cols() - 1; i > 0; i--) {
+    _reduced.col(i) = _reduced.col(i - 1);
+  }
+  _reduced.col(0) = v.cast<float>();
+}
+
+void HistoryMatrix::removeColumn(int col)
+{
+  if (not _reducedPrecision) {
+    utils::removeColumnFromMatrix(_full, col);
+    return;
+  }
+  PRECICE_ASSERT(col < _reduced.cols() && col >= 0, col, _reduced.cols());
+  for (int j = col; j < _reduced.cols() - 1; j++) {
+    _reduced.col(j) = _reduced.col(j + 1);
+  }
+  _reduced.conservativeResize(_reduced.rows(), _reduced.cols() - 1);
+}
+
+void HistoryMatrix::clear()
+{
+  _full.resize(0, 0);
+  _reduced.resize(0, 0);
+}
+
+void HistoryMatrix::assign(const Eigen::MatrixXd &A)
+{
+  if (_reducedPrecision) {
+    _reduced = A.cast<float>();
+  } else {
+    _full = A;
+  }
+}
+
+Eigen::VectorXd HistoryMatrix::col(int col) const
+{
+  PRECICE_ASSERT(col < cols() && col >= 0, col, cols());
+  if (_reducedPrecision) {
+    return _reduced.col(col).cast<double>();
+  }
+  return _full.col(col);
+}
+
+Eigen::MatrixXd HistoryMatrix::toDouble() const
+{
+  if (_reducedPrecision) {
+    return _reduced.cast<double>();
+  }
+  return _full;
+}
+
+Eigen::VectorXd HistoryMatrix::multiply(const Eigen::VectorXd &v) const
+{
+  PRECICE_ASSERT(v.size() == cols(), v.size(), cols());
+  if (not _reducedPrecision) {
+    return _full * v;
+  }
+  // Accumulate column by column to avoid widening the whole matrix at once
+  Eigen::VectorXd result = Eigen::VectorXd::Zero(_reduced.rows());
+  for (Eigen::Index j = 0; j < _reduced.cols(); j++) {
+    result.noalias() += v(j) * _reduced.col(j).cast<double>();
+  }
+  return result;
+}
+
+void HistoryMatrix::addTo(Eigen::MatrixXd &target) const
+{
+  PRECICE_ASSERT(target.rows() == rows() && target.cols() == cols(), target.rows(), target.cols(), rows(), cols());
+  if (_reducedPrecision) {
+    target += _reduced.cast<double>();
+  } else {
+    target += _full;
+  }
+}
+
+std::size_t HistoryMatrix::bytes() const
+{
+  return _reducedPrecision ? _reduced.size() * sizeof(float) : _full.size() * sizeof(double);
+}
+
+} // namespace precice::acceleration::impl
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <cstddef>
+
+namespace precice {
+namespace acceleration {
+namespace impl {
+
+/**
+ * @brief Column-wise storage of the quasi-Newton history matrices.
+ *
+ * The columns are either kept in double precision or, if reduced precision is requested,
+ * in single precision to halve the memory footprint of long histories on large interfaces.
+ * All operations accept and return double-precision objects, such that the values are only
+ * widened when they are read, e.g., when computing the quasi-Newton update.
+ */
+class HistoryMatrix {
+public:
+  explicit HistoryMatrix(bool reducedPrecision = false);
+
+  /// True if the columns are stored in single precision.
+  bool isReducedPrecision() const
+  {
+    return _reducedPrecision;
+  }
+
+  Eigen::Index rows() const;
+
+  Eigen::Index cols() const;
+
+  /// Inserts the vector as new first column.
+  void appendFront(const Eigen::VectorXd &v);
+
+  /// Shifts all columns by one, dropping the last one, and sets the vector as first column.
+  void shiftSetFirst(const Eigen::VectorXd &v);
+
+  /// Removes the column at the given index.
+  void removeColumn(int col);
+
+  /// Removes all columns.
+  void clear();
+
+  /// Replaces the content by the given matrix.
+  void assign(const Eigen::MatrixXd &A);
+
+  /// Returns a copy of the column in double precision.
+  Eigen::VectorXd col(int col) const;
+
+  /// Returns the matrix in double precision.
+  Eigen::MatrixXd toDouble() const;
+
+  /// Computes the matrix-vector product in double precision.
+  Eigen::VectorXd multiply(const Eigen::VectorXd &v) const;
+
+  /// Adds the matrix to the target in double precision.
+  void addTo(Eigen::MatrixXd &target) const;
+
+  /// Number of bytes used to store the matrix entries.
+  std::size_t bytes() const;
+
+private:
+  bool _reducedPrecision;
+
+  /// Storage used if reduced precision is disabled
+  Eigen::MatrixXd _full;
+
+  /// Storage used if reduced precision is enabled
+  Eigen::MatrixXf _reduced;
+};
+
+} // namespace impl
+} // namespace acceleration
+} // namespace precice
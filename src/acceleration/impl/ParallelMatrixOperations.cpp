@@ -6,9 +6,11 @@
 
 namespace precice::acceleration::impl {
 
-void ParallelMatrixOperations::initialize(const bool needCyclicComm)
+void ParallelMatrixOperations::initialize(const bool needCyclicComm, unsigned int nThreads)
 {
-  PRECICE_TRACE();
+  PRECICE_TRACE(needCyclicComm, nThreads);
+  PRECICE_ASSERT(nThreads > 0);
+  _nThreads = nThreads;
 
   if (needCyclicComm && utils::IntraComm::isParallel()) {
     _needCyclicComm = true;
@@ -16,6 +16,7 @@
 #include "logging/Logger.hpp"
 #include "precice/impl/Types.hpp"
 #include "utils/IntraComm.hpp"
+#include "utils/ParallelFor.hpp"
 #include "utils/assertion.hpp"
 
 namespace precice {
@@ -26,8 +27,46 @@ class ParallelMatrixOperations {
 public:
   ~ParallelMatrixOperations();
 
-  /// Initializes the acceleration.
-  void initialize(const bool needCyclicComm);
+  /** Initializes the acceleration.
+   *
+   * @param[in] needCyclicComm establish the circular communication between ranks
+   * @param[in] nThreads number of threads used for the rank-local matrix products
+   */
+  void initialize(const bool needCyclicComm, unsigned int nThreads = 1);
+
+  /// Number of threads used for the rank-local matrix products
+  unsigned int getNumberOfThreads() const
+  {
+    return _nThreads;
+  }
+
+  /** @brief Computes the rank-local dense product result = leftMatrix * rightMatrix.
+   *
+   * The rows of the result are split into contiguous blocks, which are computed concurrently
+   * by up to getNumberOfThreads() threads. Each block is a cache-blocked Eigen product on its own.
+   * Small products are computed by the calling thread only. The result is resized if required.
+   */
+  template <typename Derived1, typename Derived2, typename Derived3>
+  void localMultiply(
+      const Eigen::MatrixBase<Derived1> &leftMatrix,
+      const Eigen::MatrixBase<Derived2> &rightMatrix,
+      Eigen::MatrixBase<Derived3> &      result) const
+  {
+    PRECICE_ASSERT(leftMatrix.cols() == rightMatrix.rows(), leftMatrix.cols(), rightMatrix.rows());
+    // same semantics as an assignment, which resizes plain matrices
+    result.derived().resize(leftMatrix.rows(), rightMatrix.cols());
+
+    const double flops = static_cast<double>(leftMatrix.rows()) * leftMatrix.cols() * rightMatrix.cols();
+    if (_nThreads <= 1 || flops < MIN_FLOPS_PER_THREAD * 2) {
+      result.noalias() = leftMatrix * rightMatrix;
+      return;
+    }
+    const auto nThreads = static_cast<unsigned int>(std::min<double>(_nThreads, flops / MIN_FLOPS_PER_THREAD));
+    utils::parallelForChunks(leftMatrix.rows(), nThreads, [&](std::size_t begin, std::size_t end) {
+      const Eigen::Index rows = end - begin;
+      result.middleRows(begin, rows).noalias() = leftMatrix.middleRows(begin, rows) * rightMatrix;
+    });
+  }
 
   template <typename Derived1, typename Derived2>
   void multiply(
@@ -45,7 +84,7 @@ public:
 
     // if serial computation on single processor
     if (!utils::IntraComm::isParallel()) {
-      result.noalias() = leftMatrix * rightMatrix;
+      localMultiply(leftMatrix, rightMatrix, result);
 
       // if parallel computation on p processors
     } else {
@@ -100,7 +139,7 @@ public:
     PRECICE_ASSERT(result.cols() == r, result.cols(), r);
 
     Eigen::MatrixXd localResult(result.rows(), result.cols());
-    localResult.noalias() = leftMatrix * rightMatrix;
+    localMultiply(leftMatrix, rightMatrix, localResult);
 
     // if serial computation on single processor
     if (!utils::IntraComm::isParallel()) {
@@ -113,6 +152,12 @@ public:
 private:
   logging::Logger _log{"acceleration::ParallelMatrixOperations"};
 
+  /// Minimal amount of multiply-add operations per thread, below which spawning threads does not pay off
+  static constexpr double MIN_FLOPS_PER_THREAD = 1e6;
+
+  /// Number of threads used for the rank-local matrix products
+  unsigned int _nThreads = 1;
+
   // @brief multiplies matrices based on a cyclic communication and block-wise matrix multiplication
   template <typename Derived1, typename Derived2>
   void _multiply_cyclic(
@@ -158,28 +203,33 @@ private:
     // compute diagonal blocks where all data is local and no communication is needed
     // compute block matrices of J_inv of size (n_til x n_til), n_til = local n
     Eigen::MatrixXd diagBlock(leftMatrix.rows(), leftMatrix.rows());
-    diagBlock.noalias() = leftMatrix * rightMatrix;
+    localMultiply(leftMatrix, rightMatrix, diagBlock);
 
     // set block at corresponding row-index on proc
     int off = offsets[utils::IntraComm::getRank()];
     PRECICE_ASSERT(result.cols() == diagBlock.cols(), result.cols(), diagBlock.cols());
     result.block(off, 0, diagBlock.rows(), diagBlock.cols()) = diagBlock;
 
+    // block of the left matrix, which is currently handed over to the next proc
+    Eigen::MatrixXd leftMatrix_copy;
+
     /**
 		 * cyclic send-receive operation
 		 */
     for (int cycle = 1; cycle < utils::IntraComm::getSize(); cycle++) {
 
       // wait until W_til from previous processor is fully received
+      // and the block from the previous cycle is handed over, such that its buffer can be reused
       if (requestSend != NULL)
         requestSend->wait();
       if (requestRcv != NULL)
         requestRcv->wait();
 
       // leftMatrix (leftMatrix_rcv) is available - needed for local multiplication and hand over to next proc
-      Eigen::MatrixXd leftMatrix_copy(leftMatrix_rcv);
+      leftMatrix_copy = leftMatrix_rcv;
 
       // initiate async send to hand over leftMatrix (W_til) to the next proc (this data will be needed in the next cycle)    dim: n_local x cols
+      requestSend = nullptr;
       if (cycle < utils::IntraComm::getSize() - 1) {
         if (leftMatrix_copy.size() > 0)
           requestSend = _cyclicCommRight->aSend(leftMatrix_copy, 0);
@@ -195,16 +245,16 @@ private:
       leftMatrix_rcv         = Eigen::MatrixXd::Zero(rows_rcv_nextCycle, q);
 
       // initiate asynchronous receive operation for leftMatrix (W_til) from previous processor --> W_til (this data is needed in the next cycle)
+      requestRcv = nullptr;
       if (cycle < utils::IntraComm::getSize() - 1) {
         if (leftMatrix_rcv.size() > 0) // only receive data, if data has been sent
           requestRcv = _cyclicCommLeft->aReceive(leftMatrix_rcv, 0);
       }
 
-      if (requestSend != NULL)
-        requestSend->wait();
-      // compute block with new local data
+      // compute block with new local data while the hand over to the next proc is in flight
+      // leftMatrix_copy is only read here, the send request is completed at the beginning of the next cycle
       Eigen::MatrixXd block(rows_rcv, rightMatrix.cols());
-      block.noalias() = leftMatrix_copy * rightMatrix;
+      localMultiply(leftMatrix_copy, rightMatrix, block);
 
       // set block at corresponding index in J_inv
       // the row-offset of the current block is determined by the proc that sends the part of the W_til matrix
@@ -214,6 +264,9 @@ private:
       PRECICE_ASSERT(result.cols() == block.cols(), result.cols(), block.cols());
       result.block(off, 0, block.rows(), block.cols()) = block;
     }
+
+    if (requestSend != NULL)
+      requestSend->wait();
   }
 
   // @brief multiplies matrices based on a dot-product computation with a rectangular result matrix
@@ -271,7 +324,7 @@ private:
     // multiply local block (saxpy-based approach)
     // dimension: (n_global x n_local) * (n_local x m) = (n_global x m)
     Eigen::MatrixXd block = Eigen::MatrixXd::Zero(p, r);
-    block.noalias()       = leftMatrix * rightMatrix;
+    localMultiply(leftMatrix, rightMatrix, block);
 
     // all blocks have size (n_global x m)
     // Note: if procs have no vertices, the block size remains (n_global x m), however,
@@ -1,5 +1,6 @@
 #include <Eigen/Core>
 #include <algorithm>
+#include <cmath>
 #include "acceleration/Acceleration.hpp"
 #include "acceleration/AitkenAcceleration.hpp"
 #include "acceleration/BaseQNAcceleration.hpp"
@@ -234,6 +235,71 @@ BOOST_AUTO_TEST_CASE(testVIQNPPWithoutSubsteps)
   testVIQNPP(false);
 }
 
+/// Solves a linear fixed-point problem with IQN-ILS and returns the amount of iterations required for convergence.
+int solveFixedPointIQNILS(bool reducedPrecisionStorage, Eigen::VectorXd &solution)
+{
+  using DataMap = AccelerationSerialTestsFixture::DataMap;
+  // Operator with a few distinct eigenvalues: A = -0.8 I + sum_k u_k u_k^T
+  const int       n = 20;
+  Eigen::MatrixXd A = -0.8 * Eigen::MatrixXd::Identity(n, n);
+  for (int k = 1; k <= 3; k++) {
+    Eigen::VectorXd u(n);
+    for (int i = 0; i < n; i++) {
+      u(i) = std::cos(k * i) / std::sqrt(n);
+    }
+    A += u * u.transpose();
+  }
+  Eigen::VectorXd b = Eigen::VectorXd::LinSpaced(n, 1.0, 2.0);
+
+  std::vector<int>                      dataIDs{0};
+  std::vector<double>                   factors{1.0};
+  acceleration::impl::PtrPreconditioner prec(new acceleration::impl::ConstantPreconditioner(factors));
+  mesh::PtrMesh                         dummyMesh(new mesh::Mesh("DummyMesh", 3, testing::nextMeshID()));
+
+  IQNILSAcceleration pp(0.1, false, 50, 0, Acceleration::QR1FILTER, 1e-10, dataIDs, prec, reducedPrecisionStorage);
+
+  mesh::PtrData values(new mesh::Data("values", -1, 1));
+  values->values() = Eigen::VectorXd::Zero(n);
+  values->setSampleAtTime(0, values->sample());
+  cplscheme::PtrCouplingData cpldata = makeCouplingData(values, dummyMesh, false);
+  cpldata->storeIteration();
+
+  DataMap data;
+  data.insert(std::make_pair(0, cpldata));
+  pp.initialize(data);
+
+  int iterations = 1;
+  for (; iterations < 100; iterations++) {
+    // The "solver" evaluates the fixed-point operator with the accelerated input
+    Eigen::VectorXd input = cpldata->previousIteration();
+    values->values()      = A * input + b;
+    values->setSampleAtTime(1, values->sample());
+    if ((values->values() - input).norm() <= 1e-8 * values->values().norm()) {
+      break;
+    }
+    pp.performAcceleration(data);
+    values->setSampleAtTime(1, values->sample());
+    cpldata->storeIteration();
+  }
+  solution = values->values();
+  return iterations;
+}
+
+BOOST_AUTO_TEST_CASE(testIQNILSReducedPrecisionStorage)
+{
+  PRECICE_TEST(1_rank);
+  Eigen::VectorXd fullSolution;
+  Eigen::VectorXd reducedSolution;
+  const int       fullIterations    = solveFixedPointIQNILS(false, fullSolution);
+  const int       reducedIterations = solveFixedPointIQNILS(true, reducedSolution);
+  BOOST_TEST_MESSAGE("IQN-ILS iterations with double storage: " << fullIterations << ", with reduced storage: " << reducedIterations);
+
+  BOOST_TEST(fullIterations < 100);
+  BOOST_TEST(reducedIterations < 100);
+  BOOST_TEST(std::abs(fullIterations - reducedIterations) <= 2);
+  BOOST_TEST(testing::equals(fullSolution, reducedSolution, 1e-6));
+}
+
 BOOST_AUTO_TEST_CASE(testConstantUnderrelaxationWithSubsteps)
 {
   PRECICE_TEST(1_rank);
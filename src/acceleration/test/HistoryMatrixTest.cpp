@@ -0,0 +1,86 @@
+#include <Eigen/Core>
+#include "acceleration/impl/HistoryMatrix.hpp"
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+
+BOOST_AUTO_TEST_SUITE(AccelerationTests)
+
+using namespace precice;
+using namespace precice::acceleration::impl;
+
+BOOST_AUTO_TEST_SUITE(HistoryMatrixTests)
+
+void fillHistory(HistoryMatrix &history, int rows, int cols)
+{
+  for (int j = 0; j < cols; j++) {
+    Eigen::VectorXd v(rows);
+    for (int i = 0; i < rows; i++) {
+      v(i) = 1.0 / static_cast<double>(i + j + 1);
+    }
+    history.appendFront(v);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(FullPrecision)
+{
+  PRECICE_TEST(1_rank);
+  HistoryMatrix history;
+  BOOST_TEST(not history.isReducedPrecision());
+  fillHistory(history, 5, 3);
+  BOOST_TEST(history.rows() == 5);
+  BOOST_TEST(history.cols() == 3);
+  BOOST_TEST(history.bytes() == 15 * sizeof(double));
+
+  // The last appended column is the first one
+  BOOST_TEST(history.col(0)(0) == 1.0 / 3.0);
+  BOOST_TEST(history.col(2)(0) == 1.0);
+
+  history.removeColumn(1);
+  BOOST_TEST(history.cols() == 2);
+  BOOST_TEST(history.col(1)(0) == 1.0);
+
+  history.clear();
+  BOOST_TEST(history.cols() == 0);
+  BOOST_TEST(history.bytes() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(ReducedPrecision)
+{
+  PRECICE_TEST(1_rank);
+  HistoryMatrix full(false);
+  HistoryMatrix reduced(true);
+  BOOST_TEST(reduced.isReducedPrecision());
+  fillHistory(full, 8, 4);
+  fillHistory(reduced, 8, 4);
+  BOOST_TEST(reduced.rows() == 8);
+  BOOST_TEST(reduced.cols() == 4);
+  BOOST_TEST(2 * reduced.bytes() == full.bytes());
+
+  Eigen::VectorXd c(4);
+  c << 1.0, -2.0, 3.0, -4.0;
+  Eigen::VectorXd fullProduct    = full.multiply(c);
+  Eigen::VectorXd reducedProduct = reduced.multiply(c);
+  BOOST_TEST(fullProduct.size() == reducedProduct.size());
+  BOOST_TEST(testing::equals(fullProduct, reducedProduct, 1e-6));
+
+  Eigen::VectorXd v = Eigen::VectorXd::Constant(8, 0.5);
+  full.shiftSetFirst(v);
+  reduced.shiftSetFirst(v);
+  BOOST_TEST(reduced.cols() == 4);
+  BOOST_TEST(testing::equals(reduced.col(0), v));
+
+  full.removeColumn(2);
+  reduced.removeColumn(2);
+  BOOST_TEST(testing::equals(full.toDouble(), reduced.toDouble(), 1e-6));
+
+  Eigen::MatrixXd sum = Eigen::MatrixXd::Ones(8, 3);
+  reduced.addTo(sum);
+  BOOST_TEST(testing::equals(sum, (full.toDouble().array() + 1.0).matrix(), 1e-6));
+
+  reduced.assign(Eigen::MatrixXd::Identity(3, 3));
+  BOOST_TEST(reduced.rows() == 3);
+  BOOST_TEST(testing::equals(reduced.toDouble(), Eigen::MatrixXd::Identity(3, 3)));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // HistoryMatrixTests
+BOOST_AUTO_TEST_SUITE_END() // AccelerationTests
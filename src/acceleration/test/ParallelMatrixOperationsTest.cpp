@@ -3,11 +3,13 @@
 
 #include <Eigen/Core>
 #include <algorithm>
+#include <chrono>
 #include <math.h>
 #include <memory>
 #include <ostream>
 #include <stdlib.h>
 #include <string>
+#include <thread>
 #include <vector>
 #include "acceleration/impl/ParallelMatrixOperations.hpp"
 #include "com/Communication.hpp"
@@ -525,6 +527,98 @@ BOOST_AUTO_TEST_CASE(ParallelMatrixMatrixOpWithSecondaryData)
   Eigen::MatrixXd matrix_cast = resJres_local2;
   validate_result_equals_reference(matrix_cast, Jres_global, vertexOffsets.at(context.rank), true);
 }
+
+/// Deterministic dense matrix, which is identical on all ranks
+Eigen::MatrixXd denseTestMatrix(int rows, int cols, double seed)
+{
+  Eigen::MatrixXd matrix(rows, cols);
+  for (int i = 0; i < rows; i++) {
+    for (int j = 0; j < cols; j++) {
+      matrix(i, j) = std::sin(seed + 0.37 * i + 1.13 * j);
+    }
+  }
+  return matrix;
+}
+
+BOOST_AUTO_TEST_CASE(ThreadedParallelMatrixMatrixOp)
+{
+  PRECICE_TEST(""_on(2_ranks).setupIntraComm());
+
+  // the sizes are large enough to exceed the threshold for the threaded local products
+  int              n_global = 400, m_global = 40;
+  std::vector<int> vertexOffsets{0, 250, 400};
+
+  Eigen::MatrixXd W_global  = denseTestMatrix(n_global, m_global, 0.1);
+  Eigen::MatrixXd Z_global  = denseTestMatrix(m_global, n_global, 0.7);
+  Eigen::MatrixXd J_global  = denseTestMatrix(n_global, n_global, 1.3);
+  Eigen::MatrixXd WZ_global = W_global * Z_global;
+  Eigen::MatrixXd JW_global = J_global * W_global;
+
+  int             off     = vertexOffsets.at(context.rank);
+  int             n_local = vertexOffsets.at(context.rank + 1) - off;
+  Eigen::MatrixXd W_local = W_global.middleRows(off, n_local);
+  Eigen::MatrixXd Z_local = Z_global.middleCols(off, n_local);
+  Eigen::MatrixXd J_local = J_global.middleCols(off, n_local);
+
+  ParallelMatrixOperations parMatrixOps{};
+  parMatrixOps.initialize(true, 3);
+  BOOST_TEST(parMatrixOps.getNumberOfThreads() == 3);
+
+  // multiply WZ = W * Z (n x n), parallel: (n_global x n_local), with cyclic multiplication
+  Eigen::MatrixXd resWZ_local(n_global, n_local);
+  parMatrixOps.multiply(W_local, Z_local, resWZ_local, vertexOffsets, n_global, m_global, n_global);
+  BOOST_TEST(testing::equals(resWZ_local, Eigen::MatrixXd(WZ_global.middleCols(off, n_local)), 1e-8));
+
+  // multiply JW = J * W (n x m), parallel: (n_local x m), based on dot product
+  Eigen::MatrixXd resJW_local(n_local, m_global);
+  parMatrixOps.multiply(J_local, W_local, resJW_local, vertexOffsets, n_global, n_global, m_global, false);
+  BOOST_TEST(testing::equals(resJW_local, Eigen::MatrixXd(JW_global.middleRows(off, n_local)), 1e-8));
+
+  // multiply JW = J * W (n x m), parallel: (n_local x m) with block-wise multiplication
+  Eigen::MatrixXd resJW_local2(n_local, m_global);
+  parMatrixOps.multiply(J_local, W_local, resJW_local2, vertexOffsets, n_global, n_global, m_global, false, false);
+  BOOST_TEST(testing::equals(resJW_local2, Eigen::MatrixXd(JW_global.middleRows(off, n_local)), 1e-8));
+}
+
+BOOST_AUTO_TEST_CASE(ThreadedLocalMultiplyBenchmark)
+{
+  PRECICE_TEST(1_rank);
+
+  const int       n     = 300;
+  Eigen::MatrixXd left  = denseTestMatrix(n, n, 0.3);
+  Eigen::MatrixXd right = denseTestMatrix(n, n, 0.9);
+
+  ParallelMatrixOperations serialOps{};
+  serialOps.initialize(false, 1);
+  const unsigned int       nThreads = std::max(2u, std::thread::hardware_concurrency());
+  ParallelMatrixOperations threadedOps{};
+  threadedOps.initialize(false, nThreads);
+
+  Eigen::MatrixXd reference(n, n);
+  Eigen::MatrixXd result(n, n);
+
+  using Clock      = std::chrono::steady_clock;
+  const auto start = Clock::now();
+  serialOps.localMultiply(left, right, reference);
+  const auto middle = Clock::now();
+  threadedOps.localMultiply(left, right, result);
+  const auto end = Clock::now();
+
+  // row blocks are computed independently, hence the results agree up to round-off
+  BOOST_TEST(testing::equals(result, reference, 1e-8));
+
+  const std::chrono::duration<double, std::milli> serialTime   = middle - start;
+  const std::chrono::duration<double, std::milli> threadedTime = end - middle;
+  BOOST_TEST_MESSAGE("Local " << n << "x" << n << " product: 1 thread " << serialTime.count()
+                              << "ms, " << nThreads << " threads " << threadedTime.count() << "ms");
+
+  // vectors and small products fall back to the calling thread
+  Eigen::VectorXd vector = left.col(0);
+  Eigen::VectorXd resultVector(n);
+  threadedOps.localMultiply(left, vector, resultVector);
+  BOOST_TEST(testing::equals(resultVector, Eigen::VectorXd(left * vector), 1e-12));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
 
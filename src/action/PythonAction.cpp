@@ -50,6 +50,18 @@ std::string python_error_as_string()
     }
   }
 }
+
+/// Creates a NumPy array of the given shape, which views the values without copying them
+PyObject *viewAsNumPyArray(int nd, npy_intp *dims, double *values)
+{
+  return PyArray_New(&PyArray_Type, nd, dims, NPY_DOUBLE, nullptr, values, 0, NPY_ARRAY_CARRAY, nullptr);
+}
+
+/// Creates a read-only NumPy array of the given shape, which views the values without copying them
+PyObject *viewAsReadOnlyNumPyArray(int nd, npy_intp *dims, const double *values)
+{
+  return PyArray_New(&PyArray_Type, nd, dims, NPY_DOUBLE, nullptr, const_cast<double *>(values), 0, NPY_ARRAY_CARRAY_RO, nullptr);
+}
 } // namespace
 
 PythonAction::PythonAction(
@@ -95,45 +107,132 @@ void PythonAction::performAction()
     initialize();
   }
 
+  setVertexCoordinates();
+
+  if (_performActionWindow != nullptr) {
+    performActionOnWindow();
+  } else if (_performAction != nullptr) {
+    performActionPerSample();
+  }
+
+  // The samples were modified in place, hence the current sample has to be updated.
+  const auto &storage = _targetData->timeStepsStorage();
+  if (not storage.empty()) {
+    _targetData->sample() = storage.last().sample;
+  }
+}
+
+void PythonAction::performActionPerSample()
+{
   PyObject *dataArgs = PyTuple_New(_numberArguments);
 
   int i = 0;
-  for (auto &targetStample : _targetData->stamples()) { // iterate over _targetData, because it must always exist
-    PRECICE_ASSERT(_targetData);                        // _targetData is mandatory, cannot call setSampleAtTime, if target data is not provided!
+  for (auto &targetStample : _targetData->timeStepsStorage().stamples()) { // iterate over _targetData, because it must always exist
+    PRECICE_ASSERT(_targetData);                                         // _targetData is mandatory, its samples are modified in place
 
     PyObject *pythonTime = PyFloat_FromDouble(targetStample.timestamp);
     PyTuple_SetItem(dataArgs, 0, pythonTime);
 
-    if (_sourceData) {                                     // _sourceData is optional
-      auto &sourceStample   = _sourceData->stamples()[i];  // simultaneously iterate over _targetData->stamples()
-      _sourceData->values() = sourceStample.sample.values; // put data into temporary buffer
+    if (_sourceData) {                                        // _sourceData is optional
+      const auto &sourceStample = _sourceData->stamples()[i]; // simultaneously iterate over _targetData->stamples()
       PRECICE_CHECK(math::equals(sourceStample.timestamp, targetStample.timestamp), "Trying to perform python action on samples with different timestamps: {} for source data and {} for target data. Time mesh of source data and target data must agree.", sourceStample.timestamp, targetStample.timestamp);
       i++;
-      npy_intp sourceDim[]  = {_sourceData->values().size()};
-      double * sourceValues = _sourceData->values().data();
-      _sourceValues         = PyArray_SimpleNewFromData(1, sourceDim, NPY_DOUBLE, sourceValues);
+      npy_intp sourceDim[] = {sourceStample.sample.values.size()};
+      _sourceValues        = viewAsReadOnlyNumPyArray(1, sourceDim, sourceStample.sample.values.data());
       PRECICE_CHECK(_sourceValues != nullptr, "Creating python source values failed. Please check that the source data name is used by the mesh in action:python.");
       PyTuple_SetItem(dataArgs, 1, _sourceValues);
     }
 
-    _targetData->values() = targetStample.sample.values; // put data into temporary buffer
-    npy_intp targetDim[]  = {_targetData->values().size()};
-    double * targetValues = _targetData->values().data();
-    // PRECICE_ASSERT(_targetValues == NULL);
-    _targetValues = PyArray_SimpleNewFromData(1, targetDim, NPY_DOUBLE, targetValues);
+    npy_intp targetDim[] = {targetStample.sample.values.size()};
+    _targetValues        = viewAsNumPyArray(1, targetDim, targetStample.sample.values.data());
     PRECICE_CHECK(_targetValues != nullptr, "Creating python target values failed. Please check that the target data name is used by the mesh in action:python.");
     int argumentIndex = _sourceData ? 2 : 1;
     PyTuple_SetItem(dataArgs, argumentIndex, _targetValues);
 
-    PyObject_CallObject(_performAction, dataArgs);
+    PyObject *result = PyObject_CallObject(_performAction, dataArgs);
+    Py_XDECREF(result);
     PRECICE_CHECK(!PyErr_Occurred(),
                   "Error occurred during call of function performAction() in python module \"{}\". "
                   "The error message is: {}",
                   _moduleName, python_error_as_string());
+  }
+  Py_DECREF(dataArgs);
+}
+
+void PythonAction::performActionOnWindow()
+{
+  PRECICE_ASSERT(_targetData); // _targetData is mandatory
+  auto       targetStamples = _targetData->timeStepsStorage().stamples();
+  const auto nTimes         = static_cast<npy_intp>(targetStamples.size());
+  if (nTimes == 0) {
+    return;
+  }
 
-    _targetData->setSampleAtTime(targetStample.timestamp, _targetData->sample());
+  // The samples are stored separately and need to be gathered once. A column-major matrix
+  // with a column per sample has the memory layout of a C-ordered array with a row per sample.
+  Eigen::VectorXd times(nTimes);
+  Eigen::MatrixXd targetValues(targetStamples.front().sample.values.size(), nTimes);
+  int             i = 0;
+  for (const auto &stample : targetStamples) {
+    times(i)            = stample.timestamp;
+    targetValues.col(i) = stample.sample.values;
+    i++;
   }
+
+  PyObject *dataArgs   = PyTuple_New(_numberArguments);
+  npy_intp  timesDim[] = {nTimes};
+  PyTuple_SetItem(dataArgs, 0, viewAsReadOnlyNumPyArray(1, timesDim, times.data()));
+
+  Eigen::MatrixXd sourceValues;
+  if (_sourceData) {
+    auto sourceStamples = _sourceData->stamples();
+    PRECICE_CHECK(static_cast<npy_intp>(sourceStamples.size()) == nTimes,
+                  "Trying to perform python action on {} samples of source data and {} samples of target data. Time mesh of source data and target data must agree.",
+                  sourceStamples.size(), nTimes);
+    sourceValues.resize(sourceStamples.front().sample.values.size(), nTimes);
+    i = 0;
+    for (const auto &stample : sourceStamples) {
+      PRECICE_CHECK(math::equals(stample.timestamp, times(i)), "Trying to perform python action on samples with different timestamps: {} for source data and {} for target data. Time mesh of source data and target data must agree.", stample.timestamp, times(i));
+      sourceValues.col(i) = stample.sample.values;
+      i++;
+    }
+    npy_intp sourceDim[] = {nTimes, sourceValues.rows()};
+    _sourceValues        = viewAsReadOnlyNumPyArray(2, sourceDim, sourceValues.data());
+    PRECICE_CHECK(_sourceValues != nullptr, "Creating python source values failed. Please check that the source data name is used by the mesh in action:python.");
+    PyTuple_SetItem(dataArgs, 1, _sourceValues);
+  }
+
+  npy_intp targetDim[] = {nTimes, targetValues.rows()};
+  _targetValues        = viewAsNumPyArray(2, targetDim, targetValues.data());
+  PRECICE_CHECK(_targetValues != nullptr, "Creating python target values failed. Please check that the target data name is used by the mesh in action:python.");
+  int argumentIndex = _sourceData ? 2 : 1;
+  PyTuple_SetItem(dataArgs, argumentIndex, _targetValues);
+
+  PyObject *result = PyObject_CallObject(_performActionWindow, dataArgs);
+  Py_XDECREF(result);
+  PRECICE_CHECK(!PyErr_Occurred(),
+                "Error occurred during call of function performActionWindow() in python module \"{}\". "
+                "The error message is: {}",
+                _moduleName, python_error_as_string());
   Py_DECREF(dataArgs);
+
+  i = 0;
+  for (auto &stample : targetStamples) {
+    stample.sample.values = targetValues.col(i);
+    i++;
+  }
+}
+
+void PythonAction::setVertexCoordinates()
+{
+  // The mesh owns the coordinates and keeps them until the mesh changes
+  const Eigen::MatrixXd &coordinates = getMesh()->vertexCoordinates();
+
+  npy_intp  dims[] = {coordinates.cols(), coordinates.rows()};
+  PyObject *view   = viewAsReadOnlyNumPyArray(2, dims, coordinates.data());
+  PRECICE_CHECK(view != nullptr, "Creating python vertex coordinates failed.");
+  PyObject_SetAttrString(_module, "vertexCoordinates", view);
+  Py_DECREF(view);
 }
 
 void PythonAction::initialize()
@@ -151,13 +250,21 @@ void PythonAction::initialize()
   PRECICE_CHECK(_module,
                 "An error occurred while loading python module \"{}\": {}", _moduleName, python_error_as_string());
 
+  // Construct the optional method performActionWindow, which is preferred over performAction
+  _performActionWindow = PyObject_GetAttrString(_module, "performActionWindow");
+  if (PyErr_Occurred()) {
+    PyErr_Clear();
+    _performActionWindow = nullptr;
+  }
+
   // Construct method performAction
   _performAction = PyObject_GetAttrString(_module, "performAction");
   if (PyErr_Occurred()) {
     PyErr_Clear();
-    PRECICE_WARN("Python module \"{}\" does not define function performAction().", _moduleName);
+    PRECICE_WARN_IF(_performActionWindow == nullptr, "Python module \"{}\" does not define function performAction().", _moduleName);
     _performAction = nullptr;
   }
+  _isInitialized = true;
 }
 
 int PythonAction::makeNumPyArraysAvailable()
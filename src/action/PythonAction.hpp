@@ -11,7 +11,15 @@ using PyObject = _object;
 
 namespace precice::action {
 
-/// Action whose implementation is given in a Python file.
+/**
+ * @brief Action whose implementation is given in a Python file.
+ *
+ * The NumPy arrays passed to performAction() view the stored samples of the data without copies.
+ * If the module defines performActionWindow(), it is called once with all samples of the time window
+ * instead of calling performAction() per sample. These samples are gathered into one array per data
+ * and the target values are written back afterwards.
+ * The module attribute vertexCoordinates is a read-only view of the coordinates cached in the mesh, which is updated for every call.
+ */
 class PythonAction : public Action {
 public:
   PythonAction(
@@ -51,8 +59,19 @@ private:
 
   PyObject *_performAction = nullptr;
 
+  PyObject *_performActionWindow = nullptr;
+
   void initialize();
 
+  /// Calls performAction() for every sample of the target data.
+  void performActionPerSample();
+
+  /// Calls performActionWindow() once with the samples of the target data as rows of a 2D array.
+  void performActionOnWindow();
+
+  /// Exposes the coordinates of the mesh vertices to the module.
+  void setVertexCoordinates();
+
   int makeNumPyArraysAvailable();
 };
 
@@ -2,9 +2,24 @@ def performAction(time, sourceData, targetData):
     """This function is called at the configured timing.
     Its parameters are time, the source data, followed by the target data.
     Source and target data can be omitted (selectively or both) by not mentioning
-    them in the preCICE XML configuration (see the configuration reference)."""
+    them in the preCICE XML configuration (see the configuration reference).
+    The arrays view the stored samples: source data is read-only and target data
+    is modified in place."""
 
     # Usage example:
     # for i in range(sourceData.size):
     #     targetData[i] = sourceData[i] + 1 # Add 1 to each data component
     #     i = i + 1
+
+
+# def performActionWindow(times, sourceData, targetData):
+#     """Optional alternative to performAction(), called once per action with all
+#     samples of the time window. times holds the time of each sample, and the
+#     data are 2D arrays with one row of values per sample.
+#     If defined, this function is called instead of performAction()."""
+#
+#     # Usage example:
+#     # targetData[:, :] = sourceData + 1 # Add 1 to each data component of every sample
+#
+# During both calls, the module attribute vertexCoordinates holds the read-only
+# coordinates of the mesh vertices as a 2D array with one row per vertex.
@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <memory>
 #include <string>
+#include <vector>
 #include "action/Action.hpp"
 #include "action/PythonAction.hpp"
 #include "logging/Logger.hpp"
@@ -50,6 +51,76 @@ BOOST_AUTO_TEST_CASE(PerformActionWithGlobalIterationsCounter)
   BOOST_TEST(testing::equals(mesh->data(targetID)->values(), result));
 }
 
+BOOST_AUTO_TEST_CASE(PerformActionOnEverySample)
+{
+  PRECICE_TEST(1_rank);
+  mesh::PtrMesh mesh(new mesh::Mesh("Mesh", 2, testing::nextMeshID()));
+  mesh->createVertex(Eigen::Vector2d(1.0, 2.0));
+  mesh->createVertex(Eigen::Vector2d(3.0, 4.0));
+  mesh->createVertex(Eigen::Vector2d(5.0, 6.0));
+  auto &target = *mesh->createData("TargetData", 1, 0_dataID);
+  mesh->allocateDataValues();
+  std::string  path = testing::getPathToSources() + "/action/tests/";
+  PythonAction action(PythonAction::WRITE_MAPPING_POST, path, "TestActionSamples", mesh, target.getID(), -1);
+
+  for (double time : {0.0, 0.5, 1.0}) {
+    target.setSampleAtTime(time, time::Sample{1, Eigen::VectorXd::Zero(mesh->nVertices())});
+  }
+  std::vector<const double *> buffers;
+  for (const auto &stample : target.stamples()) {
+    buffers.push_back(stample.sample.values.data());
+  }
+
+  action.performAction();
+
+  // Every sample is modified in place, using the coordinates of the vertices
+  BOOST_TEST(target.stamples().size() == 3);
+  int i = 0;
+  for (const auto &stample : target.stamples()) {
+    BOOST_TEST(stample.sample.values.data() == buffers[i++]);
+    Eigen::VectorXd expected(3);
+    expected << 21.0, 43.0, 65.0;
+    expected.array() += stample.timestamp;
+    BOOST_TEST(testing::equals(stample.sample.values, expected));
+  }
+
+  Eigen::VectorXd result(3);
+  result << 22.0, 44.0, 66.0;
+  BOOST_TEST(testing::equals(target.values(), result));
+}
+
+BOOST_AUTO_TEST_CASE(PerformActionOnWindow)
+{
+  PRECICE_TEST(1_rank);
+  mesh::PtrMesh mesh(new mesh::Mesh("Mesh", 3, testing::nextMeshID()));
+  mesh->createVertex(Eigen::Vector3d::Constant(1.0));
+  mesh->createVertex(Eigen::Vector3d::Constant(2.0));
+  mesh->createVertex(Eigen::Vector3d::Constant(3.0));
+  auto &target = *mesh->createData("TargetData", 1, 0_dataID);
+  auto &source = *mesh->createData("SourceData", 1, 1_dataID);
+  mesh->allocateDataValues();
+  std::string  path = testing::getPathToSources() + "/action/tests/";
+  PythonAction action(PythonAction::WRITE_MAPPING_POST, path, "TestActionWindow", mesh, target.getID(), source.getID());
+
+  // Two samples of three values, such that the shapes (times x values) and (values x times) differ
+  Eigen::VectorXd first(3), second(3);
+  first << 1.0, 2.0, 3.0;
+  second << 4.0, 5.0, 6.0;
+  source.setSampleAtTime(0.5, time::Sample{1, first});
+  source.setSampleAtTime(1.0, time::Sample{1, second});
+  target.setSampleAtTime(0.5, time::Sample{1, Eigen::VectorXd::Zero(mesh->nVertices())});
+  target.setSampleAtTime(1.0, time::Sample{1, Eigen::VectorXd::Zero(mesh->nVertices())});
+
+  action.performAction();
+
+  // The rows of the window are written back to the samples
+  const auto stamples = target.stamples();
+  BOOST_TEST_REQUIRE(stamples.size() == 2);
+  BOOST_TEST(testing::equals(stamples[0].sample.values, Eigen::VectorXd(first.array() + 0.5)));
+  BOOST_TEST(testing::equals(stamples[1].sample.values, Eigen::VectorXd(second.array() + 1.0)));
+  BOOST_TEST(testing::equals(target.values(), Eigen::VectorXd(second.array() + 1.0)));
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Python
 BOOST_AUTO_TEST_SUITE_END() // ActionTest
 
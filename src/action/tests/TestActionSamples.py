@@ -0,0 +1,14 @@
+#
+# Overwrites every sample of the target data in place. The values depend on the
+# time of the sample and on the coordinates of the vertices, which are provided
+# by preCICE as the module attribute vertexCoordinates.
+def performAction(time, targetData):
+
+    # Both arrays have to view memory of preCICE instead of owning a copy
+    if targetData.flags.owndata or vertexCoordinates.flags.owndata:
+        raise ValueError("Expected views of the stored sample and coordinates")
+    if not targetData.flags.writeable or vertexCoordinates.flags.writeable:
+        raise ValueError("Expected writeable target data and read-only coordinates")
+
+    for i in range(targetData.size):
+        targetData[i] = time + vertexCoordinates[i, 0] + 10 * vertexCoordinates[i, 1]
@@ -0,0 +1,14 @@
+#
+# This function is called once per time window with all samples. The arrays of
+# the data have one row per sample and one column per value.
+def performActionWindow(times, sourceData, targetData):
+
+    expectedShape = (times.size, vertexCoordinates.shape[0])
+    if sourceData.shape != expectedShape or targetData.shape != expectedShape:
+        raise ValueError("Expected data of shape {}, but got {} and {}".format(
+            expectedShape, sourceData.shape, targetData.shape))
+    if sourceData.flags.writeable or not targetData.flags.writeable:
+        raise ValueError("Expected read-only source data and writeable target data")
+
+    for t in range(times.size):
+        targetData[t, :] = sourceData[t, :] + times[t]
@@ -1,5 +1,7 @@
 #include <algorithm>
+#include <cstddef>
 #include <memory>
+#include <numeric>
 #include <ostream>
 #include <vector>
 
@@ -307,6 +309,83 @@ void Communication::broadcast(std::vector<double> &v, Rank rankBroadcaster)
   broadcast(precice::span<double>{v}, rankBroadcaster);
 }
 
+void Communication::allgather(int itemToSend, std::vector<int> &itemsToReceive)
+{
+  PRECICE_TRACE();
+
+  itemsToReceive.assign(getRemoteCommunicatorSize() + 1, 0);
+  itemsToReceive[0] = itemToSend;
+
+  // receive from all secondary ranks concurrently
+  std::vector<PtrRequest> requests(getRemoteCommunicatorSize());
+  for (Rank rank : remoteCommunicatorRanks()) {
+    requests[rank] = aReceive(itemsToReceive[rank + 1], rank + _rankOffset);
+  }
+  Request::wait(requests);
+
+  const std::vector<int> &gathered = itemsToReceive;
+  broadcast(gathered);
+}
+
+void Communication::allgather(int itemToSend, std::vector<int> &itemsToReceive, Rank primaryRank)
+{
+  PRECICE_TRACE();
+
+  auto request = aSend(itemToSend, primaryRank);
+  request->wait();
+  broadcast(itemsToReceive, primaryRank);
+}
+
+void Communication::gather(precice::span<const int> itemsToSend, std::vector<int> &itemsToReceive, std::vector<int> &counts)
+{
+  PRECICE_TRACE(itemsToSend.size());
+
+  counts.assign(getRemoteCommunicatorSize() + 1, 0);
+  counts[0] = itemsToSend.size();
+
+  std::vector<PtrRequest> requests(getRemoteCommunicatorSize());
+  for (Rank rank : remoteCommunicatorRanks()) {
+    requests[rank] = aReceive(counts[rank + 1], rank + _rankOffset);
+  }
+  Request::wait(requests);
+
+  itemsToReceive.resize(std::accumulate(counts.begin(), counts.end(), 0));
+  std::copy(itemsToSend.begin(), itemsToSend.end(), itemsToReceive.begin());
+
+  // all secondary ranks already sent their items, so receiving them in order does not serialize the senders
+  int offset = counts[0];
+  for (Rank rank : remoteCommunicatorRanks()) {
+    const int count = counts[rank + 1];
+    if (count > 0) {
+      receive(precice::span<int>{itemsToReceive.data() + offset, static_cast<std::size_t>(count)}, rank + _rankOffset);
+      offset += count;
+    }
+  }
+}
+
+void Communication::gather(precice::span<const int> itemsToSend, Rank primaryRank)
+{
+  PRECICE_TRACE(itemsToSend.size());
+
+  const int               count = itemsToSend.size();
+  std::vector<PtrRequest> requests{aSend(count, primaryRank)};
+  if (count > 0) {
+    requests.push_back(aSend(itemsToSend, primaryRank));
+  }
+  Request::wait(requests);
+}
+
+std::string Communication::listenAsServer()
+{
+  PRECICE_UNREACHABLE("This communication does not support establishing connections from an address table.");
+  return {};
+}
+
+void Communication::connectAsClient(std::map<int, std::string> const &, int)
+{
+  PRECICE_UNREACHABLE("This communication does not support establishing connections from an address table.");
+}
+
 void Communication::sendRange(precice::span<const double> itemsToSend, Rank rankReceiver)
 {
   int size = itemsToSend.size();
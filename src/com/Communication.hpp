@@ -1,5 +1,6 @@
 #pragma once
 
+#include <map>
 #include <set>
 #include <stddef.h>
 #include <string>
@@ -75,6 +76,26 @@ public:
    */
   virtual size_t getRemoteCommunicatorSize() = 0;
 
+  /**
+   * @brief Returns whether any two ranks of an intra-participant communication can exchange messages.
+   *
+   * Otherwise, secondary ranks can only communicate with the primary rank.
+   */
+  virtual bool connectsAllRanks() const
+  {
+    return false;
+  }
+
+  /**
+   * @brief Returns whether connections can be established from an exchanged address table.
+   *
+   * @see listenAsServer() and requestConnectionAsClient() with addresses.
+   */
+  virtual bool supportsAddressTable() const
+  {
+    return false;
+  }
+
   /**
    * @brief Returns a range over all valid remote ranks.
    *
@@ -169,6 +190,30 @@ public:
                                          std::set<int> const &acceptorRanks,
                                          int                  requesterRank) = 0;
 
+  /**
+   * @brief Starts listening for acceptConnectionAsServer() without publishing a connection file.
+   *
+   * The returned address of each rank is exchanged in a single address table between the participants,
+   * instead of one connection file per rank. A subsequent acceptConnectionAsServer() accepts at this
+   * address and does not publish a connection file.
+   * Only available if supportsAddressTable() is true.
+   *
+   * @returns the address to pass to connectAsClient()
+   */
+  virtual std::string listenAsServer();
+
+  /**
+   * @brief Connects to acceptors, which have called listenAsServer() and acceptConnectionAsServer().
+   *
+   * Equivalent to requestConnectionAsClient(), but connects to the given addresses instead of
+   * reading connection files. Only available if supportsAddressTable() is true.
+   *
+   * @param[in] acceptorAddresses Addresses returned by listenAsServer() of the accepting ranks
+   * @param[in] requesterRank Rank that requests the connection, usually the caller's rank
+   */
+  virtual void connectAsClient(std::map<int, std::string> const &acceptorAddresses,
+                               int                               requesterRank);
+
   /** Establishes the intra-participant communication connection.
    *
    * @param[in] participantName Name of the calling participant.
@@ -257,6 +302,30 @@ public:
 
   /// @}
 
+  /// @name Gather
+  /// @{
+
+  /**
+   * @brief Gathers one item of every rank on all ranks, ordered by rank. Called on the primary rank.
+   *
+   * The primary rank receives from all secondary ranks concurrently and broadcasts the result.
+   */
+  virtual void allgather(int itemToSend, std::vector<int> &itemsToReceive);
+  /// Gathers one item of every rank on all ranks, ordered by rank. Called on the secondary ranks.
+  virtual void allgather(int itemToSend, std::vector<int> &itemsToReceive, Rank primaryRank);
+
+  /**
+   * @brief Gathers the items of every rank on the primary rank, ordered by rank. Called on the primary rank.
+   *
+   * The number of items may differ between ranks and is returned in counts. The primary rank receives
+   * the counts of all secondary ranks concurrently before it receives the items.
+   */
+  virtual void gather(precice::span<const int> itemsToSend, std::vector<int> &itemsToReceive, std::vector<int> &counts);
+  /// Gathers the items of every rank on the primary rank, ordered by rank. Called on the secondary ranks.
+  virtual void gather(precice::span<const int> itemsToSend, Rank primaryRank);
+
+  /// @}
+
   /// @name Send
   /// @{
 
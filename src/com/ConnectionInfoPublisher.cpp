@@ -15,6 +15,12 @@
 #include "precice/impl/Types.hpp"
 #include "utils/assertion.hpp"
 
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
 namespace fs = std::filesystem;
 namespace precice::com {
 
@@ -32,6 +38,54 @@ try {
   PRECICE_UNREACHABLE("preCICE hashing failed", e.what());
   return "";
 }
+
+#ifdef __linux__
+/**
+ * Waits for the file using inotify events of its closest existing parent directory.
+ *
+ * Events of other hosts are not reported on network file systems, hence the existence is rechecked periodically.
+ *
+ * @returns false if inotify is unavailable
+ */
+bool waitForFileEvents(const fs::path &path)
+{
+  int fd = inotify_init1(IN_CLOEXEC | IN_NONBLOCK);
+  if (fd < 0) {
+    return false;
+  }
+
+  constexpr int recheckMilliseconds = 10;
+  bool          watched             = true;
+  while (watched && !fs::exists(path)) {
+    // The writer may create the parent directories first, which are reported as events of an existing ancestor
+    std::error_code error;
+    fs::path        directory = path.parent_path();
+    while (!directory.empty() && !fs::is_directory(directory, error)) {
+      directory = directory.parent_path();
+    }
+    if (directory.empty()) {
+      directory = ".";
+    }
+
+    int wd = inotify_add_watch(fd, directory.c_str(), IN_CREATE | IN_MOVED_TO);
+    if (wd < 0) {
+      watched = false;
+      break;
+    }
+    // The file may have been published before the watch was added
+    if (!fs::exists(path)) {
+      pollfd pfd{fd, POLLIN, 0};
+      ::poll(&pfd, 1, recheckMilliseconds);
+      alignas(inotify_event) char events[4096];
+      while (::read(fd, events, sizeof(events)) > 0) {
+      }
+    }
+    inotify_rm_watch(fd, wd);
+  }
+  ::close(fd);
+  return watched;
+}
+#endif
 } // namespace
 
 std::string impl::hashedFilePath(std::string_view acceptorName, std::string_view requesterName, std::string_view tag, Rank rank)
@@ -74,9 +128,15 @@ std::string ConnectionInfoReader::read() const
   auto path = getFilename();
 
   PRECICE_DEBUG("Waiting for connection file \"{}\"", path);
-  const auto waitdelay = std::chrono::milliseconds(1);
-  while (!fs::exists(path)) {
-    std::this_thread::sleep_for(waitdelay);
+  bool waited = false;
+#ifdef __linux__
+  waited = waitForFileEvents(path);
+#endif
+  if (!waited) {
+    const auto waitdelay = std::chrono::milliseconds(1);
+    while (!fs::exists(path)) {
+      std::this_thread::sleep_for(waitdelay);
+    }
   }
   PRECICE_ASSERT(fs::exists(path));
   PRECICE_DEBUG("Found connection file \"{}\"", path);
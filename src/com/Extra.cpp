@@ -5,9 +5,9 @@
 
 namespace precice::com {
 
-void sendMesh(Communication &communication, int rankReceiver, const mesh::Mesh &mesh)
+void sendMesh(Communication &communication, int rankReceiver, const mesh::Mesh &mesh, bool compress)
 {
-  serialize::SerializedMesh::serialize(mesh).send(communication, rankReceiver);
+  serialize::SerializedMesh::serialize(mesh).send(communication, rankReceiver, compress);
 }
 
 void receiveMesh(Communication &communication, int rankSender, mesh::Mesh &mesh)
@@ -15,9 +15,9 @@ void receiveMesh(Communication &communication, int rankSender, mesh::Mesh &mesh)
   serialize::SerializedMesh::receive(communication, rankSender).addToMesh(mesh);
 }
 
-void broadcastSendMesh(Communication &communication, const mesh::Mesh &mesh)
+void broadcastSendMesh(Communication &communication, const mesh::Mesh &mesh, bool compress)
 {
-  serialize::SerializedMesh::serialize(mesh).broadcastSend(communication);
+  serialize::SerializedMesh::serialize(mesh).broadcastSend(communication, compress);
 }
 
 void broadcastReceiveMesh(Communication &communication, mesh::Mesh &mesh)
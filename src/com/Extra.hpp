@@ -5,11 +5,13 @@
 
 namespace precice::com {
 
-void sendMesh(Communication &communication, int rankReceiver, const mesh::Mesh &mesh);
+/// Sends the mesh, optionally compressed. receiveMesh() detects the encoding.
+void sendMesh(Communication &communication, int rankReceiver, const mesh::Mesh &mesh, bool compress = false);
 
 void receiveMesh(Communication &communication, int rankSender, mesh::Mesh &mesh);
 
-void broadcastSendMesh(Communication &communication, const mesh::Mesh &mesh);
+/// Broadcasts the mesh, optionally compressed. broadcastReceiveMesh() detects the encoding.
+void broadcastSendMesh(Communication &communication, const mesh::Mesh &mesh, bool compress = false);
 
 void broadcastReceiveMesh(Communication &communication, mesh::Mesh &mesh);
 
@@ -2,6 +2,8 @@
 
 #include <cstddef>
 #include <memory>
+#include <numeric>
+#include <vector>
 
 #include "com/MPIDirectCommunication.hpp"
 #include "logging/LogMacros.hpp"
@@ -206,6 +208,41 @@ void MPIDirectCommunication::broadcast(bool &itemToReceive, Rank rankBroadcaster
   itemToReceive = item;
 }
 
+void MPIDirectCommunication::allgather(int itemToSend, std::vector<int> &itemsToReceive)
+{
+  PRECICE_TRACE();
+  itemsToReceive.resize(_commState->size());
+  MPI_Allgather(&itemToSend, 1, MPI_INT, itemsToReceive.data(), 1, MPI_INT, _commState->comm);
+}
+
+void MPIDirectCommunication::allgather(int itemToSend, std::vector<int> &itemsToReceive, Rank primaryRank)
+{
+  PRECICE_TRACE();
+  itemsToReceive.resize(_commState->size());
+  MPI_Allgather(&itemToSend, 1, MPI_INT, itemsToReceive.data(), 1, MPI_INT, _commState->comm);
+}
+
+void MPIDirectCommunication::gather(precice::span<const int> itemsToSend, std::vector<int> &itemsToReceive, std::vector<int> &counts)
+{
+  PRECICE_TRACE(itemsToSend.size());
+  int count = itemsToSend.size();
+  counts.resize(_commState->size());
+  MPI_Gather(&count, 1, MPI_INT, counts.data(), 1, MPI_INT, _commState->rank(), _commState->comm);
+
+  std::vector<int> displacements(counts.size(), 0);
+  std::partial_sum(counts.begin(), counts.end() - 1, displacements.begin() + 1);
+  itemsToReceive.resize(displacements.back() + counts.back());
+  MPI_Gatherv(itemsToSend.data(), count, MPI_INT, itemsToReceive.data(), counts.data(), displacements.data(), MPI_INT, _commState->rank(), _commState->comm);
+}
+
+void MPIDirectCommunication::gather(precice::span<const int> itemsToSend, Rank primaryRank)
+{
+  PRECICE_TRACE(itemsToSend.size());
+  int count = itemsToSend.size();
+  MPI_Gather(&count, 1, MPI_INT, nullptr, 1, MPI_INT, primaryRank, _commState->comm);
+  MPI_Gatherv(itemsToSend.data(), count, MPI_INT, nullptr, nullptr, nullptr, MPI_INT, primaryRank, _commState->comm);
+}
+
 MPI_Comm &MPIDirectCommunication::communicator(Rank rank)
 {
   return _commState->comm;
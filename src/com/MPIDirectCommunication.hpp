@@ -6,6 +6,7 @@
 #include <set>
 #include <stddef.h>
 #include <string>
+#include <vector>
 
 #include "com/MPICommunication.hpp"
 #include "logging/Logger.hpp"
@@ -41,6 +42,12 @@ public:
    */
   virtual size_t getRemoteCommunicatorSize() override;
 
+  /// All ranks share the communicator
+  bool connectsAllRanks() const override
+  {
+    return true;
+  }
+
   /** See precice::com::Communication::acceptConnection().
    * @attention Calls precice::utils::Parallel::splitCommunicator()
    * if local and global communicators are equal.
@@ -122,6 +129,14 @@ public:
 
   virtual void broadcast(bool &itemToReceive, Rank rankBroadcaster) override;
 
+  virtual void allgather(int itemToSend, std::vector<int> &itemsToReceive) override;
+
+  virtual void allgather(int itemToSend, std::vector<int> &itemsToReceive, Rank primaryRank) override;
+
+  virtual void gather(precice::span<const int> itemsToSend, std::vector<int> &itemsToReceive, std::vector<int> &counts) override;
+
+  virtual void gather(precice::span<const int> itemsToSend, Rank primaryRank) override;
+
 private:
   virtual MPI_Comm &communicator(Rank rank = 0) override;
 
@@ -1,5 +1,8 @@
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <map>
+#include <utility>
 
 #include "com/Communication.hpp"
 #include "com/SerializedMesh.hpp"
@@ -9,6 +12,104 @@
 
 namespace precice::com::serialize {
 
+namespace {
+
+/// Appends the differences of the items to the items stride positions before as zigzag and varint encoded bytes
+void encodeDeltas(const int *items, std::size_t count, std::size_t stride, std::vector<std::uint8_t> &bytes)
+{
+  for (std::size_t i = 0; i < count; ++i) {
+    const std::int64_t previous = (i < stride) ? 0 : items[i - stride];
+    const std::int64_t delta    = items[i] - previous;
+    // zigzag maps small negative and positive differences to small unsigned values
+    auto value = (static_cast<std::uint64_t>(delta) << 1) ^ static_cast<std::uint64_t>(delta >> 63);
+    while (value >= 0x80) {
+      bytes.push_back(static_cast<std::uint8_t>(value | 0x80));
+      value >>= 7;
+    }
+    bytes.push_back(static_cast<std::uint8_t>(value));
+  }
+}
+
+/// Reverts encodeDeltas and returns the position after the last decoded byte
+const std::uint8_t *decodeDeltas(const std::uint8_t *bytes, int *items, std::size_t count, std::size_t stride)
+{
+  for (std::size_t i = 0; i < count; ++i) {
+    std::uint64_t value = 0;
+    for (int shift = 0;; shift += 7) {
+      const std::uint8_t byte = *bytes++;
+      value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+      if ((byte & 0x80) == 0) {
+        break;
+      }
+    }
+    const auto         delta    = static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+    const std::int64_t previous = (i < stride) ? 0 : items[i - stride];
+    items[i]                    = static_cast<int>(previous + delta);
+  }
+  return bytes;
+}
+
+/** Appends the items XOR-ed with the items stride positions before
+ *
+ * Coordinates of neighboring vertices share the sign, the exponent and the leading digits of the mantissa,
+ * hence the XOR-ed value has leading zero bytes. Coordinates on regular grids additionally have trailing zero bytes.
+ * Each value is written as a control byte holding the number of trailing zero bytes and the number of remaining
+ * significant bytes, followed by the significant bytes. The encoding is lossless.
+ */
+void encodeCoordinates(const double *items, std::size_t count, std::size_t stride, std::vector<std::uint8_t> &bytes)
+{
+  for (std::size_t i = 0; i < count; ++i) {
+    std::uint64_t current  = 0;
+    std::uint64_t previous = 0;
+    std::memcpy(&current, &items[i], sizeof(current));
+    if (i >= stride) {
+      std::memcpy(&previous, &items[i - stride], sizeof(previous));
+    }
+    std::uint64_t value = current ^ previous;
+    if (value == 0) {
+      bytes.push_back(0);
+      continue;
+    }
+    int trailing = 0;
+    while ((value & 0xFF) == 0) {
+      value >>= 8;
+      ++trailing;
+    }
+    std::uint8_t significant[sizeof(value)];
+    int          nSignificant = 0;
+    do {
+      significant[nSignificant++] = static_cast<std::uint8_t>(value);
+      value >>= 8;
+    } while (value != 0);
+    bytes.push_back(static_cast<std::uint8_t>(trailing << 4 | nSignificant));
+    bytes.insert(bytes.end(), significant, significant + nSignificant);
+  }
+}
+
+/// Reverts encodeCoordinates and returns the position after the last decoded byte
+const std::uint8_t *decodeCoordinates(const std::uint8_t *bytes, double *items, std::size_t count, std::size_t stride)
+{
+  for (std::size_t i = 0; i < count; ++i) {
+    const std::uint8_t control      = *bytes++;
+    const int          trailing     = control >> 4;
+    const int          nSignificant = control & 0x0F;
+    std::uint64_t      value        = 0;
+    for (int byte = 0; byte < nSignificant; ++byte) {
+      value |= static_cast<std::uint64_t>(*bytes++) << (8 * byte);
+    }
+    value <<= 8 * trailing;
+    std::uint64_t previous = 0;
+    if (i >= stride) {
+      std::memcpy(&previous, &items[i - stride], sizeof(previous));
+    }
+    const std::uint64_t current = value ^ previous;
+    std::memcpy(&items[i], &current, sizeof(current));
+  }
+  return bytes;
+}
+
+} // namespace
+
 void SerializedMesh ::assertValid() const
 {
   PRECICE_ASSERT(sizes.size() == 5);
@@ -47,48 +148,126 @@ void SerializedMesh ::assertValid() const
   }
 }
 
-void SerializedMesh::send(Communication &communication, int rankReceiver)
+std::vector<int> SerializedMesh::encode() const
+{
+  const std::size_t dim = sizes[0];
+  // global and local ids of vertices are interleaved if there is connectivity
+  const bool        hasConnectivity = (sizes[2] + sizes[3] + sizes[4]) > 0;
+  const std::size_t vertexStride    = hasConnectivity ? 2 : 1;
+  const std::size_t nVertexIDs      = sizes[1] * vertexStride;
+  PRECICE_ASSERT(nVertexIDs <= ids.size());
+
+  std::vector<std::uint8_t> bytes;
+  bytes.reserve(coords.size() * 4 + ids.size() * 2);
+  // every component is compared to the same component of the previous vertex
+  encodeCoordinates(coords.data(), coords.size(), dim, bytes);
+  encodeDeltas(ids.data(), nVertexIDs, vertexStride, bytes);
+  // connected vertices are usually close to each other
+  encodeDeltas(ids.data() + nVertexIDs, ids.size() - nVertexIDs, 1, bytes);
+
+  // the first entry holds the number of bytes
+  std::vector<int> packed(1 + (bytes.size() + sizeof(int) - 1) / sizeof(int), 0);
+  packed[0] = static_cast<int>(bytes.size());
+  std::memcpy(packed.data() + 1, bytes.data(), bytes.size());
+  return packed;
+}
+
+void SerializedMesh::decode(const std::vector<int> &packed)
+{
+  PRECICE_ASSERT(!packed.empty());
+  const std::size_t dim             = sizes[0];
+  const bool        hasConnectivity = (sizes[2] + sizes[3] + sizes[4]) > 0;
+  const std::size_t vertexStride    = hasConnectivity ? 2 : 1;
+  const std::size_t nVertexIDs      = sizes[1] * vertexStride;
+  const std::size_t nIDs            = hasConnectivity ? nVertexIDs + 2 * sizes[2] + 3 * sizes[3] + 4 * sizes[4] : nVertexIDs;
+
+  coords.resize(sizes[1] * dim);
+  ids.resize(nIDs);
+  const auto *begin = reinterpret_cast<const std::uint8_t *>(packed.data() + 1);
+  const auto *pos   = decodeCoordinates(begin, coords.data(), coords.size(), dim);
+  pos               = decodeDeltas(pos, ids.data(), nVertexIDs, vertexStride);
+  pos               = decodeDeltas(pos, ids.data() + nVertexIDs, nIDs - nVertexIDs, 1);
+  PRECICE_ASSERT(pos == begin + packed[0], "The encoded mesh does not match its sizes.");
+}
+
+std::vector<int> SerializedMesh::header(bool compress) const
+{
+  // the encoding follows the sizes
+  std::vector<int> result = sizes;
+  result.push_back(compress ? COMPRESSED : RAW);
+  return result;
+}
+
+SerializedMesh::Encoding SerializedMesh::readHeader(std::vector<int> &&header)
+{
+  PRECICE_ASSERT(header.size() == 6);
+  const auto encoding = static_cast<Encoding>(header.back());
+  PRECICE_ASSERT(encoding == RAW || encoding == COMPRESSED, static_cast<int>(encoding));
+  header.pop_back();
+  sizes = std::move(header);
+  return encoding;
+}
+
+void SerializedMesh::send(Communication &communication, int rankReceiver, bool compress)
 {
-  communication.sendRange(sizes, rankReceiver);
+  communication.sendRange(header(compress), rankReceiver);
   if (sizes[1] > 0) {
-    communication.sendRange(coords, rankReceiver);
-    communication.sendRange(ids, rankReceiver);
+    if (compress) {
+      communication.sendRange(encode(), rankReceiver);
+    } else {
+      communication.sendRange(coords, rankReceiver);
+      communication.sendRange(ids, rankReceiver);
+    }
   }
 }
 
 SerializedMesh SerializedMesh::receive(Communication &communication, int rankSender)
 {
   SerializedMesh sm;
-  sm.sizes = communication.receiveRange(rankSender, asVector<int>);
-  PRECICE_ASSERT(sm.sizes.size() == 5);
-  auto nVertices = sm.sizes[1];
+  const auto     encoding  = sm.readHeader(communication.receiveRange(rankSender, asVector<int>));
+  auto           nVertices = sm.sizes[1];
   if (nVertices > 0) {
-    sm.coords = communication.receiveRange(rankSender, asVector<double>);
-    sm.ids    = communication.receiveRange(rankSender, asVector<int>);
+    if (encoding == COMPRESSED) {
+      sm.decode(communication.receiveRange(rankSender, asVector<int>));
+    } else {
+      sm.coords = communication.receiveRange(rankSender, asVector<double>);
+      sm.ids    = communication.receiveRange(rankSender, asVector<int>);
+    }
   }
   sm.assertValid();
   return sm;
 }
 
-void SerializedMesh::broadcastSend(Communication &communication)
+void SerializedMesh::broadcastSend(Communication &communication, bool compress)
 {
-  communication.broadcast(sizes);
+  communication.broadcast(header(compress));
   if (sizes[1] > 0) {
-    communication.broadcast(coords);
-    communication.broadcast(ids);
+    if (compress) {
+      communication.broadcast(encode());
+    } else {
+      communication.broadcast(coords);
+      communication.broadcast(ids);
+    }
   }
 }
 
 SerializedMesh SerializedMesh::broadcastReceive(Communication &communication)
 {
-  constexpr int  broadcasterRank{0};
-  SerializedMesh sm;
-  communication.broadcast(sm.sizes, broadcasterRank);
-  PRECICE_ASSERT(sm.sizes.size() == 5);
-  auto nVertices = sm.sizes[1];
+  constexpr int    broadcasterRank{0};
+  SerializedMesh   sm;
+  std::vector<int> header;
+  communication.broadcast(header, broadcasterRank);
+  const auto encoding  = sm.readHeader(std::move(header));
+  auto       nVertices = sm.sizes[1];
   if (nVertices > 0) {
-    communication.broadcast(sm.coords, broadcasterRank);
-    communication.broadcast(sm.ids, broadcasterRank);
+    if (encoding == COMPRESSED) {
+      std::vector<int> packed;
+      communication.broadcast(packed, broadcasterRank);
+      sm.decode(packed);
+    } else {
+      communication.broadcast(sm.coords, broadcasterRank);
+      communication.broadcast(sm.ids, broadcasterRank);
+    }
   }
   sm.assertValid();
   return sm;
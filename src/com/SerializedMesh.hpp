@@ -29,12 +29,18 @@ public:
   /// asserts the content for correctness
   void assertValid() const;
 
-  void send(Communication &communication, int rankReceiver);
+  /** sends the serialized mesh
+   *
+   * If compress is set, the mesh is sent as a single lossless encoded byte stream, see encode().
+   * The receiver detects the encoding from the transmitted sizes.
+   */
+  void send(Communication &communication, int rankReceiver, bool compress = false);
 
   /// receives a SerializedMesh and calls assertValid before returning
   static SerializedMesh receive(Communication &communication, int rankSender);
 
-  void broadcastSend(Communication &communication);
+  /// broadcasts the serialized mesh, optionally encoded as in send()
+  void broadcastSend(Communication &communication, bool compress = false);
 
   /// receives a SerializedMesh and calls assertValid before returning
   static SerializedMesh broadcastReceive(Communication &communication);
@@ -42,6 +48,28 @@ public:
 private:
   SerializedMesh() = default;
 
+  /// Encodings of the mesh used by send and broadcastSend
+  enum Encoding : int {
+    RAW        = 0,
+    COMPRESSED = 1
+  };
+
+  /** the coordinates followed by the ids as one byte stream, packed into ints
+   *
+   * Coordinates are XOR encoded against the same component of the previous vertex,
+   * ids are zigzag and varint encoded differences.
+   */
+  std::vector<int> encode() const;
+
+  /// restores the coordinates and ids from the packed stream of encode()
+  void decode(const std::vector<int> &packed);
+
+  /// the sizes followed by the encoding
+  std::vector<int> header(bool compress) const;
+
+  /// reads the sizes from a header and returns the encoding
+  Encoding readHeader(std::vector<int> &&header);
+
   /// contains the dimension, followed by the numbers of vertices, edges, triangles, and tetrahedra
   std::vector<int> sizes;
 
@@ -0,0 +1,833 @@
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <new>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
+#include "ConnectionInfoPublisher.hpp"
+#include "SharedMemoryCommunication.hpp"
+#include "com/Request.hpp"
+#include "logging/LogMacros.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice::com {
+
+namespace impl {
+
+namespace {
+
+/// Blocks while the word holds the expected value, at most for a millisecond
+void waitOnWord(std::atomic<std::uint32_t> &word, std::uint32_t expected)
+{
+#ifdef __linux__
+  timespec timeout{0, 1000000};
+  syscall(SYS_futex, reinterpret_cast<std::uint32_t *>(&word), FUTEX_WAIT, expected, &timeout, nullptr, 0);
+#else
+  if (word.load() == expected) {
+    std::this_thread::sleep_for(std::chrono::microseconds(50));
+  }
+#endif
+}
+
+/// Wakes all processes blocked in waitOnWord
+void wakeWord(std::atomic<std::uint32_t> &word)
+{
+#ifdef __linux__
+  syscall(SYS_futex, reinterpret_cast<std::uint32_t *>(&word), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+#endif
+}
+
+} // namespace
+
+/// An event counter in shared memory, which processes can wait on
+struct SharedSignal {
+  std::atomic<std::uint32_t> events{0};
+  std::atomic<std::uint32_t> waiters{0};
+
+  void notify()
+  {
+    events.fetch_add(1);
+    // skip the system call if nobody sleeps
+    if (waiters.load() > 0) {
+      wakeWord(events);
+    }
+  }
+
+  template <typename Predicate>
+  void waitUntil(Predicate ready)
+  {
+    // spin first, as the other side is typically just about to deliver
+    for (int spin = 0; spin < 1000; ++spin) {
+      if (ready()) {
+        return;
+      }
+    }
+    while (not ready()) {
+      const auto snapshot = events.load();
+      waiters.fetch_add(1);
+      if (not ready()) {
+        waitOnWord(events, snapshot);
+      }
+      waiters.fetch_sub(1);
+    }
+  }
+};
+
+static_assert(std::atomic<std::uint32_t>::is_always_lock_free && std::atomic<std::uint64_t>::is_always_lock_free,
+              "Atomics in shared memory have to be lock-free.");
+
+/// A mapped POSIX shared memory segment
+class Segment {
+public:
+  Segment(std::string name, bool create, std::size_t size)
+      : _name(std::move(name))
+  {
+    const int fd = shm_open(_name.c_str(), create ? (O_CREAT | O_EXCL | O_RDWR) : O_RDWR, S_IRUSR | S_IWUSR);
+    PRECICE_CHECK(fd != -1, "Opening the shared memory segment \"{}\" failed with the system error: {}", _name, std::strerror(errno));
+    if (create) {
+      PRECICE_CHECK(ftruncate(fd, size) == 0, "Resizing the shared memory segment \"{}\" failed with the system error: {}", _name, std::strerror(errno));
+    } else {
+      struct stat info;
+      PRECICE_CHECK(fstat(fd, &info) == 0, "Querying the size of the shared memory segment \"{}\" failed with the system error: {}", _name, std::strerror(errno));
+      size = info.st_size;
+    }
+    _size = size;
+    _data = mmap(nullptr, _size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    PRECICE_CHECK(_data != MAP_FAILED, "Mapping the shared memory segment \"{}\" failed with the system error: {}", _name, std::strerror(errno));
+  }
+
+  ~Segment()
+  {
+    munmap(_data, _size);
+  }
+
+  Segment(const Segment &) = delete;
+  Segment &operator=(const Segment &) = delete;
+
+  /// Removes the name, the memory stays valid until all processes unmapped it
+  void unlink()
+  {
+    shm_unlink(_name.c_str());
+  }
+
+  void *data() const
+  {
+    return _data;
+  }
+
+private:
+  mutable logging::Logger _log{"com::SharedMemoryCommunication"};
+  std::string             _name;
+  std::size_t             _size = 0;
+  void *                  _data = nullptr;
+};
+
+/// The shared state of a ring buffer, followed by the buffer itself
+struct ChannelHeader {
+  std::uint64_t capacity;
+  alignas(64) std::atomic<std::uint64_t> written{0};
+  SharedSignal dataSignal;
+  alignas(64) std::atomic<std::uint64_t> read{0};
+  SharedSignal spaceSignal;
+};
+
+constexpr std::size_t channelDataOffset = (sizeof(ChannelHeader) + 63) / 64 * 64;
+
+namespace {
+
+/// The shared state to establish connections, followed by capacity rank slots
+struct ControlBlock {
+  std::int32_t              capacity;
+  std::atomic<std::int32_t> requesterSize{0};
+  std::atomic<std::int32_t> reserved{0};
+  std::atomic<std::int32_t> connected{0};
+  SharedSignal              connectedSignal;
+};
+
+constexpr std::size_t controlSlotOffset = (sizeof(ControlBlock) + 63) / 64 * 64;
+
+std::atomic<std::int32_t> *controlSlots(const Segment &segment)
+{
+  return reinterpret_cast<std::atomic<std::int32_t> *>(static_cast<char *>(segment.data()) + controlSlotOffset);
+}
+
+/// Returns a prefix for segment names, which is unique on this node
+std::string uniquePrefix()
+{
+  static std::atomic<int> counter{0};
+  return "/precice-" + std::to_string(getpid()) + "-" + std::to_string(counter++);
+}
+
+std::string channelName(std::string const &prefix, int requesterRank, bool toAcceptor)
+{
+  return prefix + "-" + std::to_string(requesterRank) + (toAcceptor ? "-up" : "-down");
+}
+
+} // namespace
+
+/// A single-producer single-consumer ring buffer in shared memory
+class SharedMemoryChannel {
+public:
+  static std::shared_ptr<SharedMemoryChannel> create(std::string const &name, std::size_t capacity)
+  {
+    auto segment = std::make_unique<Segment>(name, true, channelDataOffset + capacity);
+    auto header  = new (segment->data()) ChannelHeader;
+    header->capacity = capacity;
+    return std::shared_ptr<SharedMemoryChannel>(new SharedMemoryChannel(std::move(segment)));
+  }
+
+  static std::shared_ptr<SharedMemoryChannel> open(std::string const &name)
+  {
+    return std::shared_ptr<SharedMemoryChannel>(new SharedMemoryChannel(std::make_unique<Segment>(name, false, 0)));
+  }
+
+  void unlink()
+  {
+    _segment->unlink();
+  }
+
+  /// Copies as many bytes as fit into the buffer and returns their number
+  std::size_t tryWrite(const char *data, std::size_t size)
+  {
+    const std::uint64_t head  = _header->written.load(std::memory_order_relaxed);
+    const std::uint64_t tail  = _header->read.load(std::memory_order_acquire);
+    const std::size_t   count = std::min<std::size_t>(size, _capacity - (head - tail));
+    if (count == 0) {
+      return 0;
+    }
+    const std::size_t begin = head % _capacity;
+    const std::size_t first = std::min(count, _capacity - begin);
+    std::memcpy(_buffer + begin, data, first);
+    std::memcpy(_buffer, data + first, count - first);
+    _header->written.store(head + count, std::memory_order_release);
+    _header->dataSignal.notify();
+    return count;
+  }
+
+  /// Copies as many bytes as are available from the buffer and returns their number
+  std::size_t tryRead(char *data, std::size_t size)
+  {
+    const std::uint64_t tail  = _header->read.load(std::memory_order_relaxed);
+    const std::uint64_t head  = _header->written.load(std::memory_order_acquire);
+    const std::size_t   count = std::min<std::size_t>(size, head - tail);
+    if (count == 0) {
+      return 0;
+    }
+    const std::size_t begin = tail % _capacity;
+    const std::size_t first = std::min(count, _capacity - begin);
+    std::memcpy(data, _buffer + begin, first);
+    std::memcpy(data + first, _buffer, count - first);
+    _header->read.store(tail + count, std::memory_order_release);
+    _header->spaceSignal.notify();
+    return count;
+  }
+
+  /// Writes all bytes, waiting for the consumer to free space if required
+  void write(const char *data, std::size_t size)
+  {
+    std::size_t sent = tryWrite(data, size);
+    while (sent < size) {
+      _header->spaceSignal.waitUntil([this] { return hasSpace(); });
+      sent += tryWrite(data + sent, size - sent);
+    }
+  }
+
+  /// Waits until data is available
+  void waitForData()
+  {
+    _header->dataSignal.waitUntil([this] { return hasData(); });
+  }
+
+private:
+  explicit SharedMemoryChannel(std::unique_ptr<Segment> segment)
+      : _segment(std::move(segment)),
+        _header(static_cast<ChannelHeader *>(_segment->data())),
+        _buffer(static_cast<char *>(_segment->data()) + channelDataOffset),
+        _capacity(_header->capacity)
+  {
+  }
+
+  bool hasData() const
+  {
+    return _header->written.load(std::memory_order_acquire) != _header->read.load(std::memory_order_relaxed);
+  }
+
+  bool hasSpace() const
+  {
+    return _header->written.load(std::memory_order_relaxed) - _header->read.load(std::memory_order_acquire) < _capacity;
+  }
+
+  std::unique_ptr<Segment> _segment;
+  ChannelHeader *          _header;
+  char *                   _buffer;
+  std::size_t              _capacity;
+};
+
+/// A receive, which is filled by SharedMemoryReceiveQueue::progress
+struct PendingReceive {
+  char *      data;
+  std::size_t size;
+  std::size_t received = 0;
+
+  bool complete() const
+  {
+    return received == size;
+  }
+};
+
+/// The receiving end of a channel, which fills the pending receives in order
+struct SharedMemoryReceiveQueue {
+  std::shared_ptr<SharedMemoryChannel>        channel;
+  std::deque<std::shared_ptr<PendingReceive>> pending;
+
+  /// Reads the available data into the pending receives without blocking
+  void progress()
+  {
+    while (not pending.empty()) {
+      auto &front = *pending.front();
+      front.received += channel->tryRead(front.data + front.received, front.size - front.received);
+      if (not front.complete()) {
+        return;
+      }
+      pending.pop_front();
+    }
+  }
+
+  /// Receives data until the given receive and all receives before it are complete
+  void waitFor(const PendingReceive &item)
+  {
+    progress();
+    while (not item.complete()) {
+      channel->waitForData();
+      progress();
+    }
+  }
+};
+
+/// Request of an asynchronous send, completed by the send thread
+class SharedMemorySendRequest : public Request {
+public:
+  void complete()
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _complete = true;
+    }
+    _condition.notify_all();
+  }
+
+  bool test() override
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _complete;
+  }
+
+  void wait() override
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _condition.wait(lock, [this] { return _complete; });
+  }
+
+private:
+  bool                    _complete = false;
+  std::mutex              _mutex;
+  std::condition_variable _condition;
+};
+
+namespace {
+
+/// Request of an asynchronous receive, progressed by the calling thread
+class SharedMemoryReceiveRequest : public Request {
+public:
+  SharedMemoryReceiveRequest(std::shared_ptr<SharedMemoryReceiveQueue> queue, std::shared_ptr<PendingReceive> item)
+      : _queue(std::move(queue)), _item(std::move(item))
+  {
+  }
+
+  bool test() override
+  {
+    _queue->progress();
+    return _item->complete();
+  }
+
+  void wait() override
+  {
+    _queue->waitFor(*_item);
+  }
+
+private:
+  std::shared_ptr<SharedMemoryReceiveQueue> _queue;
+  std::shared_ptr<PendingReceive>           _item;
+};
+
+} // namespace
+} // namespace impl
+
+using namespace impl;
+
+SharedMemoryCommunication::SharedMemoryCommunication(std::string addressDirectory, std::size_t bufferSize)
+    : _addressDirectory(std::move(addressDirectory)),
+      _bufferSize(bufferSize)
+{
+  if (_addressDirectory.empty()) {
+    _addressDirectory = ".";
+  }
+}
+
+SharedMemoryCommunication::~SharedMemoryCommunication()
+{
+  PRECICE_TRACE(_isConnected);
+  closeConnection();
+}
+
+size_t SharedMemoryCommunication::getRemoteCommunicatorSize()
+{
+  PRECICE_TRACE();
+  PRECICE_ASSERT(isConnected());
+  return _connections.size();
+}
+
+void SharedMemoryCommunication::acceptConnection(std::string const &acceptorName,
+                                                 std::string const &requesterName,
+                                                 std::string const &tag,
+                                                 int                acceptorRank,
+                                                 int                rankOffset)
+{
+  PRECICE_TRACE(acceptorName, requesterName);
+  PRECICE_ASSERT(not isConnected());
+
+  setRankOffset(rankOffset);
+
+  // The requesters pass their communicator size, their ranks are contiguous
+  const std::string prefix = uniquePrefix();
+  Segment           controlSegment(prefix + "-control", true, controlSlotOffset);
+  auto &            control = *new (controlSegment.data()) ControlBlock;
+  control.capacity          = 0;
+
+  ConnectionInfoWriter conInfo(acceptorName, requesterName, tag, _addressDirectory);
+  conInfo.write(prefix);
+  PRECICE_DEBUG("Accept connection of rank {} at {}", acceptorRank, prefix);
+
+  control.connectedSignal.waitUntil([&control] {
+    const int size = control.requesterSize.load();
+    return size > 0 && control.connected.load() == size;
+  });
+  controlSegment.unlink();
+
+  for (int requesterRank = 0; requesterRank < control.requesterSize.load(); ++requesterRank) {
+    _connections[requesterRank] = openRequesterChannels(prefix, requesterRank);
+  }
+  PRECICE_DEBUG("Accepted {} connections at {}", _connections.size(), prefix);
+
+  _isConnected = true;
+  startSendThread();
+}
+
+void SharedMemoryCommunication::acceptConnectionAsServer(std::string const &acceptorName,
+                                                         std::string const &requesterName,
+                                                         std::string const &tag,
+                                                         int                acceptorRank,
+                                                         int                requesterCommunicatorSize)
+{
+  PRECICE_TRACE(acceptorName, requesterName, acceptorRank, requesterCommunicatorSize);
+  PRECICE_ASSERT(requesterCommunicatorSize >= 0, "Requester communicator size has to be positive.");
+  PRECICE_ASSERT(not isConnected());
+
+  if (requesterCommunicatorSize == 0) {
+    PRECICE_DEBUG("Accepting no connections.");
+    _isConnected = true;
+    return;
+  }
+
+  // The requesters claim a slot to announce their rank
+  const std::string prefix = uniquePrefix();
+  Segment           controlSegment(prefix + "-control", true, controlSlotOffset + requesterCommunicatorSize * sizeof(std::int32_t));
+  auto &            control = *new (controlSegment.data()) ControlBlock;
+  control.capacity          = requesterCommunicatorSize;
+  auto slots                = controlSlots(controlSegment);
+  for (int slot = 0; slot < requesterCommunicatorSize; ++slot) {
+    new (&slots[slot]) std::atomic<std::int32_t>(-1);
+  }
+
+  ConnectionInfoWriter conInfo(acceptorName, requesterName, tag, acceptorRank, _addressDirectory);
+  conInfo.write(prefix);
+  PRECICE_DEBUG("Accepting connection at {}", prefix);
+
+  control.connectedSignal.waitUntil([&control, requesterCommunicatorSize] {
+    return control.connected.load() == requesterCommunicatorSize;
+  });
+  controlSegment.unlink();
+
+  for (int slot = 0; slot < requesterCommunicatorSize; ++slot) {
+    const int requesterRank     = slots[slot].load();
+    _connections[requesterRank] = openRequesterChannels(prefix, requesterRank);
+  }
+
+  _isConnected = true;
+  startSendThread();
+}
+
+void SharedMemoryCommunication::requestConnection(std::string const &acceptorName,
+                                                  std::string const &requesterName,
+                                                  std::string const &tag,
+                                                  int                requesterRank,
+                                                  int                requesterCommunicatorSize)
+{
+  PRECICE_TRACE(acceptorName, requesterName);
+  PRECICE_ASSERT(not isConnected());
+
+  ConnectionInfoReader conInfo(acceptorName, requesterName, tag, _addressDirectory);
+  std::string const    prefix = conInfo.read();
+  PRECICE_DEBUG("Request connection to {}", prefix);
+
+  _connections[0] = connectToAcceptor(prefix, requesterRank, requesterCommunicatorSize);
+
+  _isConnected = true;
+  startSendThread();
+}
+
+void SharedMemoryCommunication::requestConnectionAsClient(std::string const &  acceptorName,
+                                                          std::string const &  requesterName,
+                                                          std::string const &  tag,
+                                                          std::set<int> const &acceptorRanks,
+                                                          int                  requesterRank)
+{
+  PRECICE_TRACE(acceptorName, requesterName, acceptorRanks, requesterRank);
+  PRECICE_ASSERT(not isConnected());
+
+  for (auto const &acceptorRank : acceptorRanks) {
+    ConnectionInfoReader conInfo(acceptorName, requesterName, tag, acceptorRank, _addressDirectory);
+    std::string const    prefix = conInfo.read();
+    PRECICE_DEBUG("Requesting connection to {}, rank = {}", prefix, acceptorRank);
+    _connections[acceptorRank] = connectToAcceptor(prefix, requesterRank, -1);
+  }
+
+  _isConnected = true;
+  startSendThread();
+}
+
+SharedMemoryCommunication::Connection SharedMemoryCommunication::connectToAcceptor(std::string const &prefix,
+                                                                                   int                requesterRank,
+                                                                                   int                requesterCommunicatorSize)
+{
+  Segment controlSegment(prefix + "-control", false, 0);
+  auto &  control = *static_cast<ControlBlock *>(controlSegment.data());
+
+  Connection connection;
+  connection.sendChannel          = SharedMemoryChannel::create(channelName(prefix, requesterRank, true), _bufferSize);
+  connection.receiveQueue         = std::make_shared<SharedMemoryReceiveQueue>();
+  connection.receiveQueue->channel = SharedMemoryChannel::create(channelName(prefix, requesterRank, false), _bufferSize);
+
+  if (control.capacity > 0) {
+    const int slot = control.reserved.fetch_add(1);
+    PRECICE_ASSERT(slot < control.capacity, "More requesters than announced try to connect.");
+    controlSlots(controlSegment)[slot].store(requesterRank);
+  } else {
+    control.requesterSize.store(requesterCommunicatorSize);
+  }
+  control.connected.fetch_add(1);
+  control.connectedSignal.notify();
+
+  return connection;
+}
+
+SharedMemoryCommunication::Connection SharedMemoryCommunication::openRequesterChannels(std::string const &prefix, int requesterRank)
+{
+  Connection connection;
+  connection.sendChannel           = SharedMemoryChannel::open(channelName(prefix, requesterRank, false));
+  connection.receiveQueue          = std::make_shared<SharedMemoryReceiveQueue>();
+  connection.receiveQueue->channel = SharedMemoryChannel::open(channelName(prefix, requesterRank, true));
+  // Both sides mapped the channels, so their names are not needed anymore
+  connection.sendChannel->unlink();
+  connection.receiveQueue->channel->unlink();
+  return connection;
+}
+
+void SharedMemoryCommunication::closeConnection()
+{
+  PRECICE_TRACE();
+
+  if (not isConnected())
+    return;
+
+  if (_sendThread.joinable()) {
+    // the send thread completes all pending sends before it stops
+    {
+      std::lock_guard<std::mutex> lock(_sendMutex);
+      _stopSending = true;
+    }
+    _sendCondition.notify_all();
+    _sendThread.join();
+  }
+  PRECICE_ASSERT(_sendQueue.empty());
+  _connections.clear();
+
+  _isConnected = false;
+}
+
+void SharedMemoryCommunication::startSendThread()
+{
+  _stopSending = false;
+  _sendThread  = std::thread([this] { processSendQueue(); });
+}
+
+void SharedMemoryCommunication::processSendQueue()
+{
+  std::unique_lock<std::mutex> lock(_sendMutex);
+  while (true) {
+    _sendCondition.wait(lock, [this] { return (not _sendQueue.empty() && not _sending) || (_stopSending && _sendQueue.empty()); });
+    if (_sendQueue.empty()) {
+      return;
+    }
+    SendItem item = std::move(_sendQueue.front());
+    _sendQueue.pop_front();
+    _sending = true;
+    lock.unlock();
+
+    item.channel->write(item.data, item.size);
+    item.request->complete();
+
+    lock.lock();
+    _sending = false;
+  }
+}
+
+PtrRequest SharedMemoryCommunication::enqueueSend(const void *data, std::size_t size, Rank rankReceiver)
+{
+  rankReceiver = adjustRank(rankReceiver);
+  PRECICE_ASSERT(rankReceiver >= 0, rankReceiver);
+  PRECICE_ASSERT(isConnected());
+  PRECICE_ASSERT(_connections.count(rankReceiver) == 1, rankReceiver);
+
+  auto request = std::make_shared<SharedMemorySendRequest>();
+  {
+    std::lock_guard<std::mutex> lock(_sendMutex);
+    _sendQueue.push_back(SendItem{_connections[rankReceiver].sendChannel, static_cast<const char *>(data), size, request});
+  }
+  _sendCondition.notify_one();
+  return request;
+}
+
+void SharedMemoryCommunication::sendBytes(const void *data, std::size_t size, Rank rankReceiver)
+{
+  const Rank adjustedRank = adjustRank(rankReceiver);
+  PRECICE_ASSERT(adjustedRank >= 0, adjustedRank);
+  PRECICE_ASSERT(isConnected());
+  PRECICE_ASSERT(_connections.count(adjustedRank) == 1, adjustedRank);
+
+  {
+    std::unique_lock<std::mutex> lock(_sendMutex);
+    if (not _sendQueue.empty() || _sending) {
+      // keep the order of pending asynchronous sends
+      lock.unlock();
+      enqueueSend(data, size, rankReceiver)->wait();
+      return;
+    }
+    _sending = true;
+  }
+
+  // write directly to avoid the hand-over to the send thread
+  _connections[adjustedRank].sendChannel->write(static_cast<const char *>(data), size);
+
+  {
+    std::lock_guard<std::mutex> lock(_sendMutex);
+    _sending = false;
+  }
+  _sendCondition.notify_one();
+}
+
+PtrRequest SharedMemoryCommunication::enqueueReceive(void *data, std::size_t size, Rank rankSender)
+{
+  rankSender = adjustRank(rankSender);
+  PRECICE_ASSERT(rankSender >= 0, rankSender);
+  PRECICE_ASSERT(isConnected());
+  PRECICE_ASSERT(_connections.count(rankSender) == 1, rankSender);
+
+  auto &queue = _connections[rankSender].receiveQueue;
+  auto  item  = std::make_shared<PendingReceive>(PendingReceive{static_cast<char *>(data), size});
+  queue->pending.push_back(item);
+  queue->progress();
+  return std::make_shared<SharedMemoryReceiveRequest>(queue, std::move(item));
+}
+
+void SharedMemoryCommunication::receiveBytes(void *data, std::size_t size, Rank rankSender)
+{
+  enqueueReceive(data, size, rankSender)->wait();
+}
+
+void SharedMemoryCommunication::send(std::string const &itemToSend, Rank rankReceiver)
+{
+  PRECICE_TRACE(itemToSend, rankReceiver);
+  size_t size = itemToSend.size() + 1;
+  sendBytes(&size, sizeof(size_t), rankReceiver);
+  sendBytes(itemToSend.c_str(), size, rankReceiver);
+}
+
+void SharedMemoryCommunication::send(precice::span<const int> itemsToSend, Rank rankReceiver)
+{
+  PRECICE_TRACE(itemsToSend.size(), rankReceiver);
+  sendBytes(itemsToSend.data(), itemsToSend.size() * sizeof(int), rankReceiver);
+}
+
+PtrRequest SharedMemoryCommunication::aSend(precice::span<const int> itemsToSend, Rank rankReceiver)
+{
+  PRECICE_TRACE(itemsToSend.size(), rankReceiver);
+  return enqueueSend(itemsToSend.data(), itemsToSend.size() * sizeof(int), rankReceiver);
+}
+
+void SharedMemoryCommunication::send(precice::span<const double> itemsToSend, Rank rankReceiver)
+{
+  PRECICE_TRACE(itemsToSend.size(), rankReceiver);
+  sendBytes(itemsToSend.data(), itemsToSend.size() * sizeof(double), rankReceiver);
+}
+
+PtrRequest SharedMemoryCommunication::aSend(precice::span<const double> itemsToSend, Rank rankReceiver)
+{
+  PRECICE_TRACE(itemsToSend.size(), rankReceiver);
+  return enqueueSend(itemsToSend.data(), itemsToSend.size() * sizeof(double), rankReceiver);
+}
+
+void SharedMemoryCommunication::send(double itemToSend, Rank rankReceiver)
+{
+  PRECICE_TRACE(itemToSend, rankReceiver);
+  sendBytes(&itemToSend, sizeof(double), rankReceiver);
+}
+
+PtrRequest SharedMemoryCommunication::aSend(const double &itemToSend, Rank rankReceiver)
+{
+  PRECICE_TRACE(itemToSend, rankReceiver);
+  return enqueueSend(&itemToSend, sizeof(double), rankReceiver);
+}
+
+void SharedMemoryCommunication::send(int itemToSend, Rank rankReceiver)
+{
+  PRECICE_TRACE(itemToSend, rankReceiver);
+  sendBytes(&itemToSend, sizeof(int), rankReceiver);
+}
+
+PtrRequest SharedMemoryCommunication::aSend(const int &itemToSend, Rank rankReceiver)
+{
+  PRECICE_TRACE(itemToSend, rankReceiver);
+  return enqueueSend(&itemToSend, sizeof(int), rankReceiver);
+}
+
+void SharedMemoryCommunication::send(bool itemToSend, Rank rankReceiver)
+{
+  PRECICE_TRACE(itemToSend, rankReceiver);
+  sendBytes(&itemToSend, sizeof(bool), rankReceiver);
+}
+
+PtrRequest SharedMemoryCommunication::aSend(const bool &itemToSend, Rank rankReceiver)
+{
+  PRECICE_TRACE(itemToSend, rankReceiver);
+  return enqueueSend(&itemToSend, sizeof(bool), rankReceiver);
+}
+
+void SharedMemoryCommunication::receive(std::string &itemToReceive, Rank rankSender)
+{
+  PRECICE_TRACE(rankSender);
+  size_t size = 0;
+  receiveBytes(&size, sizeof(size_t), rankSender);
+  std::vector<char> msg(size);
+  receiveBytes(msg.data(), size, rankSender);
+  itemToReceive = msg.data();
+}
+
+void SharedMemoryCommunication::receive(precice::span<int> itemsToReceive, Rank rankSender)
+{
+  PRECICE_TRACE(itemsToReceive.size(), rankSender);
+  receiveBytes(itemsToReceive.data(), itemsToReceive.size() * sizeof(int), rankSender);
+}
+
+void SharedMemoryCommunication::receive(precice::span<double> itemsToReceive, Rank rankSender)
+{
+  PRECICE_TRACE(itemsToReceive.size(), rankSender);
+  receiveBytes(itemsToReceive.data(), itemsToReceive.size() * sizeof(double), rankSender);
+}
+
+PtrRequest SharedMemoryCommunication::aReceive(precice::span<double> itemsToReceive, int rankSender)
+{
+  PRECICE_TRACE(itemsToReceive.size(), rankSender);
+  return enqueueReceive(itemsToReceive.data(), itemsToReceive.size() * sizeof(double), rankSender);
+}
+
+void SharedMemoryCommunication::receive(double &itemToReceive, Rank rankSender)
+{
+  PRECICE_TRACE(rankSender);
+  receiveBytes(&itemToReceive, sizeof(double), rankSender);
+}
+
+PtrRequest SharedMemoryCommunication::aReceive(double &itemToReceive, Rank rankSender)
+{
+  PRECICE_TRACE(rankSender);
+  return enqueueReceive(&itemToReceive, sizeof(double), rankSender);
+}
+
+void SharedMemoryCommunication::receive(int &itemToReceive, Rank rankSender)
+{
+  PRECICE_TRACE(rankSender);
+  receiveBytes(&itemToReceive, sizeof(int), rankSender);
+}
+
+PtrRequest SharedMemoryCommunication::aReceive(int &itemToReceive, Rank rankSender)
+{
+  PRECICE_TRACE(rankSender);
+  return enqueueReceive(&itemToReceive, sizeof(int), rankSender);
+}
+
+void SharedMemoryCommunication::receive(bool &itemToReceive, Rank rankSender)
+{
+  PRECICE_TRACE(rankSender);
+  receiveBytes(&itemToReceive, sizeof(bool), rankSender);
+}
+
+PtrRequest SharedMemoryCommunication::aReceive(bool &itemToReceive, Rank rankSender)
+{
+  PRECICE_TRACE(rankSender);
+  return enqueueReceive(&itemToReceive, sizeof(bool), rankSender);
+}
+
+void SharedMemoryCommunication::prepareEstablishment(std::string const &acceptorName,
+                                                     std::string const &requesterName)
+{
+  using namespace std::filesystem;
+  path dir = com::impl::localDirectory(acceptorName, requesterName, _addressDirectory);
+  PRECICE_DEBUG("Creating connection exchange directory {}", dir.generic_string());
+  try {
+    create_directories(dir);
+  } catch (const std::filesystem::filesystem_error &e) {
+    PRECICE_WARN("Creating directory for connection info failed with filesystem error: {}", e.what());
+  }
+}
+
+void SharedMemoryCommunication::cleanupEstablishment(std::string const &acceptorName,
+                                                     std::string const &requesterName)
+{
+  using namespace std::filesystem;
+  path dir = com::impl::localDirectory(acceptorName, requesterName, _addressDirectory);
+  PRECICE_DEBUG("Removing connection exchange directory {}", dir.generic_string());
+  try {
+    remove_all(dir);
+  } catch (const std::filesystem::filesystem_error &e) {
+    PRECICE_WARN("Cleaning up connection info failed with filesystem error {}", e.what());
+  }
+}
+
+} // namespace precice::com
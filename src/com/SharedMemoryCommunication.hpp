@@ -0,0 +1,205 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+
+#include "com/Communication.hpp"
+#include "com/SharedPointer.hpp"
+#include "logging/Logger.hpp"
+#include "precice/impl/Types.hpp"
+
+namespace precice {
+namespace com {
+
+namespace impl {
+class SharedMemoryChannel;
+struct SharedMemoryReceiveQueue;
+class SharedMemorySendRequest;
+} // namespace impl
+
+/**
+ * @brief Implements Communication by using POSIX shared memory.
+ *
+ * Only works for ranks located on the same node. Every pair of connected ranks
+ * shares two single-producer single-consumer ring buffers, one per direction.
+ * The connection is established via a control segment, whose name is exchanged
+ * via the address directory, just like for SocketCommunication.
+ *
+ * Sends are copied into the ring buffer by a background thread, so asynchronous
+ * sends progress without further calls. Receives are progressed by the calling
+ * thread when waiting on or testing a request. Waiting uses futexes on Linux.
+ * Closing the connection waits until all pending sends are written.
+ */
+class SharedMemoryCommunication : public Communication {
+public:
+  /// The default capacity of every ring buffer in bytes
+  static constexpr std::size_t defaultBufferSize = std::size_t{1} << 20;
+
+  explicit SharedMemoryCommunication(std::string addressDirectory = ".",
+                                     std::size_t bufferSize       = defaultBufferSize);
+
+  virtual ~SharedMemoryCommunication();
+
+  virtual size_t getRemoteCommunicatorSize() override;
+
+  virtual void acceptConnection(std::string const &acceptorName,
+                                std::string const &requesterName,
+                                std::string const &tag,
+                                int                acceptorRank,
+                                int                rankOffset = 0) override;
+
+  virtual void acceptConnectionAsServer(std::string const &acceptorName,
+                                        std::string const &requesterName,
+                                        std::string const &tag,
+                                        int                acceptorRank,
+                                        int                requesterCommunicatorSize) override;
+
+  virtual void requestConnection(std::string const &acceptorName,
+                                 std::string const &requesterName,
+                                 std::string const &tag,
+                                 int                requesterRank,
+                                 int                requesterCommunicatorSize) override;
+
+  virtual void requestConnectionAsClient(std::string const &  acceptorName,
+                                         std::string const &  requesterName,
+                                         std::string const &  tag,
+                                         std::set<int> const &acceptorRanks,
+                                         int                  requesterRank) override;
+
+  virtual void closeConnection() override;
+
+  /// Sends a std::string to process with given rank.
+  virtual void send(std::string const &itemToSend, Rank rankReceiver) override;
+
+  /// Sends an array of integer values.
+  virtual void send(precice::span<const int> itemsToSend, Rank rankReceiver) override;
+
+  /// Asynchronously sends an array of integer values.
+  virtual PtrRequest aSend(precice::span<const int> itemsToSend, Rank rankReceiver) override;
+
+  /// Sends an array of double values.
+  virtual void send(precice::span<const double> itemsToSend, Rank rankReceiver) override;
+
+  /// Asynchronously sends an array of double values.
+  virtual PtrRequest aSend(precice::span<const double> itemsToSend, Rank rankReceiver) override;
+
+  /// Sends a double to process with given rank.
+  virtual void send(double itemToSend, Rank rankReceiver) override;
+
+  /// Asynchronously sends a double to process with given rank.
+  virtual PtrRequest aSend(const double &itemToSend, Rank rankReceiver) override;
+
+  /// Sends an int to process with given rank.
+  virtual void send(int itemToSend, Rank rankReceiver) override;
+
+  /// Asynchronously sends an int to process with given rank.
+  virtual PtrRequest aSend(const int &itemToSend, Rank rankReceiver) override;
+
+  /// Sends a bool to process with given rank.
+  virtual void send(bool itemToSend, Rank rankReceiver) override;
+
+  /// Asynchronously sends a bool to process with given rank.
+  virtual PtrRequest aSend(const bool &itemToSend, Rank rankReceiver) override;
+
+  /// Receives a std::string from process with given rank.
+  virtual void receive(std::string &itemToReceive, Rank rankSender) override;
+
+  /// Receives an array of integer values.
+  virtual void receive(precice::span<int> itemsToReceive, Rank rankSender) override;
+
+  /// Receives an array of double values.
+  virtual void receive(precice::span<double> itemsToReceive, Rank rankSender) override;
+
+  /// Asynchronously receives an array of double values.
+  virtual PtrRequest aReceive(precice::span<double> itemsToReceive,
+                              int                   rankSender) override;
+
+  /// Receives a double from process with given rank.
+  virtual void receive(double &itemToReceive, Rank rankSender) override;
+
+  /// Asynchronously receives a double from process with given rank.
+  virtual PtrRequest aReceive(double &itemToReceive, Rank rankSender) override;
+
+  /// Receives an int from process with given rank.
+  virtual void receive(int &itemToReceive, Rank rankSender) override;
+
+  /// Asynchronously receives an int from process with given rank.
+  virtual PtrRequest aReceive(int &itemToReceive, Rank rankSender) override;
+
+  /// Receives a bool from process with given rank.
+  virtual void receive(bool &itemToReceive, Rank rankSender) override;
+
+  /// Asynchronously receives a bool from process with given rank.
+  virtual PtrRequest aReceive(bool &itemToReceive, Rank rankSender) override;
+
+  virtual void prepareEstablishment(std::string const &acceptorName,
+                                    std::string const &requesterName) override;
+
+  virtual void cleanupEstablishment(std::string const &acceptorName,
+                                    std::string const &requesterName) override;
+
+private:
+  logging::Logger _log{"com::SharedMemoryCommunication"};
+
+  /// Directory where the name of the control segment is exchanged by file.
+  std::string _addressDirectory;
+
+  /// Capacity of every ring buffer in bytes
+  std::size_t _bufferSize;
+
+  /// The channels to and from a remote rank
+  struct Connection {
+    std::shared_ptr<impl::SharedMemoryChannel>      sendChannel;
+    std::shared_ptr<impl::SharedMemoryReceiveQueue> receiveQueue;
+  };
+
+  /// Remote rank -> channels
+  std::map<int, Connection> _connections;
+
+  /// An asynchronous send waiting for the background thread
+  struct SendItem {
+    std::shared_ptr<impl::SharedMemoryChannel>     channel;
+    const char *                                   data;
+    std::size_t                                    size;
+    std::shared_ptr<impl::SharedMemorySendRequest> request;
+  };
+
+  std::deque<SendItem>    _sendQueue;
+  std::mutex              _sendMutex;
+  std::condition_variable _sendCondition;
+  std::thread             _sendThread;
+
+  /// Is a send being written to a channel?
+  bool _sending = false;
+
+  /// Stops the send thread once all pending sends are written
+  bool _stopSending = false;
+
+  /// Creates the channels of a requester and announces them in the control segment of the acceptor
+  Connection connectToAcceptor(std::string const &prefix, int requesterRank, int requesterCommunicatorSize);
+
+  /// Opens the channels created by the given requester rank
+  Connection openRequesterChannels(std::string const &prefix, int requesterRank);
+
+  void startSendThread();
+
+  void processSendQueue();
+
+  PtrRequest enqueueSend(const void *data, std::size_t size, Rank rankReceiver);
+
+  void sendBytes(const void *data, std::size_t size, Rank rankReceiver);
+
+  PtrRequest enqueueReceive(void *data, std::size_t size, Rank rankSender);
+
+  void receiveBytes(void *data, std::size_t size, Rank rankSender);
+};
+
+} // namespace com
+} // namespace precice
@@ -0,0 +1,29 @@
+#include "SharedMemoryCommunicationFactory.hpp"
+#include <memory>
+#include <utility>
+
+#include "SharedMemoryCommunication.hpp"
+#include "com/SharedPointer.hpp"
+
+namespace precice::com {
+SharedMemoryCommunicationFactory::SharedMemoryCommunicationFactory(
+    std::string addressDirectory,
+    std::size_t bufferSize)
+    : _addressDirectory(std::move(addressDirectory)),
+      _bufferSize(bufferSize)
+{
+  if (_addressDirectory.empty()) {
+    _addressDirectory = ".";
+  }
+}
+
+PtrCommunication SharedMemoryCommunicationFactory::newCommunication()
+{
+  return std::make_shared<SharedMemoryCommunication>(_addressDirectory, _bufferSize);
+}
+
+std::string SharedMemoryCommunicationFactory::addressDirectory()
+{
+  return _addressDirectory;
+}
+} // namespace precice::com
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include "CommunicationFactory.hpp"
+#include "com/SharedMemoryCommunication.hpp"
+#include "com/SharedPointer.hpp"
+
+namespace precice {
+namespace com {
+class SharedMemoryCommunicationFactory : public CommunicationFactory {
+public:
+  explicit SharedMemoryCommunicationFactory(std::string addressDirectory = ".",
+                                            std::size_t bufferSize       = SharedMemoryCommunication::defaultBufferSize);
+
+  PtrCommunication newCommunication() override;
+
+  std::string addressDirectory() override;
+
+private:
+  std::string _addressDirectory;
+  std::size_t _bufferSize;
+};
+} // namespace com
+} // namespace precice
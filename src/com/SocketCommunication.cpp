@@ -1,9 +1,12 @@
 #include <algorithm>
+#include <atomic>
 #include <boost/asio.hpp>
 
 #include <filesystem>
 #include <sstream>
 #include <stdexcept>
+#include <system_error>
+#include <unistd.h>
 #include <utility>
 
 #include "ConnectionInfoPublisher.hpp"
@@ -19,14 +22,180 @@ namespace precice::com {
 
 namespace asio = boost::asio;
 
+namespace {
+
+using Socket = asio::generic::stream_protocol::socket;
+
+/// The address published by an acceptor, the Unix domain socket is optional
+struct PublishedAddress {
+  std::string ipAddress;
+  std::string port;
+  std::string hostName;
+  std::string localPath;
+};
+
+/// Formats as "ip:port" or "ip:port|host|path"
+std::string formatAddress(PublishedAddress const &address)
+{
+  std::string formatted = address.ipAddress + ":" + address.port;
+  if (not address.localPath.empty()) {
+    formatted += "|" + address.hostName + "|" + address.localPath;
+  }
+  return formatted;
+}
+
+PublishedAddress parseAddress(std::string const &address)
+{
+  PublishedAddress parsed;
+  auto const       tcpEnd = address.find('|');
+  auto const       tcp    = address.substr(0, tcpEnd);
+  auto const       sepidx = tcp.find(':');
+  parsed.ipAddress        = tcp.substr(0, sepidx);
+  parsed.port             = tcp.substr(sepidx + 1);
+  if (tcpEnd != std::string::npos) {
+    auto const hostEnd = address.find('|', tcpEnd + 1);
+    if (hostEnd != std::string::npos) {
+      parsed.hostName  = address.substr(tcpEnd + 1, hostEnd - tcpEnd - 1);
+      parsed.localPath = address.substr(hostEnd + 1);
+    }
+  }
+  return parsed;
+}
+
+} // namespace
+
+/**
+ * Listens for TCP connections and optionally on a Unix domain socket.
+ *
+ * Connections are accepted from whichever acceptor is ready first.
+ * The acceptors run on their own IO service to keep the one of the communication untouched.
+ */
+class impl::SocketListener {
+public:
+  SocketListener()
+      : _tcp(_waitService)
+#ifdef BOOST_ASIO_HAS_LOCAL_SOCKETS
+        ,
+        _local(_waitService)
+#endif
+  {
+  }
+
+  ~SocketListener()
+  {
+    close();
+  }
+
+  /// Listens on the given port and returns the port actually bound
+  unsigned short listenTCP(unsigned short port, bool reuseAddress)
+  {
+    using asio::ip::tcp;
+    tcp::endpoint endpoint(tcp::v4(), port);
+    _tcp.open(endpoint.protocol());
+    _tcp.set_option(tcp::acceptor::reuse_address(reuseAddress));
+    _tcp.bind(endpoint);
+    _tcp.listen();
+    return _tcp.local_endpoint().port();
+  }
+
+  /// Listens on a new Unix domain socket and returns its path, which is empty if these are not supported
+  std::string listenLocal()
+  {
+#ifdef BOOST_ASIO_HAS_LOCAL_SOCKETS
+    static std::atomic<int> counter{0};
+    auto const              path = std::filesystem::temp_directory_path() / ("precice-" + std::to_string(::getpid()) + "-" + std::to_string(counter++) + ".sock");
+    try {
+      std::filesystem::remove(path);
+      asio::local::stream_protocol::endpoint endpoint(path.string());
+      _local.open(endpoint.protocol());
+      _local.bind(endpoint);
+      _local.listen();
+      _localPath = path.string();
+    } catch (std::exception &) {
+      // For instance, the path may exceed the length limit. Requesters then use TCP.
+      boost::system::error_code ignored;
+      _local.close(ignored);
+    }
+#endif
+    return _localPath;
+  }
+
+  /// Blocks until a connection arrives at any acceptor and accepts it
+  void accept(Socket &socket)
+  {
+#ifdef BOOST_ASIO_HAS_LOCAL_SOCKETS
+    if (_local.is_open()) {
+      enum class Ready { None,
+                         TCP,
+                         Local };
+      Ready                     ready = Ready::None;
+      boost::system::error_code waitError;
+      auto                      onReady = [&ready, &waitError](Ready acceptor) {
+        return [&ready, &waitError, acceptor](boost::system::error_code const &error) {
+          if (error && error != asio::error::operation_aborted) {
+            waitError = error;
+          } else if (not error && ready == Ready::None) {
+            ready = acceptor;
+          }
+        };
+      };
+      _tcp.async_wait(asio::socket_base::wait_read, onReady(Ready::TCP));
+      _local.async_wait(asio::socket_base::wait_read, onReady(Ready::Local));
+
+      _waitService.restart();
+      while (ready == Ready::None && not waitError && _waitService.run_one() > 0) {
+      }
+      // Cancel the remaining wait and drain its handler
+      _tcp.cancel();
+      _local.cancel();
+      _waitService.run();
+
+      if (waitError) {
+        throw boost::system::system_error(waitError);
+      }
+      if (ready == Ready::Local) {
+        _local.accept(socket);
+        return;
+      }
+    }
+#endif
+    _tcp.accept(socket);
+  }
+
+  /// Stops listening and removes the Unix domain socket
+  void close()
+  {
+    boost::system::error_code ignored;
+    _tcp.close(ignored);
+#ifdef BOOST_ASIO_HAS_LOCAL_SOCKETS
+    _local.close(ignored);
+#endif
+    if (not _localPath.empty()) {
+      std::error_code ignoredRemove;
+      std::filesystem::remove(_localPath, ignoredRemove);
+      _localPath.clear();
+    }
+  }
+
+private:
+  asio::io_service        _waitService;
+  asio::ip::tcp::acceptor _tcp;
+#ifdef BOOST_ASIO_HAS_LOCAL_SOCKETS
+  asio::local::stream_protocol::acceptor _local;
+#endif
+  std::string _localPath;
+};
+
 SocketCommunication::SocketCommunication(unsigned short portNumber,
                                          bool           reuseAddress,
                                          std::string    networkName,
-                                         std::string    addressDirectory)
+                                         std::string    addressDirectory,
+                                         bool           useUnixDomainSockets)
     : _portNumber(portNumber),
       _reuseAddress(reuseAddress),
       _networkName(std::move(networkName)),
       _addressDirectory(std::move(addressDirectory)),
+      _useUnixDomainSockets(useUnixDomainSockets),
       _ioService(new IOService)
 {
   if (_addressDirectory.empty()) {
@@ -52,6 +221,12 @@ size_t SocketCommunication::getRemoteCommunicatorSize()
   return _sockets.size();
 }
 
+bool SocketCommunication::isUnixDomainConnection(Rank remoteRank) const
+{
+  PRECICE_ASSERT(_sockets.count(remoteRank) > 0, remoteRank);
+  return _sockets.at(remoteRank)->local_endpoint().protocol().family() == AF_UNIX;
+}
+
 void SocketCommunication::acceptConnection(std::string const &acceptorName,
                                            std::string const &requesterName,
                                            std::string const &tag,
@@ -67,21 +242,7 @@ void SocketCommunication::acceptConnection(std::string const &acceptorName,
   std::string address;
 
   try {
-    std::string ipAddress = getIpAddress();
-    PRECICE_CHECK(not ipAddress.empty(), "Network \"{}\" not found for socket connection!", _networkName);
-
-    using asio::ip::tcp;
-
-    tcp::acceptor acceptor(*_ioService);
-    tcp::endpoint endpoint(tcp::v4(), _portNumber);
-
-    acceptor.open(endpoint.protocol());
-    acceptor.set_option(tcp::acceptor::reuse_address(_reuseAddress));
-    acceptor.bind(endpoint);
-    acceptor.listen();
-
-    _portNumber = acceptor.local_endpoint().port();
-    address     = ipAddress + ":" + std::to_string(_portNumber);
+    address = listenAsServer();
     ConnectionInfoWriter conInfo(acceptorName, requesterName, tag, _addressDirectory);
     conInfo.write(address);
     PRECICE_DEBUG("Accept connection at {}", address);
@@ -93,7 +254,7 @@ void SocketCommunication::acceptConnection(std::string const &acceptorName,
     do {
       auto socket = std::make_shared<Socket>(*_ioService);
 
-      acceptor.accept(*socket);
+      _listener->accept(*socket);
       PRECICE_DEBUG("Accepted connection at {}", address);
       _isConnected = true;
 
@@ -123,7 +284,7 @@ void SocketCommunication::acceptConnection(std::string const &acceptorName,
                      "Current requester size from rank {} is {} but should be {}", requesterRank, requesterCommunicatorSize, peerCount);
     } while (++peerCurrent < requesterCommunicatorSize);
 
-    acceptor.close();
+    _listener.reset();
   } catch (std::exception &e) {
     PRECICE_ERROR("Accepting a socket connection at {} failed with the system error: {}", address, e.what());
   }
@@ -153,32 +314,21 @@ void SocketCommunication::acceptConnectionAsServer(std::string const &acceptorNa
   std::string address;
 
   try {
-    std::string ipAddress = getIpAddress();
-    PRECICE_ASSERT(not ipAddress.empty(), "Network \"{}\" not found for socket connection!", _networkName);
-
-    using asio::ip::tcp;
-
-    tcp::acceptor acceptor(*_ioService);
-    {
-      tcp::endpoint endpoint(tcp::v4(), _portNumber);
-
-      acceptor.open(endpoint.protocol());
-      acceptor.set_option(tcp::acceptor::reuse_address(_reuseAddress));
-      acceptor.bind(endpoint);
-      acceptor.listen();
-
-      _portNumber = acceptor.local_endpoint().port();
+    // Without an address table, the address is published via a connection file, which is removed after accepting
+    std::unique_ptr<ConnectionInfoWriter> conInfo;
+    if (_listener) {
+      address = _listenerAddress;
+    } else {
+      address = listenAsServer();
+      conInfo = std::make_unique<ConnectionInfoWriter>(acceptorName, requesterName, tag, acceptorRank, _addressDirectory);
+      conInfo->write(address);
     }
 
-    address = ipAddress + ":" + std::to_string(_portNumber);
-    ConnectionInfoWriter conInfo(acceptorName, requesterName, tag, acceptorRank, _addressDirectory);
-    conInfo.write(address);
-
     PRECICE_DEBUG("Accepting connection at {}", address);
 
     for (int connection = 0; connection < requesterCommunicatorSize; ++connection) {
       auto socket = std::make_shared<Socket>(*_ioService);
-      acceptor.accept(*socket);
+      _listener->accept(*socket);
       PRECICE_DEBUG("Accepted connection at {}", address);
       _isConnected = true;
 
@@ -187,7 +337,7 @@ void SocketCommunication::acceptConnectionAsServer(std::string const &acceptorNa
       _sockets[requesterRank] = std::move(socket);
     }
 
-    acceptor.close();
+    _listener.reset();
   } catch (std::exception &e) {
     PRECICE_ERROR("Accepting a socket connection at {} failed with the system error: {}", address, e.what());
   }
@@ -209,33 +359,10 @@ void SocketCommunication::requestConnection(std::string const &acceptorName,
   ConnectionInfoReader conInfo(acceptorName, requesterName, tag, _addressDirectory);
   std::string const    address = conInfo.read();
   PRECICE_DEBUG("Request connection to {}", address);
-  auto const        sepidx     = address.find(':');
-  std::string const ipAddress  = address.substr(0, sepidx);
-  std::string const portNumber = address.substr(sepidx + 1);
-  _portNumber                  = static_cast<unsigned short>(std::stoul(portNumber));
 
   try {
-    auto socket = std::make_shared<Socket>(*_ioService);
-
-    using asio::ip::tcp;
-
-    tcp::resolver::query query(tcp::v4(), ipAddress, portNumber, tcp::resolver::query::numeric_host);
-
-    while (not isConnected()) {
-      tcp::resolver                resolver(*_ioService);
-      tcp::resolver::endpoint_type endpoint = *(resolver.resolve(query));
-      boost::system::error_code    error    = asio::error::host_not_found;
-      socket->connect(endpoint, error);
-
-      _isConnected = not error;
-
-      if (not isConnected()) {
-        // Wait a little, since after a couple of ten-thousand trials the system
-        // seems to get confused and the requester connects wrongly to itself.
-        boost::asio::deadline_timer timer(*_ioService, boost::posix_time::milliseconds(1));
-        timer.wait();
-      }
-    }
+    auto socket  = connectTo(address);
+    _isConnected = true;
 
     PRECICE_DEBUG("Requested connection to {}", address);
 
@@ -266,39 +393,56 @@ void SocketCommunication::requestConnectionAsClient(std::string const &  accepto
   PRECICE_TRACE(acceptorName, requesterName, acceptorRanks, requesterRank);
   PRECICE_ASSERT(not isConnected());
 
+  std::map<int, std::string> acceptorAddresses;
   for (auto const &acceptorRank : acceptorRanks) {
-    _isConnected = false;
     ConnectionInfoReader conInfo(acceptorName, requesterName, tag, acceptorRank, _addressDirectory);
-    std::string const    address    = conInfo.read();
-    auto const           sepidx     = address.find(':');
-    std::string const    ipAddress  = address.substr(0, sepidx);
-    std::string const    portNumber = address.substr(sepidx + 1);
-    _portNumber                     = static_cast<unsigned short>(std::stoul(portNumber));
+    acceptorAddresses.emplace(acceptorRank, conInfo.read());
+  }
+  connectAsClient(acceptorAddresses, requesterRank);
+}
 
-    try {
-      auto socket = std::make_shared<Socket>(*_ioService);
+std::string SocketCommunication::listenAsServer()
+{
+  PRECICE_TRACE();
+  PRECICE_ASSERT(not _listener, "The communication is already listening.");
+
+  try {
+    std::string ipAddress = getIpAddress();
+    PRECICE_CHECK(not ipAddress.empty(), "Network \"{}\" not found for socket connection!", _networkName);
 
-      using asio::ip::tcp;
+    _listener   = std::make_unique<impl::SocketListener>();
+    _portNumber = _listener->listenTCP(_portNumber, _reuseAddress);
 
-      PRECICE_DEBUG("Requesting connection to {}, port {}", ipAddress, portNumber);
+    PublishedAddress published{ipAddress, std::to_string(_portNumber)};
+    if (_useUnixDomainSockets) {
+      published.hostName  = asio::ip::host_name();
+      published.localPath = _listener->listenLocal();
+      if (published.localPath.empty()) {
+        PRECICE_DEBUG("Unix domain sockets are not available, accepting only TCP connections");
+      }
+    }
+    _listenerAddress = formatAddress(published);
+  } catch (std::exception &e) {
+    PRECICE_ERROR("Listening for socket connections on port {} failed with the system error: {}", _portNumber, e.what());
+  }
+  PRECICE_DEBUG("Listening at {}", _listenerAddress);
+  return _listenerAddress;
+}
 
-      tcp::resolver::query query(tcp::v4(), ipAddress, portNumber, tcp::resolver::query::numeric_host);
+void SocketCommunication::connectAsClient(std::map<int, std::string> const &acceptorAddresses,
+                                          int                               requesterRank)
+{
+  PRECICE_TRACE(requesterRank);
+  PRECICE_ASSERT(not isConnected());
 
-      while (not isConnected()) {
-        tcp::resolver             resolver(*_ioService);
-        tcp::resolver::iterator   endpoint_iterator = resolver.resolve(query);
-        boost::system::error_code error             = asio::error::host_not_found;
-        boost::asio::connect(*socket, std::move(endpoint_iterator), error);
+  for (auto const &[acceptorRank, address] : acceptorAddresses) {
+    _isConnected = false;
 
-        _isConnected = not error;
+    try {
+      PRECICE_DEBUG("Requesting connection to {}", address);
 
-        if (not isConnected()) {
-          // Wait a little, since after a couple of ten-thousand trials the system
-          // seems to get confused and the requester connects wrongly to itself.
-          boost::asio::deadline_timer timer(*_ioService, boost::posix_time::milliseconds(1));
-          timer.wait();
-        }
-      }
+      auto socket  = connectTo(address);
+      _isConnected = true;
 
       PRECICE_DEBUG("Requested connection to {}, rank = {}", address, acceptorRank);
       _sockets[acceptorRank] = std::move(socket);
@@ -313,10 +457,53 @@ void SocketCommunication::requestConnectionAsClient(std::string const &  accepto
   _thread = std::thread([this] { _ioService->run(); });
 }
 
+std::shared_ptr<SocketCommunication::Socket> SocketCommunication::connectTo(std::string const &address)
+{
+  PRECICE_TRACE(address);
+  auto const published = parseAddress(address);
+  auto       socket    = std::make_shared<Socket>(*_ioService);
+
+#ifdef BOOST_ASIO_HAS_LOCAL_SOCKETS
+  if (not published.localPath.empty() && published.hostName == asio::ip::host_name()) {
+    boost::system::error_code error;
+    socket->connect(asio::local::stream_protocol::endpoint(published.localPath), error);
+    if (not error) {
+      PRECICE_DEBUG("Connected via Unix domain socket {}", published.localPath);
+      return socket;
+    }
+    PRECICE_DEBUG("Connecting via Unix domain socket {} failed with \"{}\", falling back to TCP", published.localPath, error.message());
+    socket->close(error);
+  }
+#endif
+
+  _portNumber = static_cast<unsigned short>(std::stoul(published.port));
+
+  using asio::ip::tcp;
+  tcp::resolver::query query(tcp::v4(), published.ipAddress, published.port, tcp::resolver::query::numeric_host);
+
+  while (true) {
+    tcp::resolver                resolver(*_ioService);
+    tcp::resolver::endpoint_type endpoint = *(resolver.resolve(query));
+    boost::system::error_code    error    = asio::error::host_not_found;
+    socket->connect(endpoint, error);
+
+    if (not error) {
+      return socket;
+    }
+
+    // Wait a little, since after a couple of ten-thousand trials the system
+    // seems to get confused and the requester connects wrongly to itself.
+    boost::asio::deadline_timer timer(*_ioService, boost::posix_time::milliseconds(1));
+    timer.wait();
+  }
+}
+
 void SocketCommunication::closeConnection()
 {
   PRECICE_TRACE();
 
+  _listener.reset();
+
   if (not isConnected())
     return;
 
@@ -17,13 +17,26 @@
 
 namespace precice {
 namespace com {
-/// Implements Communication by using sockets.
+
+namespace impl {
+class SocketListener;
+} // namespace impl
+
+/**
+ * @brief Implements Communication by using sockets.
+ *
+ * Connections use TCP by default. If Unix domain sockets are enabled, the acceptor
+ * additionally listens on a Unix domain socket and publishes its path together with
+ * its host name. Requesters on the same host connect via this socket, all other
+ * requesters fall back to TCP. Hence, a single communication can mix both transports.
+ */
 class SocketCommunication : public Communication {
 public:
-  SocketCommunication(unsigned short portNumber       = 0,
-                      bool           reuseAddress     = false,
-                      std::string    networkName      = utils::networking::loopbackInterfaceName(),
-                      std::string    addressDirectory = ".");
+  SocketCommunication(unsigned short portNumber           = 0,
+                      bool           reuseAddress         = false,
+                      std::string    networkName          = utils::networking::loopbackInterfaceName(),
+                      std::string    addressDirectory     = ".",
+                      bool           useUnixDomainSockets = false);
 
   explicit SocketCommunication(std::string const &addressDirectory);
 
@@ -31,6 +44,9 @@ public:
 
   virtual size_t getRemoteCommunicatorSize() override;
 
+  /// Is the connection to the given remote rank a Unix domain socket instead of TCP?
+  bool isUnixDomainConnection(Rank remoteRank) const;
+
   virtual void acceptConnection(std::string const &acceptorName,
                                 std::string const &requesterName,
                                 std::string const &tag,
@@ -55,6 +71,16 @@ public:
                                          std::set<int> const &acceptorRanks,
                                          int                  requesterRank) override;
 
+  virtual bool supportsAddressTable() const override
+  {
+    return true;
+  }
+
+  virtual std::string listenAsServer() override;
+
+  virtual void connectAsClient(std::map<int, std::string> const &acceptorAddresses,
+                               int                               requesterRank) override;
+
   virtual void closeConnection() override;
 
   /// Sends a std::string to process with given rank.
@@ -141,8 +167,11 @@ private:
   /// Directory where IP address is exchanged by file.
   std::string _addressDirectory;
 
+  /// Connect requesters on the same host via Unix domain sockets?
+  bool _useUnixDomainSockets;
+
   using IOService = boost::asio::io_service;
-  using Socket    = boost::asio::ip::tcp::socket;
+  using Socket    = boost::asio::generic::stream_protocol::socket;
   using Work      = boost::asio::io_service::work;
 
   std::shared_ptr<IOService> _ioService;
@@ -152,12 +181,21 @@ private:
   /// Remote rank -> socket map
   std::map<int, std::shared_ptr<Socket>> _sockets;
 
+  /// Listens for connections between listenAsServer() and the end of accepting
+  std::unique_ptr<impl::SocketListener> _listener;
+
+  /// The published address of the listener
+  std::string _listenerAddress;
+
   SocketSendQueue _queue;
 
   bool isClient();
   bool isServer();
 
   std::string getIpAddress();
+
+  /// Connects to a published address, preferring a Unix domain socket on the same host
+  std::shared_ptr<Socket> connectTo(std::string const &address);
 };
 } // namespace com
 } // namespace precice
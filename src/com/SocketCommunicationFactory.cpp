@@ -11,11 +11,13 @@ SocketCommunicationFactory::SocketCommunicationFactory(
     unsigned short portNumber,
     bool           reuseAddress,
     std::string    networkName,
-    std::string    addressDirectory)
+    std::string    addressDirectory,
+    bool           useUnixDomainSockets)
     : _portNumber(portNumber),
       _reuseAddress(reuseAddress),
       _networkName(std::move(networkName)),
-      _addressDirectory(std::move(addressDirectory))
+      _addressDirectory(std::move(addressDirectory)),
+      _useUnixDomainSockets(useUnixDomainSockets)
 {
   if (_addressDirectory.empty()) {
     _addressDirectory = ".";
@@ -31,7 +33,7 @@ SocketCommunicationFactory::SocketCommunicationFactory(
 PtrCommunication SocketCommunicationFactory::newCommunication()
 {
   return std::make_shared<SocketCommunication>(
-      _portNumber, _reuseAddress, _networkName, _addressDirectory);
+      _portNumber, _reuseAddress, _networkName, _addressDirectory, _useUnixDomainSockets);
 }
 
 std::string SocketCommunicationFactory::addressDirectory()
@@ -10,10 +10,11 @@ namespace precice {
 namespace com {
 class SocketCommunicationFactory : public CommunicationFactory {
 public:
-  SocketCommunicationFactory(unsigned short portNumber       = 0,
-                             bool           reuseAddress     = false,
-                             std::string    networkName      = utils::networking::loopbackInterfaceName(),
-                             std::string    addressDirectory = ".");
+  SocketCommunicationFactory(unsigned short portNumber           = 0,
+                             bool           reuseAddress         = false,
+                             std::string    networkName          = utils::networking::loopbackInterfaceName(),
+                             std::string    addressDirectory     = ".",
+                             bool           useUnixDomainSockets = false);
 
   explicit SocketCommunicationFactory(std::string const &addressDirectory);
 
@@ -26,6 +27,7 @@ private:
   bool           _reuseAddress;
   std::string    _networkName;
   std::string    _addressDirectory;
+  bool           _useUnixDomainSockets;
 };
 } // namespace com
 } // namespace precice
@@ -15,7 +15,7 @@ namespace com {
 /// It ensures that the invocations of asio::aSend are done serially.
 class SocketSendQueue {
 public:
-  using Socket = boost::asio::ip::tcp::socket;
+  using Socket = boost::asio::generic::stream_protocol::socket;
 
   SocketSendQueue() = default;
   ~SocketSendQueue();
@@ -2,6 +2,8 @@
 
 #include <Eigen/Core>
 #include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <memory>
 #include "com/Extra.hpp"
 #include "com/SharedPointer.hpp"
@@ -97,6 +99,68 @@ BOOST_AUTO_TEST_CASE(VertexEdgeTriangleMesh)
   }
 }
 
+BOOST_AUTO_TEST_CASE(CompressedVertexEdgeTriangleMesh)
+{
+  PRECICE_TEST("A"_on(1_rank), "B"_on(1_rank), Require::Events);
+  auto m2n = context.connectPrimaryRanks("A", "B");
+
+  int             dim = 3;
+  mesh::Mesh      sendMesh("Sent Mesh", dim, testing::nextMeshID());
+  mesh::Vertex &  v0 = sendMesh.createVertex(Eigen::VectorXd::Constant(dim, 0));
+  mesh::Vertex &  v1 = sendMesh.createVertex(Eigen::VectorXd::Constant(dim, 1));
+  mesh::Vertex &  v2 = sendMesh.createVertex(Eigen::VectorXd::Constant(dim, 2));
+  mesh::Edge &    e0 = sendMesh.createEdge(v0, v1);
+  mesh::Edge &    e1 = sendMesh.createEdge(v1, v2);
+  mesh::Edge &    e2 = sendMesh.createEdge(v2, v0);
+  mesh::Triangle &t0 = sendMesh.createTriangle(e0, e1, e2);
+  // coordinates without common bytes have to be restored exactly
+  mesh::Vertex &v3 = sendMesh.createVertex(Eigen::Vector3d{0.1, -1e-300, 3.0e200});
+  mesh::Vertex &v4 = sendMesh.createVertex(Eigen::Vector3d{-0.0, 0.1 + 1e-16, 2.0 / 3.0});
+  // global indices with large and negative differences
+  v0.setGlobalIndex(1000000);
+  v1.setGlobalIndex(7);
+  v2.setGlobalIndex(8);
+
+  auto &comm = *m2n->getPrimaryRankCommunication();
+
+  if (context.isNamed("A")) {
+    com::sendMesh(comm, 0, sendMesh, true);
+    sendMesh.edges().clear();
+    sendMesh.triangles().clear();
+    com::sendMesh(comm, 0, sendMesh, true);
+  } else {
+    mesh::Mesh recvMesh("Received Mesh", dim, testing::nextMeshID());
+    com::receiveMesh(comm, 0, recvMesh);
+    BOOST_TEST(recvMesh.nVertices() == 5);
+    BOOST_TEST(recvMesh.vertex(0) == v0);
+    BOOST_TEST(recvMesh.vertex(1) == v1);
+    BOOST_TEST(recvMesh.vertex(2) == v2);
+    for (int i = 3; i < 5; ++i) {
+      const auto &sent     = sendMesh.vertex(i).rawCoords();
+      const auto &received = recvMesh.vertex(i).rawCoords();
+      BOOST_TEST(std::memcmp(sent.data(), received.data(), sizeof(double) * dim) == 0);
+    }
+    BOOST_TEST(std::signbit(recvMesh.vertex(4).coord(0)));
+    BOOST_TEST(recvMesh.vertex(0).getGlobalIndex() == 1000000);
+    BOOST_TEST(recvMesh.vertex(1).getGlobalIndex() == 7);
+    BOOST_TEST(recvMesh.vertex(2).getGlobalIndex() == 8);
+    BOOST_TEST(recvMesh.edges().at(0) == e0);
+    BOOST_TEST(recvMesh.edges().at(1) == e1);
+    BOOST_TEST(recvMesh.edges().at(2) == e2);
+    BOOST_TEST(recvMesh.triangles().at(0) == t0);
+
+    // without connectivity, only the global indices are encoded
+    mesh::Mesh recvVertices("Received Vertices", dim, testing::nextMeshID());
+    com::receiveMesh(comm, 0, recvVertices);
+    BOOST_TEST(recvVertices.nVertices() == 5);
+    BOOST_TEST(recvVertices.edges().empty());
+    BOOST_TEST(recvVertices.vertex(0).getGlobalIndex() == 1000000);
+    BOOST_TEST(recvVertices.vertex(2).getGlobalIndex() == 8);
+    BOOST_TEST(recvVertices.vertex(3) == v3);
+    BOOST_TEST(recvVertices.vertex(4) == v4);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(BroadcastVertexEdgeTriangleMesh)
 {
   PRECICE_TEST(""_on(2_ranks).setupIntraComm(), Require::Events);
@@ -133,6 +197,38 @@ BOOST_AUTO_TEST_CASE(BroadcastVertexEdgeTriangleMesh)
   }
 }
 
+BOOST_AUTO_TEST_CASE(BroadcastCompressedMesh)
+{
+  PRECICE_TEST(""_on(2_ranks).setupIntraComm(), Require::Events);
+
+  int             dim = 2;
+  mesh::Mesh      sendMesh("Sent Mesh", dim, testing::nextMeshID());
+  mesh::Vertex &  v0 = sendMesh.createVertex(Eigen::Vector2d{0.0, 0.25});
+  mesh::Vertex &  v1 = sendMesh.createVertex(Eigen::Vector2d{0.1, 0.25});
+  mesh::Vertex &  v2 = sendMesh.createVertex(Eigen::Vector2d{0.2, -1e10});
+  mesh::Edge &    e0 = sendMesh.createEdge(v0, v1);
+  mesh::Edge &    e1 = sendMesh.createEdge(v1, v2);
+  mesh::Edge &    e2 = sendMesh.createEdge(v2, v0);
+  mesh::Triangle &t0 = sendMesh.createTriangle(e0, e1, e2);
+
+  auto &comm = *precice::utils::IntraComm::getCommunication();
+
+  if (context.isPrimary()) {
+    com::broadcastSendMesh(comm, sendMesh, true);
+  } else {
+    mesh::Mesh recvMesh("Received Mesh", dim, testing::nextMeshID());
+    com::broadcastReceiveMesh(comm, recvMesh);
+    BOOST_TEST(recvMesh.nVertices() == 3);
+    BOOST_TEST(recvMesh.vertex(0) == v0);
+    BOOST_TEST(recvMesh.vertex(1) == v1);
+    BOOST_TEST(recvMesh.vertex(2) == v2);
+    BOOST_TEST(recvMesh.edges().at(0) == e0);
+    BOOST_TEST(recvMesh.edges().at(1) == e1);
+    BOOST_TEST(recvMesh.edges().at(2) == e2);
+    BOOST_TEST(recvMesh.triangles().at(0) == t0);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(OneTetraCommunication)
 {
   PRECICE_TEST("A"_on(1_rank), "B"_on(1_rank), Require::Events);
@@ -787,6 +787,64 @@ void TestReduceVectors(TestContext const &context)
   }
 }
 
+template <typename T>
+void TestAllgather(TestContext const &context)
+{
+  T com;
+
+  if (context.isPrimary()) {
+    com.acceptConnection("Primary", "Secondary", "", 0, 1);
+    {
+      std::vector<int> rcv;
+      com.allgather(3, rcv);
+      BOOST_TEST(rcv == std::vector<int>({3, 5}), boost::test_tools::per_element());
+    }
+    com.closeConnection();
+  } else {
+    com.requestConnection("Primary", "Secondary", "", 0, 1);
+    {
+      std::vector<int> rcv;
+      com.allgather(5, rcv, 0);
+      BOOST_TEST(rcv == std::vector<int>({3, 5}), boost::test_tools::per_element());
+    }
+    com.closeConnection();
+  }
+}
+
+template <typename T>
+void TestGather(TestContext const &context)
+{
+  T com;
+
+  if (context.isPrimary()) {
+    com.acceptConnection("Primary", "Secondary", "", 0, 1);
+    {
+      std::vector<int> snd{1, 2, 3};
+      std::vector<int> rcv, counts;
+      com.gather(snd, rcv, counts);
+      BOOST_TEST(counts == std::vector<int>({3, 2}), boost::test_tools::per_element());
+      BOOST_TEST(rcv == std::vector<int>({1, 2, 3, 5, 6}), boost::test_tools::per_element());
+    }
+    {
+      std::vector<int> rcv, counts;
+      com.gather(precice::span<const int>{}, rcv, counts);
+      BOOST_TEST(counts == std::vector<int>({0, 0}), boost::test_tools::per_element());
+      BOOST_TEST(rcv.empty());
+    }
+    com.closeConnection();
+  } else {
+    com.requestConnection("Primary", "Secondary", "", 0, 1);
+    {
+      std::vector<int> snd{5, 6};
+      com.gather(snd, 0);
+    }
+    {
+      com.gather(precice::span<const int>{}, 0);
+    }
+    com.closeConnection();
+  }
+}
+
 } // namespace intracomm
 
 namespace serverclient {
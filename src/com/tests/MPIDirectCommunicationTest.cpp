@@ -57,6 +57,20 @@ BOOST_AUTO_TEST_CASE(ReduceEigen)
   TestReduceVectors<MPIDirectCommunication>(context);
 }
 
+BOOST_AUTO_TEST_CASE(Allgather)
+{
+  PRECICE_TEST(2_ranks, Require::Events);
+  using namespace precice::testing::com::intracomm;
+  TestAllgather<MPIDirectCommunication>(context);
+}
+
+BOOST_AUTO_TEST_CASE(Gather)
+{
+  PRECICE_TEST(2_ranks, Require::Events);
+  using namespace precice::testing::com::intracomm;
+  TestGather<MPIDirectCommunication>(context);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Intra
 
 BOOST_AUTO_TEST_SUITE_END() // MPIDirect
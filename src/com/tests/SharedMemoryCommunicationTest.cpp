@@ -0,0 +1,271 @@
+#include <chrono>
+#include <numeric>
+#include <vector>
+#include "GenericTestFunctions.hpp"
+#include "com/SharedMemoryCommunication.hpp"
+#include "com/SharedPointer.hpp"
+#include "com/SocketCommunication.hpp"
+#include "math/constants.hpp"
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice;
+using namespace precice::com;
+
+BOOST_TEST_SPECIALIZED_COLLECTION_COMPARE(std::vector<int>)
+
+BOOST_AUTO_TEST_SUITE(CommunicationTests)
+
+BOOST_AUTO_TEST_SUITE(SharedMemory)
+
+BOOST_AUTO_TEST_SUITE(Intra)
+
+BOOST_AUTO_TEST_CASE(SendReceivePrimitives)
+{
+  PRECICE_TEST(2_ranks, Require::Events);
+  using namespace precice::testing::com::intracomm;
+  TestSendAndReceivePrimitiveTypes<SharedMemoryCommunication>(context);
+}
+
+BOOST_AUTO_TEST_CASE(SendReceiveRanges)
+{
+  PRECICE_TEST(2_ranks, Require::Events);
+  using namespace precice::testing::com::intracomm;
+  TestSendAndReceiveRanges<SharedMemoryCommunication>(context);
+}
+
+BOOST_AUTO_TEST_CASE(SendReceiveEigen)
+{
+  PRECICE_TEST(2_ranks, Require::Events);
+  using namespace precice::testing::com::intracomm;
+  TestSendAndReceiveEigen<SharedMemoryCommunication>(context);
+}
+
+BOOST_AUTO_TEST_CASE(BroadcastPrimitives)
+{
+  PRECICE_TEST(2_ranks, Require::Events);
+  using namespace precice::testing::com::intracomm;
+  TestBroadcastPrimitiveTypes<SharedMemoryCommunication>(context);
+}
+
+BOOST_AUTO_TEST_CASE(BroadcastVectors)
+{
+  PRECICE_TEST(2_ranks, Require::Events);
+  using namespace precice::testing::com::intracomm;
+  TestBroadcastVectors<SharedMemoryCommunication>(context);
+}
+
+BOOST_AUTO_TEST_CASE(ReducePrimitives)
+{
+  PRECICE_TEST(2_ranks, Require::Events);
+  using namespace precice::testing::com::intracomm;
+  TestReducePrimitiveTypes<SharedMemoryCommunication>(context);
+}
+
+BOOST_AUTO_TEST_CASE(ReduceVectors)
+{
+  PRECICE_TEST(2_ranks, Require::Events);
+  using namespace precice::testing::com::intracomm;
+  TestReduceVectors<SharedMemoryCommunication>(context);
+}
+
+BOOST_AUTO_TEST_CASE(Allgather)
+{
+  PRECICE_TEST(2_ranks, Require::Events);
+  using namespace precice::testing::com::intracomm;
+  TestAllgather<SharedMemoryCommunication>(context);
+}
+
+BOOST_AUTO_TEST_CASE(Gather)
+{
+  PRECICE_TEST(2_ranks, Require::Events);
+  using namespace precice::testing::com::intracomm;
+  TestGather<SharedMemoryCommunication>(context);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Intra
+
+BOOST_AUTO_TEST_SUITE(Inter)
+
+BOOST_AUTO_TEST_CASE(SendReceivePrimitives)
+{
+  PRECICE_TEST("A"_on(1_rank), "B"_on(1_rank), Require::Events);
+  using namespace precice::testing::com::primaryprimary;
+  TestSendAndReceivePrimitiveTypes<SharedMemoryCommunication>(context);
+}
+
+BOOST_AUTO_TEST_CASE(SendReceiveEigen)
+{
+  PRECICE_TEST("A"_on(1_rank), "B"_on(1_rank), Require::Events);
+  using namespace precice::testing::com::primaryprimary;
+  TestSendAndReceiveEigen<SharedMemoryCommunication>(context);
+}
+
+BOOST_AUTO_TEST_CASE(SendReceiveRanges)
+{
+  PRECICE_TEST("A"_on(1_rank), "B"_on(1_rank), Require::Events);
+  using namespace precice::testing::com::primaryprimary;
+  TestSendAndReceiveRanges<SharedMemoryCommunication>(context);
+}
+
+BOOST_AUTO_TEST_CASE(BroadcastPrimitives)
+{
+  PRECICE_TEST("A"_on(1_rank), "B"_on(1_rank), Require::Events);
+  using namespace precice::testing::com::primaryprimary;
+  TestBroadcastPrimitiveTypes<SharedMemoryCommunication>(context);
+}
+
+BOOST_AUTO_TEST_CASE(BroadcastVectors)
+{
+  PRECICE_TEST("A"_on(1_rank), "B"_on(1_rank), Require::Events);
+  using namespace precice::testing::com::primaryprimary;
+  TestBroadcastVectors<SharedMemoryCommunication>(context);
+}
+
+BOOST_AUTO_TEST_CASE(ReducePrimitives)
+{
+  PRECICE_TEST("A"_on(1_rank), "B"_on(1_rank), Require::Events);
+  using namespace precice::testing::com::primaryprimary;
+  TestReducePrimitiveTypes<SharedMemoryCommunication>(context);
+}
+
+BOOST_AUTO_TEST_CASE(ReduceVectors)
+{
+  PRECICE_TEST("A"_on(1_rank), "B"_on(1_rank), Require::Events);
+  using namespace precice::testing::com::primaryprimary;
+  TestReduceVectors<SharedMemoryCommunication>(context);
+}
+
+BOOST_AUTO_TEST_CASE(SendReceiveFourProcesses)
+{
+  PRECICE_TEST("A"_on(2_ranks), "B"_on(2_ranks), Require::Events);
+  using namespace precice::testing::com::primaryprimary;
+  TestSendReceiveFourProcesses<SharedMemoryCommunication>(context);
+}
+
+BOOST_AUTO_TEST_CASE(SendReceiveBeyondBufferSize)
+{
+  PRECICE_TEST("A"_on(1_rank), "B"_on(1_rank), Require::Events);
+  // The messages exceed the ring buffers, so they are transferred in parts
+  SharedMemoryCommunication com(".", 64);
+  std::vector<double>       data(1000);
+  std::iota(data.begin(), data.end(), 0.0);
+
+  if (context.isNamed("A")) {
+    com.acceptConnection("A", "B", "", 0);
+    auto request = com.aSend(data, 0);
+    com.send(data, 0);
+    std::vector<double> received(data.size());
+    com.receive(received, 0);
+    request->wait();
+    BOOST_TEST(received == data);
+  } else {
+    com.requestConnection("A", "B", "", 0, 1);
+    std::vector<double> first(data.size()), second(data.size());
+    auto                request = com.aReceive(first, 0);
+    com.receive(second, 0);
+    BOOST_TEST(request->test());
+    com.send(data, 0);
+    BOOST_TEST(first == data);
+    BOOST_TEST(second == data);
+  }
+  com.closeConnection();
+}
+
+BOOST_AUTO_TEST_CASE(CloseConnectionWithPendingSends)
+{
+  PRECICE_TEST("A"_on(1_rank), "B"_on(1_rank), Require::Events);
+  // The message exceeds the ring buffer, so closing has to wait for the receiver
+  SharedMemoryCommunication com(".", 64);
+  std::vector<double>       data(1000);
+  std::iota(data.begin(), data.end(), 0.0);
+
+  if (context.isNamed("A")) {
+    com.acceptConnection("A", "B", "", 0);
+    auto request = com.aSend(data, 0);
+    com.closeConnection();
+    BOOST_TEST(request->test());
+  } else {
+    com.requestConnection("A", "B", "", 0, 1);
+    std::vector<double> received(data.size());
+    com.receive(received, 0);
+    BOOST_TEST(received == data);
+    com.closeConnection();
+  }
+}
+
+/// Ping-pong of messages of increasing size, compared to sockets on the loopback interface
+BOOST_AUTO_TEST_CASE(PingPongBenchmark)
+{
+  PRECICE_TEST("A"_on(1_rank), "B"_on(1_rank), Require::Events);
+
+  auto pingPong = [&context](Communication &com, std::size_t size, int repetitions) {
+    std::vector<double> message(size, 1.0);
+    using Clock      = std::chrono::steady_clock;
+    const auto start = Clock::now();
+    for (int i = 0; i < repetitions; ++i) {
+      if (context.isNamed("A")) {
+        com.send(message, 0);
+        com.receive(message, 0);
+      } else {
+        com.receive(message, 0);
+        com.send(message, 0);
+      }
+    }
+    const std::chrono::duration<double, std::micro> duration = Clock::now() - start;
+    BOOST_TEST(message.back() == 1.0);
+    return duration.count() / repetitions;
+  };
+
+  SharedMemoryCommunication sharedMemory;
+  SocketCommunication       sockets;
+  if (context.isNamed("A")) {
+    sharedMemory.acceptConnection("A", "B", "shm", 0);
+    sockets.acceptConnection("A", "B", "sockets", 0);
+  } else {
+    sharedMemory.requestConnection("A", "B", "shm", 0, 1);
+    sockets.requestConnection("A", "B", "sockets", 0, 1);
+  }
+
+  for (std::size_t size : {1, 1024, 1024 * 1024}) {
+    const int    repetitions  = size > 1024 ? 10 : 1000;
+    const double shmTime      = pingPong(sharedMemory, size, repetitions);
+    const double socketsTime  = pingPong(sockets, size, repetitions);
+    const double megaBytes    = 2.0 * size * sizeof(double) / 1e6;
+    BOOST_TEST_MESSAGE("Round trip of " << size << " doubles: shared memory " << shmTime << "us (" << megaBytes / shmTime * 1e6 << "MB/s), "
+                                        << "sockets " << socketsTime << "us (" << megaBytes / socketsTime * 1e6 << "MB/s)");
+  }
+
+  sharedMemory.closeConnection();
+  sockets.closeConnection();
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Inter
+
+BOOST_AUTO_TEST_SUITE(Server)
+
+BOOST_AUTO_TEST_CASE(SendReceiveTwo)
+{
+  PRECICE_TEST("A"_on(1_rank), "B"_on(1_rank), Require::Events);
+  using namespace precice::testing::com::serverclient;
+  TestSendReceiveTwoProcessesServerClient<SharedMemoryCommunication>(context);
+}
+
+BOOST_AUTO_TEST_CASE(SendReceiveFour)
+{
+  PRECICE_TEST("A"_on(2_ranks), "B"_on(2_ranks), Require::Events);
+  using namespace precice::testing::com::serverclient;
+  TestSendReceiveFourProcessesServerClient<SharedMemoryCommunication>(context);
+}
+
+BOOST_AUTO_TEST_CASE(SendReceiveFourV2)
+{
+  PRECICE_TEST("A"_on(2_ranks), "B"_on(2_ranks), Require::Events);
+  using namespace precice::testing::com::serverclient;
+  TestSendReceiveFourProcessesServerClientV2<SharedMemoryCommunication>(context);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Server
+
+BOOST_AUTO_TEST_SUITE_END() // SharedMemory
+BOOST_AUTO_TEST_SUITE_END() // Communication
@@ -1,3 +1,4 @@
+#include <chrono>
 #include <vector>
 #include "GenericTestFunctions.hpp"
 #include "com/SharedPointer.hpp"
@@ -11,6 +12,16 @@ using namespace precice::com;
 
 BOOST_TEST_SPECIALIZED_COLLECTION_COMPARE(std::vector<int>)
 
+namespace {
+/// Connects ranks on the same host via Unix domain sockets
+struct UnixDomainSocketCommunication : SocketCommunication {
+  UnixDomainSocketCommunication()
+      : SocketCommunication(0, false, utils::networking::loopbackInterfaceName(), ".", true)
+  {
+  }
+};
+} // namespace
+
 BOOST_AUTO_TEST_SUITE(CommunicationTests)
 
 BOOST_AUTO_TEST_SUITE(Socket)
@@ -66,6 +77,20 @@ BOOST_AUTO_TEST_CASE(ReduceVectors)
   TestReduceVectors<SocketCommunication>(context);
 }
 
+BOOST_AUTO_TEST_CASE(Allgather)
+{
+  PRECICE_TEST(2_ranks, Require::Events);
+  using namespace precice::testing::com::intracomm;
+  TestAllgather<SocketCommunication>(context);
+}
+
+BOOST_AUTO_TEST_CASE(Gather)
+{
+  PRECICE_TEST(2_ranks, Require::Events);
+  using namespace precice::testing::com::intracomm;
+  TestGather<SocketCommunication>(context);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Intra
 
 BOOST_AUTO_TEST_SUITE(Inter)
@@ -153,5 +178,95 @@ BOOST_AUTO_TEST_CASE(SendReceiveFourV2)
 
 BOOST_AUTO_TEST_SUITE_END() // Server
 
+BOOST_AUTO_TEST_SUITE(UnixDomain)
+
+BOOST_AUTO_TEST_CASE(IntraSendReceiveRanges)
+{
+  PRECICE_TEST(2_ranks, Require::Events);
+  using namespace precice::testing::com::intracomm;
+  TestSendAndReceiveRanges<UnixDomainSocketCommunication>(context);
+}
+
+BOOST_AUTO_TEST_CASE(IntraGather)
+{
+  PRECICE_TEST(2_ranks, Require::Events);
+  using namespace precice::testing::com::intracomm;
+  TestGather<UnixDomainSocketCommunication>(context);
+}
+
+BOOST_AUTO_TEST_CASE(InterSendReceivePrimitives)
+{
+  PRECICE_TEST("A"_on(1_rank), "B"_on(1_rank), Require::Events);
+  using namespace precice::testing::com::primaryprimary;
+  TestSendAndReceivePrimitiveTypes<UnixDomainSocketCommunication>(context);
+}
+
+BOOST_AUTO_TEST_CASE(InterSendReceiveFourProcesses)
+{
+  PRECICE_TEST("A"_on(2_ranks), "B"_on(2_ranks), Require::Events);
+  using namespace precice::testing::com::primaryprimary;
+  TestSendReceiveFourProcesses<UnixDomainSocketCommunication>(context);
+}
+
+BOOST_AUTO_TEST_CASE(ServerSendReceiveFour)
+{
+  PRECICE_TEST("A"_on(2_ranks), "B"_on(2_ranks), Require::Events);
+  using namespace precice::testing::com::serverclient;
+  TestSendReceiveFourProcessesServerClient<UnixDomainSocketCommunication>(context);
+}
+
+/// Streams messages of increasing size over TCP on the loopback interface and over Unix domain sockets
+BOOST_AUTO_TEST_CASE(LoopbackThroughput)
+{
+  PRECICE_TEST("A"_on(1_rank), "B"_on(1_rank), Require::Events);
+
+  auto stream = [&context](Communication &com, std::size_t size, int repetitions) {
+    std::vector<double> message(size, 1.0);
+    using Clock      = std::chrono::steady_clock;
+    const auto start = Clock::now();
+    for (int i = 0; i < repetitions; ++i) {
+      if (context.isNamed("A")) {
+        com.send(message, 0);
+      } else {
+        com.receive(message, 0);
+      }
+    }
+    // Acknowledge the last message to include the transfer time of all messages
+    int ack = 1;
+    if (context.isNamed("A")) {
+      com.receive(ack, 0);
+    } else {
+      com.send(ack, 0);
+    }
+    const std::chrono::duration<double> duration = Clock::now() - start;
+    BOOST_TEST(message.back() == 1.0);
+    return repetitions * size * sizeof(double) / 1e6 / duration.count();
+  };
+
+  SocketCommunication           tcp;
+  UnixDomainSocketCommunication local;
+  if (context.isNamed("A")) {
+    tcp.acceptConnection("A", "B", "tcp", 0);
+    local.acceptConnection("A", "B", "local", 0);
+  } else {
+    tcp.requestConnection("A", "B", "tcp", 0, 1);
+    local.requestConnection("A", "B", "local", 0, 1);
+  }
+  BOOST_TEST(not tcp.isUnixDomainConnection(0));
+  BOOST_TEST(local.isUnixDomainConnection(0));
+
+  for (std::size_t size : {16, 4096, 1024 * 1024}) {
+    const int    repetitions = size > 4096 ? 20 : 2000;
+    const double tcpRate     = stream(tcp, size, repetitions);
+    const double localRate   = stream(local, size, repetitions);
+    BOOST_TEST_MESSAGE("Messages of " << size << " doubles: TCP " << tcpRate << "MB/s, Unix domain sockets " << localRate << "MB/s");
+  }
+
+  tcp.closeConnection();
+  local.closeConnection();
+}
+
+BOOST_AUTO_TEST_SUITE_END() // UnixDomain
+
 BOOST_AUTO_TEST_SUITE_END() // Socket
 BOOST_AUTO_TEST_SUITE_END() // Communication
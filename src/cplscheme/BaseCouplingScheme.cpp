@@ -8,6 +8,7 @@
 #include <limits>
 #include <sstream>
 #include <utility>
+#include <vector>
 
 #include "acceleration/Acceleration.hpp"
 #include "com/SerializedStamples.hpp"
@@ -119,6 +120,9 @@ void BaseCouplingScheme::sendData(const m2n::PtrM2N &m2n, const DataMap &sendDat
   PRECICE_ASSERT(m2n->isConnected());
 
   for (const auto &data : sendData | boost::adaptors::map_values) {
+    // The sends are asynchronous, hence preparing this data overlaps with sending the previous one
+    prepareData(*data);
+
     const auto &stamples = data->stamples();
     PRECICE_ASSERT(!stamples.empty());
 
@@ -686,12 +690,29 @@ bool BaseCouplingScheme::measureConvergence()
   bool oneSuffices  = false; // at least one convergence measure suffices and did converge
   bool oneStrict    = false; // at least one convergence measure is strict and did not converge
 
-  const bool reachedMinIterations = _iterations >= _minIterations;
+  // All measures contribute their local partial sums to one buffer, which is reduced at once
+  std::vector<int> offsets;
+  offsets.reserve(_convergenceMeasures.size() + 1);
+  offsets.push_back(0);
   for (const auto &convMeasure : _convergenceMeasures) {
-    PRECICE_ASSERT(convMeasure.couplingData != nullptr);
     PRECICE_ASSERT(convMeasure.measure.get() != nullptr);
+    offsets.push_back(offsets.back() + convMeasure.measure->getNumberOfPartialSums());
+  }
+  std::vector<double> localSums(offsets.back(), 0.0);
+  std::vector<double> globalSums(offsets.back(), 0.0);
+  for (std::size_t i = 0; i < _convergenceMeasures.size(); ++i) {
+    const auto &convMeasure = _convergenceMeasures[i];
+    PRECICE_ASSERT(convMeasure.couplingData != nullptr);
     PRECICE_ASSERT(convMeasure.couplingData->previousIteration().size() == convMeasure.couplingData->values().size(), convMeasure.couplingData->previousIteration().size(), convMeasure.couplingData->values().size(), convMeasure.couplingData->getDataName());
-    convMeasure.measure->measure(convMeasure.couplingData->previousIteration(), convMeasure.couplingData->values());
+    convMeasure.measure->computePartialSums(convMeasure.couplingData->previousIteration(), convMeasure.couplingData->values(),
+                                            precice::span<double>(localSums).subspan(offsets[i], offsets[i + 1] - offsets[i]));
+  }
+  utils::IntraComm::allreduceSum(localSums, globalSums);
+
+  const bool reachedMinIterations = _iterations >= _minIterations;
+  for (std::size_t i = 0; i < _convergenceMeasures.size(); ++i) {
+    const auto &convMeasure = _convergenceMeasures[i];
+    convMeasure.measure->finalizeMeasurement(precice::span<const double>(globalSums).subspan(offsets[i], offsets[i + 1] - offsets[i]));
 
     if (not utils::IntraComm::isSecondary() && convMeasure.doesLogging) {
       _convergenceWriter->writeData(convMeasure.logHeader(), convMeasure.measure->getNormResidual());
@@ -777,6 +798,12 @@ void BaseCouplingScheme::advanceTXTWriters()
       _iterationsWriter->writeData("DeletedQNColumns", _acceleration->getDeletedColumns());
       _iterationsWriter->writeData("DroppedQNColumns", _acceleration->getDroppedColumns());
     }
+
+    // The writers buffer their rows, which are written to file once per time window
+    _iterationsWriter->flush();
+    if (_convergenceWriter) {
+      _convergenceWriter->flush();
+    }
   }
 }
 
@@ -831,6 +858,11 @@ bool BaseCouplingScheme::anyDataRequiresInitialization(DataMap &dataMap) const
 
 void BaseCouplingScheme::doImplicitStep()
 {
+  // Convergence measures and acceleration may access any coupling data
+  for (const auto &data : _allData | boost::adaptors::map_values) {
+    prepareData(*data);
+  }
+
   PRECICE_DEBUG("measure convergence of the coupling iteration");
   _hasConverged = measureConvergence();
   // Stop, when maximal iteration count (given in config) is reached
@@ -867,6 +899,18 @@ void BaseCouplingScheme::doImplicitStep()
   }
 }
 
+void BaseCouplingScheme::setDataPreparation(DataPreparation prepare)
+{
+  _prepareData = std::move(prepare);
+}
+
+void BaseCouplingScheme::prepareData(CouplingData &data) const
+{
+  if (_prepareData) {
+    _prepareData(data.getDataID());
+  }
+}
+
 void BaseCouplingScheme::sendConvergence(const m2n::PtrM2N &m2n)
 {
   PRECICE_ASSERT(isImplicitCouplingScheme());
@@ -242,6 +242,8 @@ protected:
   /**
    * @brief Sends data sendDataIDs given in mapCouplingData with communication.
    *
+   * Each data is prepared right before it is sent, see setDataPreparation().
+   *
    * @param m2n M2N used for communication
    * @param sendData DataMap associated with sent data
    */
@@ -401,12 +403,21 @@ protected:
   /// @copydoc cplscheme::CouplingScheme::localParticipant()
   std::string localParticipant() const override final;
 
+  /// @copydoc cplscheme::CouplingScheme::setDataPreparation()
+  void setDataPreparation(DataPreparation prepare) override final;
+
 private:
   /// Coupling mode used by coupling scheme.
   CouplingMode _couplingMode = Undefined;
 
   mutable logging::Logger _log{"cplscheme::BaseCouplingScheme"};
 
+  /// Completes pending updates of coupling data before it is sent or accelerated
+  DataPreparation _prepareData;
+
+  /// Invokes _prepareData for the given data, if a callback is set
+  void prepareData(CouplingData &data) const;
+
   /// Maximum time being computed. End of simulation is reached, if getTime() == _maxTime
   double _maxTime;
 
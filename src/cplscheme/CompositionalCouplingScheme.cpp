@@ -510,4 +510,11 @@ ImplicitData CompositionalCouplingScheme::implicitDataToReceive() const
   return {};
 }
 
+void CompositionalCouplingScheme::setDataPreparation(DataPreparation prepare)
+{
+  for (auto scheme : allSchemes()) {
+    scheme->setDataPreparation(prepare);
+  }
+}
+
 } // namespace precice::cplscheme
@@ -209,6 +209,9 @@ public:
   /// @copydoc cplscheme::CouplingScheme::implicitDataToReceive()
   ImplicitData implicitDataToReceive() const override final;
 
+  /// @copydoc cplscheme::CouplingScheme::setDataPreparation()
+  void setDataPreparation(DataPreparation prepare) override final;
+
 private:
   mutable logging::Logger _log{"cplscheme::CompositionalCouplingScheme"};
 
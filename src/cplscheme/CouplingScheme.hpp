@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <map>
 #include <string>
 #include <vector>
@@ -68,6 +69,9 @@ public:
 
   static std::string toString(Action action);
 
+  /// Callback completing pending updates of the values of the given data, such as deferred write mappings
+  using DataPreparation = std::function<void(DataID)>;
+
   CouplingScheme &operator=(CouplingScheme &&) = delete;
 
   virtual ~CouplingScheme() {}
@@ -231,6 +235,14 @@ public:
 
   /// Returns a vector of implicit data to receive in the next advance
   virtual ImplicitData implicitDataToReceive() const = 0;
+
+  /**
+   * @brief Sets a callback which is invoked for every coupling data right before its values are used.
+   *
+   * This allows to defer the computation of send data, e.g., write mappings, until the data is sent.
+   * As sends are asynchronous, the preparation of one data overlaps with the communication of the previous one.
+   */
+  virtual void setDataPreparation(DataPreparation prepare) = 0;
 };
 
 } // namespace cplscheme
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <cmath>
 #include <iomanip>
 #include <ostream>
 #include <string>
@@ -41,11 +42,23 @@ public:
     _isConvergence = false;
   }
 
-  virtual void measure(
+  /// Squared two-norm of the difference.
+  virtual int getNumberOfPartialSums() const
+  {
+    return 1;
+  }
+
+  virtual void computePartialSums(
       const Eigen::VectorXd &oldValues,
-      const Eigen::VectorXd &newValues)
+      const Eigen::VectorXd &newValues,
+      precice::span<double>  partialSums) const
+  {
+    partialSums[0] = (newValues - oldValues).squaredNorm();
+  }
+
+  virtual void finalizeMeasurement(precice::span<const double> globalSums)
   {
-    _normDiff      = utils::IntraComm::l2norm(newValues - oldValues);
+    _normDiff      = std::sqrt(globalSums[0]);
     _isConvergence = _normDiff <= _convergenceLimit;
   }
 
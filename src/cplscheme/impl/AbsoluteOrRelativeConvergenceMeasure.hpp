@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <cmath>
 #include <iomanip>
 #include <limits>
 #include <math.h>
@@ -60,12 +61,25 @@ public:
     _isConvergence = false;
   }
 
-  virtual void measure(
+  /// Squared two-norms of the difference and of the new values.
+  virtual int getNumberOfPartialSums() const
+  {
+    return 2;
+  }
+
+  virtual void computePartialSums(
       const Eigen::VectorXd &oldValues,
-      const Eigen::VectorXd &newValues)
+      const Eigen::VectorXd &newValues,
+      precice::span<double>  partialSums) const
+  {
+    partialSums[0] = (newValues - oldValues).squaredNorm();
+    partialSums[1] = newValues.squaredNorm();
+  }
+
+  virtual void finalizeMeasurement(precice::span<const double> globalSums)
   {
-    _normDiff      = utils::IntraComm::l2norm(newValues - oldValues);
-    _norm          = utils::IntraComm::l2norm(newValues);
+    _normDiff      = std::sqrt(globalSums[0]);
+    _norm          = std::sqrt(globalSums[1]);
     _isConvergence = (_normDiff <= _norm * _convergenceLimitPercent) or (_normDiff <= _convergenceLimit);
   }
 
@@ -0,0 +1,19 @@
+#include <vector>
+
+#include "ConvergenceMeasure.hpp"
+#include "utils/IntraComm.hpp"
+
+namespace precice::cplscheme::impl {
+
+void ConvergenceMeasure::measure(
+    const Eigen::VectorXd &oldValues,
+    const Eigen::VectorXd &newValues)
+{
+  std::vector<double> localSums(getNumberOfPartialSums(), 0.0);
+  std::vector<double> globalSums(localSums.size(), 0.0);
+  computePartialSums(oldValues, newValues, localSums);
+  utils::IntraComm::allreduceSum(localSums, globalSums);
+  finalizeMeasurement(globalSums);
+}
+
+} // namespace precice::cplscheme::impl
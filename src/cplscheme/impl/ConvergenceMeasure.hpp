@@ -1,6 +1,9 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <string>
+
+#include "precice/span.hpp"
 
 namespace precice {
 namespace cplscheme {
@@ -18,6 +21,12 @@ namespace impl {
  * -# call newMeasurementSeries() for one set of iterations
  * -# call measure() for convergence measurement
  * -# retrieve the convergence status via isConvergence()
+ *
+ * Alternatively, the measurement can be split into two phases, which allows
+ * to fuse the global reductions of several measures into a single one:
+ * -# call computePartialSums() to fill the rank-local partial sums
+ * -# reduce the partial sums of all measures over all ranks, e.g. with utils::IntraComm::allreduceSum()
+ * -# call finalizeMeasurement() with the reduced sums
  */
 class ConvergenceMeasure {
 public:
@@ -30,12 +39,36 @@ public:
   /**
    * @brief Performs convergence measurement.
    *
+   * Runs both phases of the measurement with a reduction of the partial sums of this measure only.
+   *
    * @param[in] oldValues Old iterate values.
    * @param[in] newValues New iterate values.
    */
-  virtual void measure(
+  void measure(
       const Eigen::VectorXd &oldValues,
-      const Eigen::VectorXd &newValues) = 0;
+      const Eigen::VectorXd &newValues);
+
+  /// Returns the amount of partial sums this measure requires, i.e. the size of its part in the reduction buffer.
+  virtual int getNumberOfPartialSums() const = 0;
+
+  /**
+   * @brief Computes the rank-local partial sums of a measurement.
+   *
+   * @param[in] oldValues Old iterate values.
+   * @param[in] newValues New iterate values.
+   * @param[out] partialSums Local partial sums of size getNumberOfPartialSums().
+   */
+  virtual void computePartialSums(
+      const Eigen::VectorXd &oldValues,
+      const Eigen::VectorXd &newValues,
+      precice::span<double>  partialSums) const = 0;
+
+  /**
+   * @brief Completes the measurement from partial sums summed up over all ranks.
+   *
+   * @param[in] globalSums Reduced partial sums of size getNumberOfPartialSums().
+   */
+  virtual void finalizeMeasurement(precice::span<const double> globalSums) = 0;
 
   /// Returns true, if the last measurement indicates convergence.
   virtual bool isConvergence() const = 0;
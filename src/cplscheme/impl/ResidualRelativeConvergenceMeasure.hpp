@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <cmath>
 #include <iomanip>
 #include <limits>
 #include <ostream>
@@ -46,11 +47,23 @@ public:
     _normFirstResidual = std::numeric_limits<double>::max();
   }
 
-  virtual void measure(
+  /// Squared two-norm of the difference.
+  virtual int getNumberOfPartialSums() const
+  {
+    return 1;
+  }
+
+  virtual void computePartialSums(
       const Eigen::VectorXd &oldValues,
-      const Eigen::VectorXd &newValues)
+      const Eigen::VectorXd &newValues,
+      precice::span<double>  partialSums) const
+  {
+    partialSums[0] = (newValues - oldValues).squaredNorm();
+  }
+
+  virtual void finalizeMeasurement(precice::span<const double> globalSums)
   {
-    _normDiff = utils::IntraComm::l2norm(newValues - oldValues);
+    _normDiff = std::sqrt(globalSums[0]);
     if (_isFirstIteration) {
       _normFirstResidual = _normDiff;
       _isFirstIteration  = false;
@@ -218,6 +218,8 @@ public:
     return {};
   }
 
+  void setDataPreparation(DataPreparation) override final {}
+
 private:
   mutable logging::Logger _log{"cplscheme::tests::DummyCouplingScheme"};
 
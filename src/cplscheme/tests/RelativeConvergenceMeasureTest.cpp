@@ -1,5 +1,8 @@
 #include <Eigen/Core>
+#include <cmath>
+#include <vector>
 #include "../impl/RelativeConvergenceMeasure.hpp"
+#include "../impl/ResidualRelativeConvergenceMeasure.hpp"
 #include "testing/TestContext.hpp"
 #include "testing/Testing.hpp"
 
@@ -28,4 +31,42 @@ BOOST_AUTO_TEST_CASE(RelativeConvergenceMeasureTest)
   BOOST_TEST(measure.isConvergence());
 }
 
+BOOST_AUTO_TEST_CASE(FusedRelativeConvergenceMeasureTest)
+{
+  PRECICE_TEST(""_on(2_ranks).setupIntraComm());
+  using Eigen::Vector3d;
+  using namespace precice::cplscheme::impl;
+  RelativeConvergenceMeasure         separateRelative(0.1);
+  RelativeConvergenceMeasure         fusedRelative(0.1);
+  ResidualRelativeConvergenceMeasure fusedResidual(0.1);
+
+  // Each rank holds a part of the distributed data
+  Vector3d oldValues(1, 1, 1);
+  Vector3d newValues(3, 3, 3);
+  if (context.isRank(1)) {
+    oldValues << 2, 2, 2;
+  }
+
+  separateRelative.measure(oldValues, newValues);
+
+  // Both measures share a single reduction buffer
+  const int           nRel = fusedRelative.getNumberOfPartialSums();
+  const int           nRes = fusedResidual.getNumberOfPartialSums();
+  std::vector<double> localSums(nRel + nRes);
+  std::vector<double> globalSums(localSums.size());
+  fusedRelative.computePartialSums(oldValues, newValues, precice::span<double>(localSums).subspan(0, nRel));
+  fusedResidual.computePartialSums(oldValues, newValues, precice::span<double>(localSums).subspan(nRel, nRes));
+  precice::utils::IntraComm::allreduceSum(localSums, globalSums);
+  fusedRelative.finalizeMeasurement(precice::span<const double>(globalSums).subspan(0, nRel));
+  fusedResidual.finalizeMeasurement(precice::span<const double>(globalSums).subspan(nRel, nRes));
+
+  // |(2,2,2,1,1,1)| / |(3,3,3,3,3,3)|
+  BOOST_TEST(fusedRelative.getNormResidual() == std::sqrt(15.0) / std::sqrt(54.0));
+  BOOST_TEST(fusedRelative.getNormResidual() == separateRelative.getNormResidual());
+  BOOST_TEST(not fusedRelative.isConvergence());
+  // The first residual is the normalization of the residual relative measure
+  BOOST_TEST(fusedResidual.getNormResidual() == 1.0);
+  BOOST_TEST(not fusedResidual.isConvergence());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -3,7 +3,7 @@
 #include <Eigen/Core>
 #include <filesystem>
 #include <fstream>
-#include <iomanip>
+#include <iterator>
 #include <memory>
 #include "io/Export.hpp"
 #include "logging/LogMacros.hpp"
@@ -15,6 +15,7 @@
 #include "mesh/Vertex.hpp"
 #include "utils/IntraComm.hpp"
 #include "utils/assertion.hpp"
+#include "utils/fmt.hpp"
 
 namespace precice::io {
 
@@ -75,24 +76,29 @@ void ExportCSV::doExport(int index, double time)
   std::ofstream outFile(outfile.string(), std::ios::trunc);
   const bool    is3d = (_mesh->getDimensions() == 3);
 
+  // The file is formatted into a buffer, which is written out in large chunks
+  constexpr std::size_t bufferCapacity = 1 << 20;
+  fmt::memory_buffer    buffer;
+  auto                  out = std::back_inserter(buffer);
+
   // write header
-  outFile << "PosX;PosY";
+  fmt::format_to(out, "PosX;PosY");
   if (is3d) {
-    outFile << ";PosZ";
+    fmt::format_to(out, ";PosZ");
   }
-  outFile << ";Rank";
+  fmt::format_to(out, ";Rank");
   for (const auto &data : _mesh->data()) {
     auto dataName = data->getName();
     auto dim      = data->getDimensions();
     PRECICE_ASSERT(static_cast<std::size_t>(data->values().size()) == _mesh->nVertices() * dim);
-    outFile << ';' << dataName;
+    fmt::format_to(out, ";{}", dataName);
     if (dim == 2) {
-      outFile << "X;" << dataName << 'Y';
+      fmt::format_to(out, "X;{}Y", dataName);
     } else if (dim == 3) {
-      outFile << "X;" << dataName << "Y;" << dataName << 'Z';
+      fmt::format_to(out, "X;{}Y;{}Z", dataName, dataName);
     }
   }
-  outFile << '\n';
+  buffer.push_back('\n');
 
   // Prepare writing data
   std::vector<StridedAccess> dataColumns;
@@ -104,23 +110,26 @@ void ExportCSV::doExport(int index, double time)
     }
   }
 
-  // write vertex data
-  const std::string rankCol = ";" + std::to_string(_rank);
-  const auto        size    = _mesh->nVertices();
+  // write vertex data using the default formatting of iostreams
+  const auto size = _mesh->nVertices();
   for (std::size_t vid = 0; vid < size; ++vid) {
     const auto &vertex = _mesh->vertex(vid);
-    outFile << vertex.coord(0) << ';';
-    outFile << vertex.coord(1);
+    fmt::format_to(out, "{:g};{:g}", vertex.coord(0), vertex.coord(1));
     if (is3d) {
-      outFile << ";" << vertex.coord(2);
+      fmt::format_to(out, ";{:g}", vertex.coord(2));
     }
-    outFile << rankCol;
+    fmt::format_to(out, ";{}", _rank);
     for (auto &dc : dataColumns) {
-      outFile << ';' << *dc;
+      fmt::format_to(out, ";{:g}", *dc);
       dc.next();
     }
-    outFile << '\n';
+    buffer.push_back('\n');
+    if (buffer.size() > bufferCapacity) {
+      outFile.write(buffer.data(), buffer.size());
+      buffer.clear();
+    }
   }
+  outFile.write(buffer.data(), buffer.size());
 }
 
 void ExportCSV::exportSeries() const
@@ -1,24 +1,43 @@
 #include "TXTTableWriter.hpp"
 #include <algorithm>
-#include <iomanip>
+#include <cstdint>
+#include <iterator>
+#include <ostream>
 #include "logging/LogMacros.hpp"
 #include "utils/Helpers.hpp"
 #include "utils/assertion.hpp"
 
 namespace precice::io {
 
+namespace {
+template <typename T>
+void writeBinaryValue(std::ostream &out, T value)
+{
+  out.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+} // namespace
+
 TXTTableWriter::TXTTableWriter(
-    const std::string &filename)
-    : _data(),
+    const std::string &filename,
+    Format             format)
+    : _format(format),
+      _data(),
       _writeIterator(_data.end()),
       _outputStream()
 {
-  _outputStream.open(filename);
+  if (_format == Format::Binary) {
+    _outputStream.open(filename, std::ios::binary);
+  } else {
+    _outputStream.open(filename);
+  }
   PRECICE_CHECK(_outputStream, "TXT table writer failed to open file \"{}\"", filename);
+}
 
-  _outputStream.setf(std::ios::showpoint);
-  _outputStream.setf(std::ios::fixed);
-  _outputStream << std::setprecision(16);
+TXTTableWriter::~TXTTableWriter()
+{
+  if (_outputStream.is_open()) {
+    flush();
+  }
 }
 
 void TXTTableWriter::addData(
@@ -31,27 +50,25 @@ void TXTTableWriter::addData(
   data.type = type;
   _data.push_back(data);
 
-  std::string delimiter = _data.empty() ? "" : "  ";
-  if ((type == INT) || (type == DOUBLE)) {
-    _outputStream << delimiter << name;
+  const std::size_t firstColumn = _columns.size();
+  if (type == INT) {
+    _columns.push_back({name, true, {}});
+  } else if (type == DOUBLE) {
+    _columns.push_back({name, false, {}});
   } else {
-    _outputStream << delimiter << name << 0;
-    if (type == VECTOR2D) {
-      for (int i = 1; i < 2; i++) {
-        _outputStream << "  " << name << i;
-      }
-    } else {
-      PRECICE_ASSERT(type == VECTOR3D);
-      for (int i = 1; i < 3; i++) {
-        _outputStream << "  " << name << i;
-      }
+    PRECICE_ASSERT(type == VECTOR2D || type == VECTOR3D);
+    const int components = (type == VECTOR2D) ? 2 : 3;
+    for (int i = 0; i < components; i++) {
+      _columns.push_back({name + std::to_string(i), false, {}});
     }
   }
-  // Print out everything apart from INT consistently in scientific
-  // notation using a fixed precision
-  if (type == DOUBLE || type == VECTOR2D || type == VECTOR3D) {
-    _outputStream << std::scientific << std::setprecision(8);
+
+  if (_format == Format::Text) {
+    for (std::size_t i = firstColumn; i < _columns.size(); i++) {
+      fmt::format_to(std::back_inserter(_buffer), "  {}", _columns[i].name);
+    }
   }
+  _headerPending = true;
   _writeIterator = _data.end();
 }
 
@@ -59,104 +76,164 @@ void TXTTableWriter::writeData(
     const std::string &name,
     int                value)
 {
-  PRECICE_ASSERT(_outputStream);
-  PRECICE_ASSERT(not _data.empty());
-  if (_writeIterator == _data.end()) {
-    _writeIterator = _data.begin();
-    _outputStream << "\n";
-  }
-  PRECICE_ASSERT(_writeIterator->name == name, _writeIterator->name, name);
-  PRECICE_ASSERT(_writeIterator->type == INT, _writeIterator->type);
-
-  std::string delimiter = _writeIterator == _data.begin() ? "" : "  ";
-  _outputStream << delimiter << std::setw(6) << value;
-  _writeIterator++;
-  if (_writeIterator == _data.end()) {
-    _outputStream.flush();
-  }
+  beginEntry(name, INT);
+  writeValue(value);
+  endEntry();
 }
 
 void TXTTableWriter::writeData(
     const std::string &name,
     double             value)
 {
-  PRECICE_ASSERT(_outputStream);
-  PRECICE_ASSERT(not _data.empty());
-  if (_writeIterator == _data.end()) {
-    _writeIterator = _data.begin();
-    _outputStream << "\n";
-  }
-  PRECICE_ASSERT(_writeIterator->name == name, _writeIterator->name, name);
-  PRECICE_ASSERT(_writeIterator->type == DOUBLE, _writeIterator->type);
-
-  std::string delimiter = _writeIterator == _data.begin() ? "" : "  ";
-  _outputStream << delimiter << std::setw(15) << value;
-  _writeIterator++;
-  if (_writeIterator == _data.end()) {
-    _outputStream.flush();
-  }
+  beginEntry(name, DOUBLE);
+  writeValue(value);
+  endEntry();
 }
 
 void TXTTableWriter::writeData(
     const std::string &    name,
     const Eigen::Vector2d &value)
 {
-  PRECICE_ASSERT(_outputStream);
-  PRECICE_ASSERT(not _data.empty());
-  if (_writeIterator == _data.end()) {
-    _writeIterator = _data.begin();
-    _outputStream << "\n";
-  }
-  PRECICE_ASSERT(_writeIterator->name == name, _writeIterator->name, name);
-  PRECICE_ASSERT(_writeIterator->type == VECTOR2D, _writeIterator->type);
-
-  std::string delimiter = _writeIterator == _data.begin() ? "" : "  ";
-  _outputStream << delimiter << std::setw(15) << value[0];
-
-  for (int i = 1; i < value.size(); i++) {
-    _outputStream << "  " << std::setw(15) << value[i];
-  }
-  _writeIterator++;
-  if (_writeIterator == _data.end()) {
-    _outputStream.flush();
+  beginEntry(name, VECTOR2D);
+  for (int i = 0; i < value.size(); i++) {
+    writeValue(value[i]);
   }
+  endEntry();
 }
 
 void TXTTableWriter::writeData(
     const std::string &    name,
     const Eigen::Vector3d &value)
 {
-  PRECICE_ASSERT(_outputStream);
-  PRECICE_ASSERT(not _data.empty());
-  if (_writeIterator == _data.end()) {
-    _writeIterator = _data.begin();
-    _outputStream << "\n";
+  beginEntry(name, VECTOR3D);
+  for (int i = 0; i < value.size(); i++) {
+    writeValue(value[i]);
   }
-  PRECICE_ASSERT(_writeIterator->name == name, _writeIterator->name, name);
-  PRECICE_ASSERT(_writeIterator->type == VECTOR3D, _writeIterator->type);
+  endEntry();
+}
 
-  std::string delimiter = _writeIterator == _data.begin() ? "" : "  ";
-  _outputStream << delimiter << std::setw(15) << value[0];
-  for (int i = 1; i < value.size(); i++) {
-    _outputStream << "  " << std::setw(15) << value[i];
-  }
-  _writeIterator++;
-  if (_writeIterator == _data.end()) {
-    _outputStream.flush();
+void TXTTableWriter::flush()
+{
+  PRECICE_ASSERT(_outputStream.is_open());
+  if (_format == Format::Binary) {
+    // Tables without rows stay empty, as other processes may write the same file
+    if (_headerPending && _bufferedRows > 0) {
+      writeBinaryHeader();
+    }
+    writeBinaryRows();
+  } else {
+    _outputStream.write(_buffer.data(), _buffer.size());
+    _buffer.clear();
   }
+  _bufferedRows = 0;
+  _outputStream.flush();
 }
 
 void TXTTableWriter::close()
 {
   PRECICE_ASSERT(_outputStream.is_open());
+  flush();
   _outputStream.close();
 }
 
 /// Resets the table information.
 void TXTTableWriter::reset()
 {
+  // Binary rows are only valid in combination with their header
+  if (_format == Format::Binary && _outputStream.is_open()) {
+    flush();
+  }
   _data.clear();
+  _columns.clear();
   _writeIterator = _data.end();
+  _headerPending = true;
+}
+
+void TXTTableWriter::beginEntry(
+    const std::string &name,
+    DataType           type)
+{
+  PRECICE_ASSERT(_outputStream);
+  PRECICE_ASSERT(not _data.empty());
+  if (_writeIterator == _data.end()) {
+    _writeIterator = _data.begin();
+    _column        = 0;
+    if (_format == Format::Text) {
+      _buffer.push_back('\n');
+    }
+  }
+  PRECICE_ASSERT(_writeIterator->name == name, _writeIterator->name, name);
+  PRECICE_ASSERT(_writeIterator->type == type, _writeIterator->type);
+}
+
+void TXTTableWriter::endEntry()
+{
+  _writeIterator++;
+  if (_writeIterator != _data.end()) {
+    return;
+  }
+  _bufferedRows++;
+  const std::size_t bufferedBytes = (_format == Format::Text) ? _buffer.size() : _bufferedRows * _columns.size() * sizeof(double);
+  if (bufferedBytes > BUFFER_CAPACITY) {
+    flush();
+  }
+}
+
+void TXTTableWriter::writeValue(int value)
+{
+  PRECICE_ASSERT(_column < _columns.size());
+  if (_format == Format::Text) {
+    fmt::format_to(std::back_inserter(_buffer), "{}{:>6}", _column == 0 ? "" : "  ", value);
+  } else {
+    _columns[_column].values.push_back(value);
+  }
+  _column++;
+}
+
+void TXTTableWriter::writeValue(double value)
+{
+  PRECICE_ASSERT(_column < _columns.size());
+  // Print out everything apart from INT consistently in scientific
+  // notation using a fixed precision
+  if (_format == Format::Text) {
+    fmt::format_to(std::back_inserter(_buffer), "{}{:>15.8e}", _column == 0 ? "" : "  ", value);
+  } else {
+    _columns[_column].values.push_back(value);
+  }
+  _column++;
+}
+
+void TXTTableWriter::writeBinaryHeader()
+{
+  _outputStream.put('H');
+  writeBinaryValue<std::uint32_t>(_outputStream, _columns.size());
+  for (const Column &column : _columns) {
+    writeBinaryValue<std::uint32_t>(_outputStream, column.name.size());
+    _outputStream.write(column.name.data(), column.name.size());
+    writeBinaryValue<std::uint8_t>(_outputStream, column.isInt ? 0 : 1);
+  }
+  _headerPending = false;
+}
+
+void TXTTableWriter::writeBinaryRows()
+{
+  if (_bufferedRows == 0) {
+    return;
+  }
+  _outputStream.put('R');
+  writeBinaryValue<std::uint64_t>(_outputStream, _bufferedRows);
+  for (Column &column : _columns) {
+    PRECICE_ASSERT(column.values.size() >= _bufferedRows);
+    const auto rowsEnd = column.values.begin() + _bufferedRows;
+    if (column.isInt) {
+      std::vector<std::int32_t> ints(column.values.begin(), rowsEnd);
+      _outputStream.write(reinterpret_cast<const char *>(ints.data()), ints.size() * sizeof(std::int32_t));
+    } else {
+      _outputStream.write(reinterpret_cast<const char *>(column.values.data()), _bufferedRows * sizeof(double));
+    }
+    // Keep the values of an incomplete row
+    column.values.erase(column.values.begin(), rowsEnd);
+  }
 }
 
 } // namespace precice::io
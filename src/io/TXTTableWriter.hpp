@@ -1,10 +1,12 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <cstddef>
 #include <fstream>
 #include <string>
 #include <vector>
 #include "logging/Logger.hpp"
+#include "utils/fmt.hpp"
 
 namespace precice {
 namespace io {
@@ -15,6 +17,19 @@ namespace io {
  * Usage:
  * Create the writer, add data entries in the wanted sequence, and write data
  * values cyclically in the same sequence.
+ *
+ * Rows are buffered in memory and written to the file on flush(), on close(),
+ * on destruction, and whenever the buffer exceeds its capacity.
+ *
+ * The binary format stores the table column-wise in native byte order as a
+ * sequence of blocks, each starting with a one-byte tag:
+ * - 'H' header: uint32 column count, then per column a uint32 name length,
+ *   the name, and a uint8 type (0 for int32, 1 for float64).
+ *   Vector entries span one column per component.
+ * - 'R' row group: uint64 row count, then the values of all rows per column.
+ *
+ * A header precedes the first row group after construction and after every reset().
+ * A table without rows leaves the file empty.
  */
 class TXTTableWriter {
 public:
@@ -26,8 +41,17 @@ public:
     VECTOR3D
   };
 
+  /// Possible output formats of the table.
+  enum class Format {
+    Text,
+    Binary
+  };
+
   /// Constructor, opens file.
-  explicit TXTTableWriter(const std::string &filename);
+  explicit TXTTableWriter(const std::string &filename, Format format = Format::Text);
+
+  /// Destructor, writes all buffered rows to the file.
+  ~TXTTableWriter();
 
   /**
    * @brief Adds a data entry to the table.
@@ -71,6 +95,9 @@ public:
       const std::string &    name,
       const Eigen::Vector3d &value);
 
+  /// Writes all buffered rows to the file.
+  void flush();
+
   /// Closes the file, is automatically called on destruction.
   void close();
 
@@ -78,6 +105,9 @@ public:
   void reset();
 
 private:
+  /// Capacity of the write buffer in bytes.
+  static constexpr std::size_t BUFFER_CAPACITY = 1 << 20;
+
   /// Represents one data entry to be written.
   struct Data {
 
@@ -91,12 +121,55 @@ private:
     }
   };
 
+  /// Represents one column of the table, holding the binary values buffered since the last flush.
+  struct Column {
+
+    std::string name;
+
+    bool isInt;
+
+    std::vector<double> values;
+  };
+
+  /// Starts writing the data entry of the given name, which has to be the next in order.
+  void beginEntry(const std::string &name, DataType type);
+
+  /// Finishes writing the current data entry.
+  void endEntry();
+
+  /// Appends a value of the current data entry.
+  void writeValue(int value);
+
+  void writeValue(double value);
+
+  /// Appends the header of the binary table to the file.
+  void writeBinaryHeader();
+
+  /// Appends the buffered complete rows of the binary table to the file.
+  void writeBinaryRows();
+
   logging::Logger _log{"io::TXTTableWriter"};
 
+  Format _format;
+
   std::vector<Data> _data;
 
   std::vector<Data>::const_iterator _writeIterator;
 
+  std::vector<Column> _columns;
+
+  /// Index of the next column to write in the current row.
+  std::size_t _column = 0;
+
+  /// Number of complete rows buffered since the last flush.
+  std::size_t _bufferedRows = 0;
+
+  /// Whether the header of the binary table has yet to be written.
+  bool _headerPending = true;
+
+  /// Formatted text which has not been written to the file yet.
+  fmt::memory_buffer _buffer;
+
   std::ofstream _outputStream;
 };
 
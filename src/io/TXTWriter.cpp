@@ -1,5 +1,5 @@
 #include "TXTWriter.hpp"
-#include <iomanip>
+#include <iterator>
 #include "logging/LogMacros.hpp"
 
 namespace precice::io {
@@ -10,14 +10,17 @@ TXTWriter::TXTWriter(
 {
   _file.open(filename);
   PRECICE_CHECK(_file, "TXT writer failed to open file \"{}\"", filename);
+}
 
-  _file.setf(std::ios::showpoint);
-  _file.setf(std::ios::fixed);
-  _file << std::setprecision(16);
+TXTWriter::~TXTWriter()
+{
+  flush();
 }
 
 void TXTWriter::flush()
 {
+  _file.write(_buffer.data(), _buffer.size());
+  _buffer.clear();
   _file.flush();
 }
 
@@ -25,10 +28,13 @@ void TXTWriter::write(const Eigen::MatrixXd &matrix)
 {
   for (long i = 0; i < matrix.rows(); i++) {
     for (long j = 0; j < matrix.cols(); j++) {
-      _file << matrix(i, j) << ' ';
+      fmt::format_to(std::back_inserter(_buffer), "{:.16f} ", matrix(i, j));
     }
   }
-  _file << '\n';
+  _buffer.push_back('\n');
+  if (_buffer.size() > BUFFER_CAPACITY) {
+    flush();
+  }
 }
 
 } // namespace precice::io
@@ -1,15 +1,20 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <cstddef>
 #include <fstream>
 #include <string>
 #include "logging/Logger.hpp"
+#include "utils/fmt.hpp"
 
 namespace precice {
 namespace io {
 
 /**
  * @brief File writer for matrix in Matlab V7 ASCII format.
+ *
+ * Matrices are formatted into a buffer, which is written to the file on flush(),
+ * on destruction, and whenever it exceeds its capacity.
  */
 class TXTWriter {
 public:
@@ -18,6 +23,9 @@ public:
    */
   explicit TXTWriter(const std::string &filename);
 
+  /// Destructor, writes the buffer to file.
+  ~TXTWriter();
+
   ///Writes (appends) the matrix to the file.
   void write(const Eigen::MatrixXd &matrix);
 
@@ -25,8 +33,14 @@ public:
   void flush();
 
 private:
+  /// Capacity of the write buffer in bytes.
+  static constexpr std::size_t BUFFER_CAPACITY = 1 << 20;
+
   logging::Logger _log{"io::TXTWriter"};
 
+  /// Formatted matrices which have not been written to the file yet.
+  fmt::memory_buffer _buffer;
+
   // @brief Filestream.
   std::ofstream _file;
 };
@@ -1,4 +1,8 @@
 #include <Eigen/Core>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <string>
 #include "io/TXTTableWriter.hpp"
 #include "testing/TestContext.hpp"
 #include "testing/Testing.hpp"
@@ -37,4 +41,84 @@ BOOST_AUTO_TEST_CASE(TXTTableWriterTest)
   writer.close();
 }
 
+BOOST_AUTO_TEST_CASE(TXTTableWriterTextFormat)
+{
+  PRECICE_TEST(1_rank);
+  const std::string filename = "io-TXTTableWriterTextFormat.log";
+  {
+    TXTTableWriter writer(filename);
+    writer.addData("Step", TXTTableWriter::INT);
+    writer.addData("Residual", TXTTableWriter::DOUBLE);
+    writer.addData("Force", TXTTableWriter::VECTOR2D);
+
+    writer.writeData("Step", 1);
+    writer.writeData("Residual", 0.125);
+    writer.writeData("Force", Eigen::Vector2d(-1.5, 1e20));
+    writer.flush();
+    writer.writeData("Step", 12);
+    writer.writeData("Residual", 1.0 / 3.0);
+    writer.writeData("Force", Eigen::Vector2d(0.0, 2.0));
+  }
+
+  std::ifstream     file(filename);
+  const std::string content{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+  const std::string expected = "  Step  Residual  Force0  Force1\n"
+                               "     1   1.25000000e-01  -1.50000000e+00   1.00000000e+20\n"
+                               "    12   3.33333333e-01   0.00000000e+00   2.00000000e+00";
+  BOOST_TEST(content == expected);
+}
+
+BOOST_AUTO_TEST_CASE(TXTTableWriterBinaryFormat)
+{
+  PRECICE_TEST(1_rank);
+  const std::string filename = "io-TXTTableWriterBinaryFormat.bin";
+  {
+    TXTTableWriter writer(filename, TXTTableWriter::Format::Binary);
+    writer.addData("Step", TXTTableWriter::INT);
+    writer.addData("Force", TXTTableWriter::VECTOR2D);
+    for (int t = 0; t < 3; t++) {
+      writer.writeData("Step", t);
+      writer.writeData("Force", Eigen::Vector2d(t, -t));
+    }
+    writer.flush();
+    writer.writeData("Step", 3);
+    writer.writeData("Force", Eigen::Vector2d(3.0, -3.0));
+  }
+
+  std::ifstream file(filename, std::ios::binary);
+  auto          read = [&file](auto value) {
+    file.read(reinterpret_cast<char *>(&value), sizeof(value));
+    return value;
+  };
+
+  BOOST_TEST(file.get() == 'H');
+  BOOST_TEST(read(std::uint32_t{}) == 3);
+  const std::string names[] = {"Step", "Force0", "Force1"};
+  for (int column = 0; column < 3; column++) {
+    const auto  length = read(std::uint32_t{});
+    std::string name(length, ' ');
+    file.read(name.data(), length);
+    BOOST_TEST(name == names[column]);
+    BOOST_TEST(read(std::uint8_t{}) == (column == 0 ? 0 : 1));
+  }
+
+  // One row group per flush, the last one written on destruction
+  for (int first : {0, 3}) {
+    BOOST_TEST(file.get() == 'R');
+    const auto rows = read(std::uint64_t{});
+    BOOST_TEST(rows == (first == 0 ? 3u : 1u));
+    for (std::uint64_t row = 0; row < rows; row++) {
+      BOOST_TEST(read(std::int32_t{}) == first + row);
+    }
+    for (std::uint64_t row = 0; row < rows; row++) {
+      BOOST_TEST(read(double{}) == first + row);
+    }
+    for (std::uint64_t row = 0; row < rows; row++) {
+      BOOST_TEST(read(double{}) == -static_cast<double>(first + row));
+    }
+  }
+  file.peek();
+  BOOST_TEST(file.eof());
+}
+
 BOOST_AUTO_TEST_SUITE_END() // IOTests
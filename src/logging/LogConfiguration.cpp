@@ -4,6 +4,10 @@
 #include <boost/log/attributes/mutable_constant.hpp>
 #include <boost/log/core.hpp>
 #include <boost/log/expressions.hpp>
+#include <boost/log/sinks/async_frontend.hpp>
+#include <boost/log/sinks/block_on_overflow.hpp>
+#include <boost/log/sinks/bounded_fifo_queue.hpp>
+#include <boost/log/sinks/drop_on_overflow.hpp>
 #include <boost/log/sinks/sink.hpp>
 #include <boost/log/support/date_time.hpp>
 #include <boost/log/trivial.hpp>
@@ -12,12 +16,15 @@
 #include <deque>
 #include <filesystem>
 #include <fstream>
+#include <functional>
 #include <iostream>
 #include <iterator>
 #include <map>
 #include <sstream>
 #include <string>
 #include <utility>
+#include "logging/LogMacros.hpp"
+#include "logging/Logger.hpp"
 #include "utils/String.hpp"
 #include "utils/assertion.hpp"
 
@@ -121,6 +128,63 @@ public:
   }
 };
 
+/// The maximal amount of records an asynchronous sink buffers
+constexpr std::size_t asyncQueueCapacity = 4096;
+
+/** A sink that writes records to a StreamBackend from a dedicated thread
+ *
+ * Formatting and writing are moved off the logging thread, which only evaluates the filter and enqueues the record.
+ * If the queue is full, the OverflowStrategy either blocks the logging thread or drops the record.
+ */
+template <class OverflowStrategy>
+using AsynchronousStreamSink = boost::log::sinks::asynchronous_sink<
+    StreamBackend,
+    boost::log::sinks::bounded_fifo_queue<asyncQueueCapacity, OverflowStrategy>>;
+
+/// The preCICE sinks currently registered in the boost.Log core
+struct ActiveSinks {
+  using sink_ptr = typename boost::shared_ptr<boost::log::sinks::sink>;
+
+  std::vector<sink_ptr> sinks;
+
+  /// Stop functions of the asynchronous sinks, which join the feeding threads
+  std::vector<std::function<void()>> stops;
+
+  /// Writes pending records of asynchronous sinks before they are destroyed
+  ~ActiveSinks()
+  {
+    for (auto &sink : sinks) {
+      sink->flush();
+    }
+  }
+};
+
+ActiveSinks &getActiveSinks()
+{
+  static ActiveSinks instance;
+  return instance;
+}
+
+/** Checks if a filter only depends on attributes, which are constant for a logger between configuration changes
+ *
+ * Only then, Logger::enabled() can cache the outcome of the filter per logger.
+ */
+bool isCacheableFilter(std::string const &filter)
+{
+  for (auto attribute : {"%TimeStamp", "%Runtime", "%File", "%Line", "%Function", "%Scope"}) {
+    if (filter.find(attribute) != std::string::npos) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// Invalidates the severities cached by all loggers
+void invalidateEnabledSeverities()
+{
+  impl::filterGeneration.fetch_add(1, std::memory_order_relaxed);
+}
+
 /// Reads a log file, returns a logging configuration.
 LoggingConfiguration readLogConfFile(std::string const &filename)
 {
@@ -164,6 +228,7 @@ const std::string BackendConfiguration::default_filter    = "(%Severity% > debug
 const std::string BackendConfiguration::default_formatter = "(%Rank%) %TimeStamp(format=\"%H:%M:%S\")% [%Module%]:%Line% in %Function%: %ColorizedSeverity%%Message%";
 const std::string BackendConfiguration::default_type      = "stream";
 const std::string BackendConfiguration::default_output    = "stdout";
+const std::string BackendConfiguration::default_overflow  = "block";
 
 void BackendConfiguration::setOption(std::string key, std::string value)
 {
@@ -178,12 +243,23 @@ void BackendConfiguration::setOption(std::string key, std::string value)
     filter = value;
   if (key == "format")
     format = value;
+  if (key == "overflow") {
+    boost::algorithm::to_lower(value);
+    logging::Logger _log{"logging::BackendConfiguration"};
+    PRECICE_CHECK(value == "block" || value == "drop",
+                  "Unknown overflow strategy \"{}\" of a log sink. Use \"block\" or \"drop\".", value);
+    overflow = value;
+  }
+  if (key == "asynchronous") {
+    boost::algorithm::to_lower(value);
+    asynchronous = (value == "true" || value == "1" || value == "yes");
+  }
 }
 
 bool BackendConfiguration::isValidOption(std::string key)
 {
   boost::algorithm::to_lower(key);
-  return key == "output" || key == "filter" || key == "format" || key == "type";
+  return key == "output" || key == "filter" || key == "format" || key == "type" || key == "overflow" || key == "asynchronous";
 }
 
 void BackendConfiguration::setEnabled(bool enabled)
@@ -191,11 +267,22 @@ void BackendConfiguration::setEnabled(bool enabled)
   this->enabled = enabled;
 }
 
+void BackendConfiguration::setAsynchronous(bool asynchronous)
+{
+  this->asynchronous = asynchronous;
+}
+
 void setupLogging(LoggingConfiguration configs, bool enabled)
 {
   if (getGlobalLoggingConfig().locked)
     return;
 
+  // Sinks of the application may use any filter
+  getGlobalLoggingConfig().cacheableFilters = enabled && std::all_of(configs.begin(), configs.end(), [](const auto &config) {
+    return !config.enabled || isCacheableFilter(config.filter);
+  });
+  invalidateEnabledSeverities();
+
   namespace bl = boost::log;
   bl::register_formatter_factory("TimeStamp", boost::make_shared<timestamp_formatter_factory>());
   bl::register_formatter_factory("ColorizedSeverity", boost::make_shared<colorized_severity_formatter_factory>());
@@ -214,15 +301,20 @@ void setupLogging(LoggingConfiguration configs, bool enabled)
       << bl::expressions::message;
 
   // Remove active preCICE sinks
-  using sink_ptr = typename boost::shared_ptr<boost::log::sinks::sink>;
-
-  static std::vector<sink_ptr> activeSinks;
+  auto &activeSinks = getActiveSinks().sinks;
   for (auto &sink : activeSinks) {
     boost::log::core::get()->remove_sink(sink);
+  }
+  // Asynchronous sinks stop their feeding thread before writing the remaining records
+  for (auto &stop : getActiveSinks().stops) {
+    stop();
+  }
+  for (auto &sink : activeSinks) {
     sink->flush();
     sink.reset();
   }
   activeSinks.clear();
+  getActiveSinks().stops.clear();
 
   // If logging sinks are disabled, then we need to disable the default sink.
   // We do this by adding a NullSink.
@@ -261,18 +353,43 @@ void setupLogging(LoggingConfiguration configs, bool enabled)
     backend->auto_flush(true);
 
     // Setup sink
-    auto sink = boost::make_shared<boost::log::sinks::synchronous_sink<StreamBackend>>(backend);
-    sink->set_formatter(boost::log::parse_formatter(config.format));
+    auto setupSink = [&config, &activeSinks](auto &sink) {
+      sink->set_formatter(boost::log::parse_formatter(config.format));
 
-    if (config.filter.empty()) {
-      sink->set_filter(boost::log::expressions::attr<bool>("preCICE") == true);
+      if (config.filter.empty()) {
+        sink->set_filter(boost::log::expressions::attr<bool>("preCICE") == true);
+      } else {
+        // We extend the filter here to filter all log entries not originating from preCICE.
+        sink->set_filter(boost::log::parse_filter("%preCICE% & ( " + config.filter + " )"));
+      }
+
+      boost::log::core::get()->add_sink(sink);
+      activeSinks.emplace_back(sink);
+    };
+
+    if (!config.asynchronous) {
+      auto sink = boost::make_shared<boost::log::sinks::synchronous_sink<StreamBackend>>(backend);
+      setupSink(sink);
+      continue;
+    }
+
+    auto setupAsynchronousSink = [&](auto sink) {
+      setupSink(sink);
+      getActiveSinks().stops.emplace_back([sink] { sink->stop(); });
+    };
+    if (config.overflow == "drop") {
+      setupAsynchronousSink(boost::make_shared<AsynchronousStreamSink<boost::log::sinks::drop_on_overflow>>(backend));
     } else {
-      // We extend the filter here to filter all log entries not originating from preCICE.
-      sink->set_filter(boost::log::parse_filter("%preCICE% & ( " + config.filter + " )"));
+      PRECICE_ASSERT(config.overflow == "block", config.overflow);
+      setupAsynchronousSink(boost::make_shared<AsynchronousStreamSink<boost::log::sinks::block_on_overflow>>(backend));
     }
+  }
+}
 
-    boost::log::core::get()->add_sink(sink);
-    activeSinks.emplace_back(std::move(sink));
+void flushLogging()
+{
+  for (auto &sink : getActiveSinks().sinks) {
+    sink->flush();
   }
 }
 
@@ -284,11 +401,13 @@ void setupLogging(std::string const &logConfigFile)
 void setMPIRank(int const rank)
 {
   getGlobalLoggingConfig().rank = rank;
+  invalidateEnabledSeverities();
 }
 
 void setParticipant(std::string const &participant)
 {
   getGlobalLoggingConfig().participant = participant;
+  invalidateEnabledSeverities();
 }
 
 GlobalLoggingConfig &getGlobalLoggingConfig()
@@ -12,12 +12,15 @@ struct BackendConfiguration {
   static const std::string default_output;
   static const std::string default_filter;
   static const std::string default_formatter;
+  static const std::string default_overflow;
 
-  std::string type    = default_type;
-  std::string output  = default_output;
-  std::string filter  = default_filter;
-  std::string format  = default_formatter;
-  bool        enabled = true;
+  std::string type         = default_type;
+  std::string output       = default_output;
+  std::string filter       = default_filter;
+  std::string format       = default_formatter;
+  std::string overflow     = default_overflow;
+  bool        enabled      = true;
+  bool        asynchronous = false;
 
   /// Sets on option, overwrites default values.
   void setOption(std::string key, std::string value);
@@ -27,6 +30,9 @@ struct BackendConfiguration {
 
   /// Sets weather the sink is enabled or disabled
   void setEnabled(bool enabled);
+
+  /// Sets whether the sink writes records from a background thread
+  void setAsynchronous(bool asynchronous);
 };
 
 /// Holds the configuration of the logging system
@@ -41,6 +47,12 @@ void setupLogging(std::string const &logConfigFile = "log.conf");
 /// Configures the logging from a LoggingConfiguration
 void setupLogging(LoggingConfiguration configs, bool enabled = true);
 
+/** Flushes all active sinks
+ *
+ * Asynchronous sinks write all records queued so far before this returns.
+ */
+void flushLogging();
+
 /// Sets the current MPI rank as a logging attribute
 /// @see GlobalLoggingConfig
 void setMPIRank(int const rank);
@@ -58,6 +70,8 @@ struct GlobalLoggingConfig {
   std::string participant{""};
   int         rank{-1};
   bool        locked{false};
+  /// Do the filters of all sinks only depend on attributes, which are constant per logger?
+  bool cacheableFilters{false};
 };
 
 /// Returns the global logging configuration
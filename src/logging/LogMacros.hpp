@@ -9,9 +9,40 @@
     __FILE__, __LINE__, __func__ \
   }
 
-#define PRECICE_WARN(...) _log.warning(PRECICE_LOG_LOCATION, precice::utils::format_or_error(__VA_ARGS__))
+// Log levels below PRECICE_COMPILED_LOG_LEVEL are removed at compile time.
+// The levels are 0 (trace), 1 (debug), 2 (info), and 3 (warning); warnings and errors are never removed.
+// Use the CMake option PRECICE_COMPILED_LOG_LEVEL to set it.
 
-#define PRECICE_INFO(...) _log.info(PRECICE_LOG_LOCATION, precice::utils::format_or_error(__VA_ARGS__))
+#ifndef PRECICE_COMPILED_LOG_LEVEL
+#define PRECICE_COMPILED_LOG_LEVEL 0
+#endif
+
+// The messages are only formatted if the logger may emit them, see Logger::enabled()
+
+#define PRECICE_WARN(...)                                                                \
+  do {                                                                                   \
+    if (_log.enabled(::precice::logging::Severity::Warning)) {                           \
+      _log.warning(PRECICE_LOG_LOCATION, precice::utils::format_or_error(__VA_ARGS__)); \
+    }                                                                                    \
+  } while (false)
+
+#if PRECICE_COMPILED_LOG_LEVEL > 2
+
+#include "utils/ignore.hpp"
+
+#define PRECICE_INFO(...) \
+  ::precice::utils::ignore(__VA_ARGS__)
+
+#else // PRECICE_COMPILED_LOG_LEVEL > 2
+
+#define PRECICE_INFO(...)                                                             \
+  do {                                                                                \
+    if (_log.enabled(::precice::logging::Severity::Info)) {                           \
+      _log.info(PRECICE_LOG_LOCATION, precice::utils::format_or_error(__VA_ARGS__)); \
+    }                                                                                 \
+  } while (false)
+
+#endif // PRECICE_COMPILED_LOG_LEVEL > 2
 
 #define PRECICE_ERROR(...) ::precice::logging::logErrorAndThrow<::precice::Error>(_log, PRECICE_LOG_LOCATION, precice::utils::format_or_error(__VA_ARGS__))
 
@@ -39,7 +70,7 @@
 // Debug logging is disabled in release (NDEBUG) builds by default.
 // To enable it anyhow, enable the CMake option PRECICE_RELEASE_WITH_DEBUG_LOG.
 
-#if defined(NDEBUG) && !defined(PRECICE_RELEASE_WITH_DEBUG_LOG)
+#if (defined(NDEBUG) && !defined(PRECICE_RELEASE_WITH_DEBUG_LOG)) || PRECICE_COMPILED_LOG_LEVEL > 1
 #define PRECICE_NO_DEBUG_LOG
 #endif
 
@@ -58,7 +89,12 @@
 
 #else // PRECICE_NO_DEBUG_LOG
 
-#define PRECICE_DEBUG(...) _log.debug(PRECICE_LOG_LOCATION, precice::utils::format_or_error(__VA_ARGS__))
+#define PRECICE_DEBUG(...)                                                             \
+  do {                                                                                 \
+    if (_log.enabled(::precice::logging::Severity::Debug)) {                           \
+      _log.debug(PRECICE_LOG_LOCATION, precice::utils::format_or_error(__VA_ARGS__)); \
+    }                                                                                  \
+  } while (false)
 
 #define PRECICE_DEBUG_IF(condition, ...) \
   do {                                   \
@@ -72,7 +108,7 @@
 // Trace logging is disabled in release (NDEBUG) builds by default.
 // To enable it anyhow, enable the CMake option PRECICE_RELEASE_WITH_TRACE_LOG.
 
-#if defined(NDEBUG) && !defined(PRECICE_RELEASE_WITH_TRACE_LOG)
+#if (defined(NDEBUG) && !defined(PRECICE_RELEASE_WITH_TRACE_LOG)) || PRECICE_COMPILED_LOG_LEVEL > 0
 #define PRECICE_NO_TRACE_LOG
 #endif
 
@@ -89,8 +125,10 @@
 #include "utils/ArgumentFormatter.hpp"
 
 // Do not put do {...} while (false) here, it will destroy the _tracer_ right after creation
-#define PRECICE_TRACE(...)                                       \
-  precice::logging::Tracer _tracer_(_log, PRECICE_LOG_LOCATION); \
-  _log.trace(PRECICE_LOG_LOCATION, std::string{"Entering "} + __func__ + PRECICE_LOG_ARGUMENTS(__VA_ARGS__))
+#define PRECICE_TRACE(...)                                                                                        \
+  precice::logging::Tracer _tracer_(_log, PRECICE_LOG_LOCATION);                                                  \
+  if (_log.enabled(::precice::logging::Severity::Trace)) {                                                        \
+    _log.trace(PRECICE_LOG_LOCATION, std::string{"Entering "} + __func__ + PRECICE_LOG_ARGUMENTS(__VA_ARGS__)); \
+  }
 
 #endif // ! PRECICE_NO_TRACE_LOG
@@ -2,6 +2,7 @@
 #include <boost/log/attributes/function.hpp>
 #include <boost/log/attributes/named_scope.hpp>
 #include <boost/log/attributes/timer.hpp>
+#include <boost/log/core.hpp>
 #include <boost/log/sources/severity_feature.hpp>
 #include <boost/log/trivial.hpp>
 #include <boost/log/utility/setup/common_attributes.hpp>
@@ -137,7 +138,10 @@ Logger::Logger(const Logger &other)
 {
 }
 
-Logger::Logger(Logger &&other) noexcept = default;
+Logger::Logger(Logger &&other) noexcept
+    : _impl(std::move(other._impl))
+{
+}
 
 Logger &Logger::operator=(Logger other)
 {
@@ -148,6 +152,36 @@ Logger &Logger::operator=(Logger other)
 void Logger::swap(Logger &other) noexcept
 {
   _impl.swap(other._impl);
+  _enabled.store(0, std::memory_order_relaxed);
+  other._enabled.store(0, std::memory_order_relaxed);
+}
+
+std::uint32_t Logger::updateEnabled() const noexcept
+{
+  // Read the generation first, a concurrent change of the configuration invalidates the result right away
+  const std::uint32_t generation = impl::filterGeneration.load(std::memory_order_relaxed);
+  std::uint32_t       mask       = 0b11111;
+
+  if (getGlobalLoggingConfig().cacheableFilters) {
+    try {
+      // Open a record with the attributes of this logger for every severity, but never push it
+      auto attributes = _impl->get_attributes();
+      auto core       = boost::log::core::get();
+      for (unsigned severity = 0; severity <= static_cast<unsigned>(Severity::Error); ++severity) {
+        attributes["Severity"] = boost::log::attributes::constant<boost::log::trivial::severity_level>(
+            static_cast<boost::log::trivial::severity_level>(severity));
+        if (!core->open_record(attributes)) {
+          mask &= ~(1u << severity);
+        }
+      }
+    } catch (...) {
+      mask = 0b11111;
+    }
+  }
+
+  const std::uint32_t cached = (generation << 8) | mask;
+  _enabled.store(cached, std::memory_order_relaxed);
+  return cached;
 }
 
 /// Convenience macro that automatically passes \ref LogLocation info to the logger
@@ -158,6 +192,8 @@ void Logger::error(LogLocation loc, std::string_view mess) noexcept
 {
   try {
     PRECICE_LOG_IMPL(*_impl, boost::log::trivial::severity_level::error, loc) << mess;
+    // Errors are fatal, so write the queued records of asynchronous sinks now
+    flushLogging();
   } catch (...) {
   }
 }
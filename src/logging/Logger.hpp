@@ -1,5 +1,7 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -13,6 +15,24 @@ struct LogLocation {
   const char *func;
 };
 
+/// The severities of log entries in increasing order, matching boost::log::trivial::severity_level
+enum class Severity : std::uint8_t {
+  Trace,
+  Debug,
+  Info,
+  Warning,
+  Error
+};
+
+namespace impl {
+/** Generation of the sink filters
+ *
+ * Incremented whenever the outcome of the filters may change, which invalidates the cached severities of all loggers.
+ * @see Logger::enabled()
+ */
+inline std::atomic<std::uint32_t> filterGeneration{1};
+} // namespace impl
+
 /// This class provides a lightweight logger.
 class Logger {
 public:
@@ -28,6 +48,21 @@ public:
 
   void swap(Logger &other) noexcept;
 
+  /** Checks if a log entry of the given severity may pass the filter of any sink
+   *
+   * This allows to skip formatting messages, which would be discarded anyhow.
+   * The result is cached per logger until the logging configuration, the rank, or the participant changes.
+   * If the filters depend on the location of the log entry, this is always true.
+   */
+  bool enabled(Severity severity) const noexcept
+  {
+    auto cached = _enabled.load(std::memory_order_relaxed);
+    if ((cached >> 8) != impl::filterGeneration.load(std::memory_order_relaxed)) {
+      cached = updateEnabled();
+    }
+    return cached & (1u << static_cast<unsigned>(severity));
+  }
+
   ///@name Logging operations
   ///@{
   void error(LogLocation loc, std::string_view mess) noexcept;
@@ -43,6 +78,12 @@ private:
 
   /// Pimpl to the logger implementation
   std::unique_ptr<LoggerImpl> _impl;
+
+  /// The filter generation in the upper 24 bits and a bit per enabled Severity in the lower 8 bits
+  mutable std::atomic<std::uint32_t> _enabled{0};
+
+  /// Evaluates the sink filters for every Severity and caches the result in _enabled
+  std::uint32_t updateEnabled() const noexcept;
 };
 
 /// Utility function to log an error and throw an exception of given type
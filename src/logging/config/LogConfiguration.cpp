@@ -51,6 +51,18 @@ LogConfiguration::LogConfiguration(
                          .setDocumentation("Enables the sink");
   tagSink.addAttribute(attrEnabled);
 
+  auto attrAsynchronous = makeXMLAttribute("asynchronous", false)
+                              .setDocumentation("Formats and writes the log entries in a background thread, which keeps slow outputs, such as files on shared file systems, off the solver thread. "
+                                                "Pending entries are written at the latest in finalize() and when an error occurs.");
+  tagSink.addAttribute(attrAsynchronous);
+
+  auto attrOverflow = XMLAttribute<std::string>("overflow")
+                          .setDocumentation("Defines what happens if the queue of an asynchronous sink is full. "
+                                            "`block` waits until there is space in the queue, `drop` discards the log entry.")
+                          .setOptions({"block", "drop"})
+                          .setDefaultValue(precice::logging::BackendConfiguration::default_overflow);
+  tagSink.addAttribute(attrOverflow);
+
   tagLog.addSubtag(tagSink);
   parent.addSubtag(tagLog);
 }
@@ -67,7 +79,9 @@ void LogConfiguration::xmlTagCallback(
     config.setOption("output", tag.getStringAttributeValue("output"));
     config.setOption("filter", tag.getStringAttributeValue("filter"));
     config.setOption("format", tag.getStringAttributeValue("format"));
+    config.setOption("overflow", tag.getStringAttributeValue("overflow"));
     config.setEnabled(tag.getBooleanAttributeValue("enabled"));
+    config.setAsynchronous(tag.getBooleanAttributeValue("asynchronous"));
     _logconfig.push_back(config);
   }
 }
@@ -0,0 +1,166 @@
+#include <fcntl.h>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+#include "logging/LogConfiguration.hpp"
+#include "logging/LogMacros.hpp"
+#include "logging/Logger.hpp"
+#include "logging/config/LogConfiguration.hpp"
+#include "precice/Exceptions.hpp"
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+#include "xml/XMLTag.hpp"
+
+using namespace precice;
+using namespace precice::logging;
+
+namespace {
+/// Replaces the sinks of the test runner until destruction
+struct ScopedLogging {
+  ScopedLogging()
+  {
+    getGlobalLoggingConfig().locked = false;
+  }
+
+  explicit ScopedLogging(LoggingConfiguration configs)
+      : ScopedLogging()
+  {
+    setupLogging(std::move(configs));
+  }
+
+  ~ScopedLogging()
+  {
+    getGlobalLoggingConfig().locked = false;
+    testing::setupTestLogging();
+  }
+};
+
+std::vector<std::string> readLines(std::string const &filename)
+{
+  std::ifstream            file(filename);
+  std::vector<std::string> lines;
+  for (std::string line; std::getline(file, line);) {
+    lines.push_back(line);
+  }
+  return lines;
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(LoggingTests)
+BOOST_AUTO_TEST_SUITE(LogConfigurationTests)
+
+BOOST_AUTO_TEST_CASE(AsynchronousFileSink)
+{
+  PRECICE_TEST(1_rank);
+  const std::string filename = "async-file-sink.log";
+
+  BackendConfiguration config;
+  config.type         = "file";
+  config.output       = filename;
+  config.filter       = "%Severity% >= info";
+  config.format       = "%Message%";
+  config.asynchronous = true;
+
+  const std::size_t entries = 1000;
+  {
+    ScopedLogging scope{LoggingConfiguration{config}};
+    Logger        log{"testing"};
+
+    for (std::size_t i = 0; i < entries; ++i) {
+      log.info(PRECICE_LOG_LOCATION, std::to_string(i));
+    }
+    // All queued records are written once the flush returns
+    flushLogging();
+    const auto lines = readLines(filename);
+    BOOST_TEST_REQUIRE(lines.size() == entries);
+    for (std::size_t i = 0; i < entries; ++i) {
+      BOOST_TEST(lines[i] == std::to_string(i));
+    }
+
+    for (std::size_t i = entries; i < 2 * entries; ++i) {
+      log.info(PRECICE_LOG_LOCATION, std::to_string(i));
+    }
+  }
+
+  // Replacing the sink, as in finalize(), writes the remaining records
+  const auto lines = readLines(filename);
+  BOOST_TEST_REQUIRE(lines.size() == 2 * entries);
+  BOOST_TEST(lines.back() == std::to_string(2 * entries - 1));
+}
+
+BOOST_AUTO_TEST_CASE(DropOnOverflow)
+{
+  PRECICE_TEST(1_rank);
+  // The sink writes to a pipe, which is not read while logging. Once the pipe is full,
+  // the writing thread blocks and the queue of the sink has to overflow.
+  const std::string filename = "async-drop-sink.log";
+  std::filesystem::remove(filename);
+  BOOST_TEST_REQUIRE(mkfifo(filename.c_str(), S_IRUSR | S_IWUSR) == 0);
+  const int pipe = open(filename.c_str(), O_RDONLY | O_NONBLOCK);
+  BOOST_TEST_REQUIRE(pipe != -1);
+
+  const std::size_t entries = 10000;
+  const std::string padding(100, '-');
+  std::string       output;
+  std::thread       reader;
+  {
+    ScopedLogging scope;
+
+    xml::XMLTag              tag = xml::getRootTag();
+    config::LogConfiguration logConfig(tag);
+    xml::configure(tag, xml::ConfigurationContext{}, testing::getPathToSources() + "/logging/tests/async-drop-sink.xml");
+
+    Logger log{"testing"};
+    for (std::size_t i = 0; i < entries; ++i) {
+      log.info(PRECICE_LOG_LOCATION, std::to_string(i) + padding);
+    }
+
+    reader = std::thread([pipe, &output] {
+      fcntl(pipe, F_SETFL, 0);
+      char    buffer[4096];
+      ssize_t count = 0;
+      while ((count = read(pipe, buffer, sizeof(buffer))) > 0) {
+        output.append(buffer, count);
+      }
+    });
+    flushLogging();
+  }
+  // Replacing the sink closed the pipe
+  reader.join();
+  close(pipe);
+  std::filesystem::remove(filename);
+
+  std::vector<std::string> lines;
+  std::istringstream       stream(output);
+  for (std::string line; std::getline(stream, line);) {
+    lines.push_back(line);
+  }
+  BOOST_TEST_REQUIRE(!lines.empty());
+  BOOST_TEST(lines.size() < entries);
+  BOOST_TEST(lines.front() == "0" + padding);
+  // Dropped entries leave gaps, but the written entries are complete and in order
+  for (std::size_t i = 1; i < lines.size(); ++i) {
+    BOOST_TEST(lines[i].size() > padding.size());
+    BOOST_TEST(lines[i].substr(lines[i].size() - padding.size()) == padding);
+    BOOST_TEST(std::stoul(lines[i - 1]) < std::stoul(lines[i]));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(UnknownOverflow)
+{
+  PRECICE_TEST(1_rank);
+  BackendConfiguration config;
+  config.setOption("overflow", "Drop");
+  BOOST_TEST(config.overflow == "drop");
+  BOOST_CHECK_THROW(config.setOption("overflow", "wait"), ::precice::Error);
+  BOOST_TEST(config.overflow == "drop");
+}
+
+BOOST_AUTO_TEST_SUITE_END() // LogConfigurationTests
+BOOST_AUTO_TEST_SUITE_END() // LoggingTests
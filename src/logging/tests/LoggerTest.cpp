@@ -0,0 +1,87 @@
+#include <chrono>
+#include <string>
+#include "logging/LogConfiguration.hpp"
+#include "logging/LogMacros.hpp"
+#include "logging/Logger.hpp"
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice;
+using namespace precice::logging;
+
+namespace {
+/// Number of evaluated arguments of traced iterations
+int evaluatedArguments = 0;
+
+double countEvaluation(double residual)
+{
+  ++evaluatedArguments;
+  return residual;
+}
+
+/// An iteration, which traces its arguments like the functions of preCICE
+void tracedIteration([[maybe_unused]] Logger &_log, int i, double residual)
+{
+  PRECICE_TRACE(i, countEvaluation(residual));
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(LoggingTests)
+BOOST_AUTO_TEST_SUITE(LoggerTests)
+
+BOOST_AUTO_TEST_CASE(EnabledSeverities)
+{
+  PRECICE_TEST(1_rank);
+  Logger log{"testing"};
+
+  // All test sinks accept warnings and errors
+  BOOST_TEST(log.enabled(Severity::Warning));
+  BOOST_TEST(log.enabled(Severity::Error));
+
+  if (getGlobalLoggingConfig().cacheableFilters && readLogConfFile("log.conf").empty()) {
+    // The test sinks never accept trace entries, see setupTestLogging()
+    BOOST_TEST(!log.enabled(Severity::Trace));
+    BOOST_TEST(log.enabled(Severity::Debug));
+  }
+
+  // Copies and moved loggers evaluate the filters again
+  Logger copy{log};
+  BOOST_TEST(copy.enabled(Severity::Error));
+  Logger moved{std::move(copy)};
+  BOOST_TEST(moved.enabled(Severity::Error));
+}
+
+/// A tight loop of log entries, which are discarded by all sinks, as found in iterative solvers
+BOOST_AUTO_TEST_CASE(FilteredLoopBenchmark)
+{
+  PRECICE_TEST(1_rank);
+  Logger log{"testing"};
+
+  const int repetitions = 100000;
+
+  using Clock      = std::chrono::steady_clock;
+  const auto start = Clock::now();
+  for (int i = 0; i < repetitions; ++i) {
+    const double residual = 1.0 / (i + 1);
+    log.trace(PRECICE_LOG_LOCATION, precice::utils::format_or_error("Iteration {}, residual {}", i, residual));
+  }
+  evaluatedArguments = 0;
+  const auto middle  = Clock::now();
+  for (int i = 0; i < repetitions; ++i) {
+    tracedIteration(log, i, 1.0 / (i + 1));
+  }
+  const auto end = Clock::now();
+
+#ifndef PRECICE_NO_TRACE_LOG
+  // The arguments of discarded entries are never evaluated
+  BOOST_TEST(evaluatedArguments == (log.enabled(Severity::Trace) ? repetitions : 0));
+#endif
+
+  const std::chrono::duration<double, std::nano> eagerTime = middle - start;
+  const std::chrono::duration<double, std::nano> lazyTime  = end - middle;
+  BOOST_TEST_MESSAGE("Discarded log entry: formatted " << eagerTime.count() / repetitions << "ns, "
+                                                       << "checked first " << lazyTime.count() / repetitions << "ns");
+}
+
+BOOST_AUTO_TEST_SUITE_END() // LoggerTests
+BOOST_AUTO_TEST_SUITE_END() // LoggingTests
@@ -125,8 +125,8 @@ public:
    */
   virtual void broadcastReceiveAll(std::vector<int> &itemToReceive) = 0;
 
-  /// Broadcasts a mesh to connected ranks on remote participant
-  virtual void broadcastSendMesh() = 0;
+  /// Broadcasts a mesh to connected ranks on remote participant, optionally compressed
+  virtual void broadcastSendMesh(bool compress) = 0;
 
   /// Receive mesh partitions per connected rank on remote participant
   virtual void broadcastReceiveAllMesh() = 0;
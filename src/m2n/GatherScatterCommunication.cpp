@@ -230,7 +230,7 @@ void GatherScatterCommunication::broadcastReceiveAll(std::vector<int> &itemToRec
   PRECICE_ASSERT(false, "Not available for GatherScatterCommunication.");
 }
 
-void GatherScatterCommunication::broadcastSendMesh()
+void GatherScatterCommunication::broadcastSendMesh(bool compress)
 {
   PRECICE_ASSERT(false, "Not available for GatherScatterCommunication.");
 }
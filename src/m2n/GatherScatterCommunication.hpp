@@ -97,7 +97,7 @@ public:
   void broadcastReceiveAll(std::vector<int> &itemToReceive) override;
 
   /// Broadcasts a mesh to connected ranks on remote participant. Not available for GatherScatterCommunication.
-  void broadcastSendMesh() override;
+  void broadcastSendMesh(bool compress) override;
 
   /// Receive mesh partitions per connected rank on remote participant. Not available for GatherScatterCommunication.
   void broadcastReceiveAllMesh() override;
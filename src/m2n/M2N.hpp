@@ -30,7 +30,7 @@ struct WhiteboxAccessor;
  */
 class M2N {
 public:
-  M2N(com::PtrCommunication intraComm, DistributedComFactory::SharedPointer distrFactory, bool useOnlyPrimaryCom = false, bool useTwoLevelInit = false);
+  M2N(com::PtrCommunication intraComm, DistributedComFactory::SharedPointer distrFactory, bool useOnlyPrimaryCom = false, bool useTwoLevelInit = false, bool compressMeshes = false);
 
   /// Destructor, empty.
   ~M2N();
@@ -175,7 +175,7 @@ public:
    */
   void send(int itemToSend);
 
-  /// Broadcasts a mesh to connected ranks on remote participant (concerning the given mesh)
+  /// Broadcasts a mesh to connected ranks on remote participant (concerning the given mesh), compressed if configured
   void broadcastSendMesh(mesh::Mesh &mesh);
 
   /// Scatters a communication map over connected ranks on remote participant (concerning the given mesh)
@@ -220,6 +220,12 @@ public:
     return _useTwoLevelInit;
   }
 
+  /// Returns true, if meshes exchanged via this M2N and distributed among the ranks of the receiver are compressed
+  bool usesMeshCompression() const
+  {
+    return _compressMeshes;
+  }
+
 private:
   logging::Logger _log{"m2n::M2N"};
 
@@ -249,6 +255,9 @@ private:
   /// use the two-level initialization concept
   bool _useTwoLevelInit = false;
 
+  /// send meshes between the primary ranks with delta encoded ids and connectivity
+  bool _compressMeshes = false;
+
   // @brief To allow access to _useOnlyPrimaryCom
   friend struct WhiteboxAccessor;
 };
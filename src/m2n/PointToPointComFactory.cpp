@@ -8,13 +8,13 @@
 
 namespace precice::m2n {
 
-PointToPointComFactory::PointToPointComFactory(com::PtrCommunicationFactory comFactory)
-    : _comFactory(std::move(comFactory)) {}
+PointToPointComFactory::PointToPointComFactory(com::PtrCommunicationFactory comFactory, bool useAddressTable)
+    : _comFactory(std::move(comFactory)), _useAddressTable(useAddressTable) {}
 
 DistributedCommunication::SharedPointer
 PointToPointComFactory::newDistributedCommunication(mesh::PtrMesh mesh)
 {
-  return DistributedCommunication::SharedPointer(new PointToPointCommunication(_comFactory, mesh));
+  return DistributedCommunication::SharedPointer(new PointToPointCommunication(_comFactory, mesh, _useAddressTable));
 }
 
 } // namespace precice::m2n
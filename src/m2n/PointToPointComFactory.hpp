@@ -11,7 +11,7 @@ namespace m2n {
 class PointToPointComFactory : public DistributedComFactory {
 
 public:
-  explicit PointToPointComFactory(com::PtrCommunicationFactory comFactory);
+  explicit PointToPointComFactory(com::PtrCommunicationFactory comFactory, bool useAddressTable = false);
 
   DistributedCommunication::SharedPointer newDistributedCommunication(
       mesh::PtrMesh mesh);
@@ -19,6 +19,9 @@ public:
 private:
   /// communication factory for 1:M communications
   com::PtrCommunicationFactory _comFactory;
+
+  /// Exchange the addresses of all ranks in one table between the primary ranks?
+  bool _useAddressTable;
 };
 
 } // namespace m2n
@@ -1,12 +1,14 @@
 #include <algorithm>
 #include <boost/container/flat_map.hpp>
 #include <boost/io/ios_state.hpp>
+#include <cstring>
 #include <functional>
 #include <iomanip>
 #include <iostream>
 #include <limits>
 #include <map>
 #include <set>
+#include <string>
 #include <thread>
 #include <utility>
 #include <vector>
@@ -97,6 +99,64 @@ void broadcast(mesh::Mesh::VertexDistribution &m)
   }
 }
 
+namespace {
+
+/// Packs the characters of an address into integers, led by the number of characters
+std::vector<int> packAddress(std::string const &address)
+{
+  std::vector<int> packed(1 + (address.size() + sizeof(int) - 1) / sizeof(int), 0);
+  packed.front() = static_cast<int>(address.size());
+  std::memcpy(packed.data() + 1, address.data(), address.size());
+  return packed;
+}
+
+/**
+ * @brief Gathers the addresses of all acceptor ranks and sends them as one table to the requester.
+ *
+ * Collective on all acceptor ranks, only the primary rank sends via the given primary communication.
+ */
+void sendAddressTable(std::string const &address, const com::PtrCommunication &primaryCom)
+{
+  auto packed = packAddress(address);
+  if (utils::IntraComm::isSecondary()) {
+    utils::IntraComm::getCommunication()->gather(packed, 0);
+    return;
+  }
+
+  std::vector<int> table = packed;
+  if (utils::IntraComm::isPrimary()) {
+    std::vector<int> counts;
+    utils::IntraComm::getCommunication()->gather(packed, table, counts);
+  }
+  primaryCom->sendRange(table, 0);
+}
+
+/**
+ * @brief Receives the address table on the primary rank and broadcasts it to all requester ranks.
+ *
+ * @returns the address of each acceptor rank, which is empty for ranks without connections
+ */
+std::vector<std::string> receiveAddressTable(const com::PtrCommunication &primaryCom)
+{
+  std::vector<int> table;
+  if (utils::IntraComm::isSecondary()) {
+    utils::IntraComm::getCommunication()->broadcast(table, 0);
+  } else {
+    table = primaryCom->receiveRange(0, com::asVector<int>);
+    if (utils::IntraComm::isPrimary()) {
+      utils::IntraComm::getCommunication()->broadcast(table);
+    }
+  }
+
+  std::vector<std::string> addresses;
+  for (std::size_t i = 0; i < table.size(); i += 1 + (table[i] + sizeof(int) - 1) / sizeof(int)) {
+    addresses.emplace_back(reinterpret_cast<const char *>(&table[i + 1]), table[i]);
+  }
+  return addresses;
+}
+
+} // namespace
+
 void print(std::map<int, std::vector<int>> const &m)
 {
   std::ostringstream oss;
@@ -307,9 +367,11 @@ std::map<int, std::vector<int>> buildCommunicationMap(
 
 PointToPointCommunication::PointToPointCommunication(
     com::PtrCommunicationFactory communicationFactory,
-    mesh::PtrMesh                mesh)
+    mesh::PtrMesh                mesh,
+    bool                         useAddressTable)
     : DistributedCommunication(std::move(mesh)),
-      _communicationFactory(std::move(communicationFactory))
+      _communicationFactory(std::move(communicationFactory)),
+      _useAddressTable(useAddressTable)
 {
 }
 
@@ -333,11 +395,13 @@ void PointToPointCommunication::acceptConnection(std::string const &acceptorName
   mesh::Mesh::VertexDistribution vertexDistribution = _mesh->getVertexDistribution();
   mesh::Mesh::VertexDistribution requesterVertexDistribution;
 
+  // Connection between participants' primary processes, which is kept open to send the address table
+  com::PtrCommunication c;
   if (not utils::IntraComm::isSecondary()) {
     PRECICE_DEBUG("Exchange vertex distribution between both primary ranks");
     Event e0("m2n.exchangeVertexDistribution");
     // Establish connection between participants' primary processes.
-    auto c = _communicationFactory->newCommunication();
+    c = _communicationFactory->newCommunication();
 
     c->acceptConnection(acceptorName, requesterName, "TMP-PRIMARYCOM-" + _mesh->getName(), utils::IntraComm::getRank());
 
@@ -390,6 +454,19 @@ void PointToPointCommunication::acceptConnection(std::string const &acceptorName
   printLocalIndexCountStats(communicationMap);
 #endif
 
+  if (_useAddressTable) {
+    PRECICE_DEBUG("Listen for connections and send the address table");
+    Event       e3("m2n.exchangeAddressTable");
+    std::string address;
+    if (not communicationMap.empty()) {
+      _communication = _communicationFactory->newCommunication();
+      PRECICE_ASSERT(_communication->supportsAddressTable());
+      address = _communication->listenAsServer();
+    }
+    sendAddressTable(address, c);
+  }
+  c.reset();
+
   Event e4("m2n.createCommunications");
   e4.addData("Connections", communicationMap.size());
   if (communicationMap.empty()) {
@@ -398,7 +475,10 @@ void PointToPointCommunication::acceptConnection(std::string const &acceptorName
   }
 
   PRECICE_DEBUG("Create and connect communication");
-  _communication = _communicationFactory->newCommunication();
+  // With an address table, the communication is already listening
+  if (not _useAddressTable) {
+    _communication = _communicationFactory->newCommunication();
+  }
 
   // Accept point-to-point connections (as server) between the current acceptor
   // process (in the current participant) with rank `utils::IntraComm::getRank()'
@@ -460,11 +540,13 @@ void PointToPointCommunication::requestConnection(std::string const &acceptorNam
   mesh::Mesh::VertexDistribution vertexDistribution = _mesh->getVertexDistribution();
   mesh::Mesh::VertexDistribution acceptorVertexDistribution;
 
+  // Connection between participants' primary processes, which is kept open to receive the address table
+  com::PtrCommunication c;
   if (not utils::IntraComm::isSecondary()) {
     PRECICE_DEBUG("Exchange vertex distribution between both primary ranks");
     Event e0("m2n.exchangeVertexDistribution");
     // Establish connection between participants' primary processes.
-    auto c = _communicationFactory->newCommunication();
+    c = _communicationFactory->newCommunication();
     c->requestConnection(acceptorName, requesterName,
                          "TMP-PRIMARYCOM-" + _mesh->getName(),
                          0, 1);
@@ -518,6 +600,14 @@ void PointToPointCommunication::requestConnection(std::string const &acceptorNam
   printLocalIndexCountStats(communicationMap);
 #endif
 
+  std::vector<std::string> acceptorAddresses;
+  if (_useAddressTable) {
+    PRECICE_DEBUG("Receive and broadcast the address table");
+    Event e3("m2n.exchangeAddressTable");
+    acceptorAddresses = receiveAddressTable(c);
+  }
+  c.reset();
+
   Event e4("m2n.createCommunications");
   e4.addData("Connections", communicationMap.size());
   if (communicationMap.empty()) {
@@ -538,9 +628,19 @@ void PointToPointCommunication::requestConnection(std::string const &acceptorNam
   // requester process (in the current participant) and (multiple) acceptor
   // processes (in the acceptor participant) to ranks `accceptingRanks'
   // according to `communicationMap`.
-  _communication->requestConnectionAsClient(acceptorName, requesterName,
-                                            _mesh->getName(),
-                                            acceptingRanks, utils::IntraComm::getRank());
+  if (_useAddressTable) {
+    PRECICE_ASSERT(_communication->supportsAddressTable());
+    std::map<int, std::string> addresses;
+    for (int acceptingRank : acceptingRanks) {
+      PRECICE_ASSERT(not acceptorAddresses.at(acceptingRank).empty(), acceptingRank);
+      addresses.emplace(acceptingRank, acceptorAddresses.at(acceptingRank));
+    }
+    _communication->connectAsClient(addresses, utils::IntraComm::getRank());
+  } else {
+    _communication->requestConnectionAsClient(acceptorName, requesterName,
+                                              _mesh->getName(),
+                                              acceptingRanks, utils::IntraComm::getRank());
+  }
 
   PRECICE_DEBUG("Store communication map");
   for (auto &i : communicationMap) {
@@ -671,10 +771,10 @@ void PointToPointCommunication::broadcastReceiveAll(std::vector<int> &itemToRece
   }
 }
 
-void PointToPointCommunication::broadcastSendMesh()
+void PointToPointCommunication::broadcastSendMesh(bool compress)
 {
   for (auto &connectionData : _connectionDataVector) {
-    com::sendMesh(*_communication, connectionData.remoteRank, *_mesh);
+    com::sendMesh(*_communication, connectionData.remoteRank, *_mesh, compress);
   }
 }
 
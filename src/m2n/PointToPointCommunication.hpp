@@ -31,8 +31,13 @@ namespace m2n {
  */
 class PointToPointCommunication : public DistributedCommunication {
 public:
+  /**
+   * @param[in] useAddressTable Exchange the addresses of all ranks in one table between the primary ranks,
+   *            instead of one connection file per rank. Requires Communication::supportsAddressTable().
+   */
   PointToPointCommunication(com::PtrCommunicationFactory communicationFactory,
-                            mesh::PtrMesh                mesh);
+                            mesh::PtrMesh                mesh,
+                            bool                         useAddressTable = false);
 
   ~PointToPointCommunication() override;
 
@@ -110,8 +115,8 @@ public:
    */
   void broadcastReceiveAll(std::vector<int> &itemToReceive) override;
 
-  /// Broadcasts a mesh to connected ranks on remote participant
-  void broadcastSendMesh() override;
+  /// Broadcasts a mesh to connected ranks on remote participant, optionally compressed
+  void broadcastSendMesh(bool compress) override;
 
   /// Receive mesh partitions per connected rank on remote participant
   void broadcastReceiveAllMesh() override;
@@ -133,6 +138,9 @@ private:
 
   com::PtrCommunicationFactory _communicationFactory;
 
+  /// Exchange the addresses of all ranks in one table between the primary ranks?
+  bool _useAddressTable;
+
   /// Communication class used for this PointToPointCommunication
   /**
    * A Communication object represents all connections to all ranks made by this P2P instance.
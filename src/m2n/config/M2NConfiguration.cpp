@@ -5,6 +5,7 @@
 #include "com/CommunicationFactory.hpp"
 #include "com/MPIPortsCommunicationFactory.hpp"
 #include "com/MPISinglePortsCommunicationFactory.hpp"
+#include "com/SharedMemoryCommunicationFactory.hpp"
 #include "com/SharedPointer.hpp"
 #include "com/SocketCommunicationFactory.hpp"
 #include "logging/LogMacros.hpp"
@@ -50,6 +51,21 @@ M2NConfiguration::M2NConfiguration(xml::XMLTag &parent)
                                "for the InfiniBand on SuperMUC. ");
     tag.addAttribute(attrNetwork);
 
+    auto attrUnixDomainSockets = makeXMLAttribute(ATTR_USE_UNIX_DOMAIN_SOCKETS, false)
+                                     .setDocumentation(
+                                         "Connect ranks located on the same host via Unix domain sockets instead of TCP. "
+                                         "Ranks on different hosts still connect via the given network.");
+    tag.addAttribute(attrUnixDomainSockets);
+
+    auto attrAddressTable = makeXMLAttribute(ATTR_USE_ADDRESS_TABLE, false)
+                                .setDocumentation(
+                                    "Exchange the addresses of all ranks in a single table between the primary ranks, "
+                                    "which is then broadcast within each participant. Otherwise, every rank publishes "
+                                    "its address in a separate file in the exchange directory. "
+                                    "Recommended for large parallel runs on shared file systems. "
+                                    "Does not apply to the two-level initialization.");
+    tag.addAttribute(attrAddressTable);
+
     auto attrExchangeDirectory = makeXMLAttribute(ATTR_EXCHANGE_DIRECTORY, ".")
                                      .setDocumentation(
                                          "Directory where connection information is exchanged. By default, the "
@@ -84,6 +100,25 @@ M2NConfiguration::M2NConfiguration(xml::XMLTag &parent)
     tag.addAttribute(attrExchangeDirectory);
     tags.push_back(tag);
   }
+  {
+    XMLTag tag(*this, "shared-memory", occ, TAG);
+    doc = "Communication via POSIX shared memory. Requires all ranks of both participants to run on the same node.";
+    tag.setDocumentation(doc);
+
+    auto attrBufferSize = makeXMLAttribute(ATTR_BUFFER_SIZE, static_cast<int>(com::SharedMemoryCommunication::defaultBufferSize))
+                              .setDocumentation(
+                                  "Capacity in bytes of the ring buffer for each direction of each connection. "
+                                  "Larger messages are transferred in multiple parts.");
+    tag.addAttribute(attrBufferSize);
+
+    auto attrExchangeDirectory = makeXMLAttribute(ATTR_EXCHANGE_DIRECTORY, ".")
+                                     .setDocumentation(
+                                         "Directory where connection information is exchanged. By default, the "
+                                         "directory of startup is chosen, and both solvers have to be started "
+                                         "in the same directory.");
+    tag.addAttribute(attrExchangeDirectory);
+    tags.push_back(tag);
+  }
 
   XMLAttribute<bool> attrEnforce(ATTR_ENFORCE_GATHER_SCATTER, false);
   attrEnforce.setDocumentation("Enforce the distributed communication to a gather-scatter scheme. "
@@ -93,6 +128,13 @@ M2NConfiguration::M2NConfiguration(xml::XMLTag &parent)
   attrTwoLevel.setDocumentation("Use a two-level initialization scheme. "
                                 "Recommended for large parallel runs (>5000 MPI ranks).");
 
+  XMLAttribute<bool> attrCompress(ATTR_COMPRESS_MESHES, false);
+  attrCompress.setDocumentation("Compress meshes exchanged through this m2n and distributed among the ranks of the receiving participant. "
+                                "Coordinates are XOR-encoded against the previous vertex and stored without zero bytes, "
+                                "vertex IDs and connectivity are sent as delta-encoded variable-length integers. "
+                                "The compression is lossless. "
+                                "Reduces the transferred data of large received meshes at the cost of encoding.");
+
   auto attrFrom = XMLAttribute<std::string>("acceptor")
                       .setDocumentation(
                           "First participant name involved in communication. For performance reasons, we recommend to use "
@@ -105,6 +147,7 @@ M2NConfiguration::M2NConfiguration(xml::XMLTag &parent)
     tag.addAttribute(attrTo);
     tag.addAttribute(attrEnforce);
     tag.addAttribute(attrTwoLevel);
+    tag.addAttribute(attrCompress);
     parent.addSubtag(tag);
   }
 }
@@ -136,6 +179,7 @@ void M2NConfiguration::xmlTagCallback(const xml::ConfigurationContext &context,
     checkDuplicates(acceptor, connector);
     bool enforceGatherScatter = tag.getBooleanAttributeValue(ATTR_ENFORCE_GATHER_SCATTER);
     bool useTwoLevelInit      = tag.getBooleanAttributeValue(ATTR_USE_TWO_LEVEL_INIT);
+    bool compressMeshes       = tag.getBooleanAttributeValue(ATTR_COMPRESS_MESHES);
 
     if (enforceGatherScatter && useTwoLevelInit) {
       throw std::runtime_error{std::string{"A gather-scatter m2n communication cannot use two-level initialization. Please switch either "} + "\"" + ATTR_ENFORCE_GATHER_SCATTER + "\" or \"" + ATTR_USE_TWO_LEVEL_INIT + "\" off."};
@@ -146,7 +190,8 @@ void M2NConfiguration::xmlTagCallback(const xml::ConfigurationContext &context,
 
     com::PtrCommunicationFactory comFactory;
     com::PtrCommunication        com;
-    const std::string            tagName = tag.getName();
+    bool                         useAddressTable = false;
+    const std::string            tagName         = tag.getName();
     if (tagName == "sockets") {
       std::string network = tag.getStringAttributeValue("network");
       int         port    = tag.getIntAttributeValue("port");
@@ -154,9 +199,11 @@ void M2NConfiguration::xmlTagCallback(const xml::ConfigurationContext &context,
       PRECICE_CHECK(not utils::isTruncated<unsigned short>(port),
                     "The value given for the \"port\" attribute is not a 16-bit unsigned integer: {}", port);
 
-      std::string dir = tag.getStringAttributeValue(ATTR_EXCHANGE_DIRECTORY);
-      comFactory      = std::make_shared<com::SocketCommunicationFactory>(port, false, network, dir);
-      com             = comFactory->newCommunication();
+      std::string dir            = tag.getStringAttributeValue(ATTR_EXCHANGE_DIRECTORY);
+      bool        useUnixSockets = tag.getBooleanAttributeValue(ATTR_USE_UNIX_DOMAIN_SOCKETS);
+      useAddressTable            = tag.getBooleanAttributeValue(ATTR_USE_ADDRESS_TABLE);
+      comFactory                 = std::make_shared<com::SocketCommunicationFactory>(port, false, network, dir, useUnixSockets);
+      com                        = comFactory->newCommunication();
     } else if (tagName == "mpi-multiple-ports") {
       std::string dir = tag.getStringAttributeValue(ATTR_EXCHANGE_DIRECTORY);
 #ifdef PRECICE_NO_MPI
@@ -185,6 +232,13 @@ void M2NConfiguration::xmlTagCallback(const xml::ConfigurationContext &context,
       comFactory = std::make_shared<com::MPISinglePortsCommunicationFactory>(dir);
       com        = comFactory->newCommunication();
 #endif
+    } else if (tagName == "shared-memory") {
+      std::string dir        = tag.getStringAttributeValue(ATTR_EXCHANGE_DIRECTORY);
+      int         bufferSize = tag.getIntAttributeValue(ATTR_BUFFER_SIZE);
+      PRECICE_CHECK(bufferSize > 0,
+                    "The value given for the \"{}\" attribute has to be positive, but is {}.", ATTR_BUFFER_SIZE, bufferSize);
+      comFactory = std::make_shared<com::SharedMemoryCommunicationFactory>(dir, bufferSize);
+      com        = comFactory->newCommunication();
     }
 
     PRECICE_ASSERT(com.get() != nullptr);
@@ -193,12 +247,12 @@ void M2NConfiguration::xmlTagCallback(const xml::ConfigurationContext &context,
     if (enforceGatherScatter) {
       distrFactory = std::make_shared<GatherScatterComFactory>(com);
     } else {
-      distrFactory = std::make_shared<PointToPointComFactory>(comFactory);
+      distrFactory = std::make_shared<PointToPointComFactory>(comFactory, useAddressTable);
     }
     PRECICE_ASSERT(distrFactory.get() != nullptr);
 
     _m2ns.emplace_back(ConfiguredM2N{
-        std::make_shared<m2n::M2N>(com, distrFactory, false, useTwoLevelInit),
+        std::make_shared<m2n::M2N>(com, distrFactory, false, useTwoLevelInit, compressMeshes),
         acceptor,
         connector});
   }
@@ -56,10 +56,14 @@ public:
 private:
   logging::Logger _log{"m2n::M2NConfiguration"};
 
-  const std::string TAG                         = "m2n";
-  const std::string ATTR_EXCHANGE_DIRECTORY     = "exchange-directory";
-  const std::string ATTR_ENFORCE_GATHER_SCATTER = "enforce-gather-scatter";
-  const std::string ATTR_USE_TWO_LEVEL_INIT     = "use-two-level-initialization";
+  const std::string TAG                          = "m2n";
+  const std::string ATTR_EXCHANGE_DIRECTORY      = "exchange-directory";
+  const std::string ATTR_ENFORCE_GATHER_SCATTER  = "enforce-gather-scatter";
+  const std::string ATTR_USE_TWO_LEVEL_INIT      = "use-two-level-initialization";
+  const std::string ATTR_COMPRESS_MESHES         = "compress-meshes";
+  const std::string ATTR_BUFFER_SIZE             = "buffer-size";
+  const std::string ATTR_USE_UNIX_DOMAIN_SOCKETS = "use-unix-domain-sockets";
+  const std::string ATTR_USE_ADDRESS_TABLE       = "use-address-table";
 
   std::vector<ConfiguredM2N> _m2ns;
 
@@ -43,13 +43,13 @@ void process(vector<double> &data)
   }
 }
 
-void runP2PComTest1(const TestContext &context, com::PtrCommunicationFactory cf)
+void runP2PComTest1(const TestContext &context, com::PtrCommunicationFactory cf, bool useAddressTable = false)
 {
   BOOST_TEST(context.hasSize(2));
 
   mesh::PtrMesh mesh(new mesh::Mesh("Mesh", 2, testing::nextMeshID()));
 
-  m2n::PointToPointCommunication c(cf, mesh);
+  m2n::PointToPointCommunication c(cf, mesh, useAddressTable);
 
   vector<double> data;
   vector<double> expectedData;
@@ -210,7 +210,7 @@ void runSameConnectionTest(const TestContext &context, com::PtrCommunicationFact
   }
 }
 
-void runCrossConnectionTest(const TestContext &context, com::PtrCommunicationFactory cf)
+void runCrossConnectionTest(const TestContext &context, com::PtrCommunicationFactory cf, bool useAddressTable = false)
 {
 
   BOOST_TEST(context.hasSize(2));
@@ -237,7 +237,7 @@ void runCrossConnectionTest(const TestContext &context, com::PtrCommunicationFac
     }
   }
 
-  m2n::PointToPointCommunication c(cf, mesh);
+  m2n::PointToPointCommunication c(cf, mesh, useAddressTable);
 
   std::vector<int> receiveData;
 
@@ -266,7 +266,7 @@ void runCrossConnectionTest(const TestContext &context, com::PtrCommunicationFac
   }
 }
 
-void runEmptyConnectionTest(const TestContext &context, com::PtrCommunicationFactory cf)
+void runEmptyConnectionTest(const TestContext &context, com::PtrCommunicationFactory cf, bool useAddressTable = false)
 {
   BOOST_TEST(context.hasSize(2));
 
@@ -289,7 +289,7 @@ void runEmptyConnectionTest(const TestContext &context, com::PtrCommunicationFac
     }
   }
 
-  m2n::PointToPointCommunication c(cf, mesh);
+  m2n::PointToPointCommunication c(cf, mesh, useAddressTable);
 
   std::vector<int> receiveData;
 
@@ -353,7 +353,7 @@ void runP2PMeshBroadcastTest(const TestContext &context, com::PtrCommunicationFa
   if (context.isNamed("A")) {
 
     c.requestPreConnection("Solid", "Fluid");
-    c.broadcastSendMesh();
+    c.broadcastSendMesh(false);
   } else {
 
     c.acceptPreConnection("Solid", "Fluid");
@@ -512,6 +512,31 @@ BOOST_AUTO_TEST_CASE(P2PComLocalCommunicationMapTest)
 
 BOOST_AUTO_TEST_SUITE_END() // Sockets
 
+BOOST_AUTO_TEST_SUITE(SocketsAddressTable)
+
+BOOST_AUTO_TEST_CASE(P2PComTest1)
+{
+  PRECICE_TEST("A"_on(2_ranks).setupIntraComm(), "B"_on(2_ranks).setupIntraComm(), Require::Events);
+  com::PtrCommunicationFactory cf(new com::SocketCommunicationFactory);
+  runP2PComTest1(context, cf, true);
+}
+
+BOOST_AUTO_TEST_CASE(TestCrossConnection)
+{
+  PRECICE_TEST("A"_on(2_ranks).setupIntraComm(), "B"_on(2_ranks).setupIntraComm(), Require::Events);
+  com::PtrCommunicationFactory cf(new com::SocketCommunicationFactory);
+  runCrossConnectionTest(context, cf, true);
+}
+
+BOOST_AUTO_TEST_CASE(EmptyConnectionTest)
+{
+  PRECICE_TEST("A"_on(2_ranks).setupIntraComm(), "B"_on(2_ranks).setupIntraComm(), Require::Events);
+  com::PtrCommunicationFactory cf(new com::SocketCommunicationFactory);
+  runEmptyConnectionTest(context, cf, true);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // SocketsAddressTable
+
 BOOST_AUTO_TEST_SUITE(MPIPorts, *boost::unit_test::label("MPI_Ports"))
 
 BOOST_AUTO_TEST_CASE(P2PComTest1)
@@ -1,7 +1,9 @@
 #include <Eigen/Core>
 #include <algorithm>
+#include <iterator>
 #include <memory>
 #include <ostream>
+#include <thread>
 #include <unordered_set>
 #include <utility>
 
@@ -17,16 +19,55 @@
 #include "profiling/Event.hpp"
 #include "query/Index.hpp"
 #include "utils/IntraComm.hpp"
+#include "utils/ParallelFor.hpp"
 #include "utils/Statistics.hpp"
 #include "utils/assertion.hpp"
 
 namespace precice::mapping {
 
-BarycentricBaseMapping::BarycentricBaseMapping(Constraint constraint, int dimensions)
-    : Mapping(constraint, dimensions, false, Mapping::InitialGuessRequirement::None)
+BarycentricBaseMapping::BarycentricBaseMapping(Constraint constraint, int dimensions, unsigned int nThreads)
+    : Mapping(constraint, dimensions, false, Mapping::InitialGuessRequirement::None),
+      _nThreads(nThreads == 0 ? std::max(std::thread::hardware_concurrency(), 1u) : nThreads)
 {
 }
 
+bool BarycentricBaseMapping::isThreaded(std::size_t nVertices) const
+{
+  return _nThreads > 1 && nVertices > 1;
+}
+
+void BarycentricBaseMapping::computeInterpolations(const mesh::Mesh &origins, const std::function<Polation(const Eigen::VectorXd &)> &findMatch)
+{
+  const auto &vertices = origins.vertices();
+  _interpolations.clear();
+
+  if (!isThreaded(vertices.size())) {
+    _interpolations.reserve(vertices.size());
+    for (const auto &vertex : vertices) {
+      _interpolations.push_back(findMatch(vertex.getCoords()));
+    }
+    return;
+  }
+
+  // Polation is not default-constructible, hence, every chunk collects its results in a separate buffer
+  const std::size_t                  nChunks = std::min<std::size_t>(_nThreads, vertices.size());
+  std::vector<std::vector<Polation>> buffers(nChunks);
+  utils::parallelForChunks(nChunks, nChunks, [&](std::size_t chunkBegin, std::size_t chunkEnd) {
+    for (std::size_t chunk = chunkBegin; chunk < chunkEnd; ++chunk) {
+      const auto [begin, end] = utils::chunkBounds(vertices.size(), nChunks, chunk);
+      buffers[chunk].reserve(end - begin);
+      for (std::size_t i = begin; i < end; ++i) {
+        buffers[chunk].push_back(findMatch(vertices[i].getCoords()));
+      }
+    }
+  });
+
+  _interpolations.reserve(vertices.size());
+  for (auto &buffer : buffers) {
+    std::move(buffer.begin(), buffer.end(), std::back_inserter(_interpolations));
+  }
+}
+
 void BarycentricBaseMapping::clear()
 {
   PRECICE_TRACE();
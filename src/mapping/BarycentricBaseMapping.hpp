@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <vector>
 #include "logging/Logger.hpp"
 #include "mapping/Mapping.hpp"
@@ -14,7 +15,14 @@ namespace mapping {
  */
 class BarycentricBaseMapping : public Mapping {
 public:
-  BarycentricBaseMapping(Constraint constraint, int dimensions);
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] constraint Specifies mapping to be consistent or conservative.
+   * @param[in] dimensions Dimensionality of the meshes
+   * @param[in] nThreads Number of threads used to compute the mapping. A value of 0 uses all hardware threads.
+   */
+  BarycentricBaseMapping(Constraint constraint, int dimensions, unsigned int nThreads = 1);
 
   /// Removes a computed mapping.
   void clear() final override;
@@ -32,7 +40,23 @@ protected:
   /// @copydoc Mapping::mapConsistent
   void mapConsistent(const time::Sample &inData, Eigen::VectorXd &outData) override;
 
+  /**
+   * @brief Fills _interpolations with the result of findMatch for the coordinates of every vertex of origins.
+   *
+   * The vertices are split into contiguous chunks, which are processed on up to _nThreads threads.
+   * Every chunk collects its interpolations in a separate buffer and the buffers are concatenated
+   * in order, such that the result doesn't depend on the number of threads.
+   * If more than one thread is used, findMatch has to be safe to call concurrently.
+   */
+  void computeInterpolations(const mesh::Mesh &origins, const std::function<Polation(const Eigen::VectorXd &)> &findMatch);
+
+  /// Returns whether computeInterpolations() uses more than one thread for the given amount of vertices
+  bool isThreaded(std::size_t nVertices) const;
+
   std::vector<Polation> _interpolations;
+
+  /// Number of threads used to compute the mapping
+  const unsigned int _nThreads;
 };
 
 } // namespace mapping
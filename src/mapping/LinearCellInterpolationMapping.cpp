@@ -9,9 +9,10 @@
 namespace precice::mapping {
 
 LinearCellInterpolationMapping::LinearCellInterpolationMapping(
-    Constraint constraint,
-    int        dimensions)
-    : BarycentricBaseMapping(constraint, dimensions)
+    Constraint   constraint,
+    int          dimensions,
+    unsigned int nThreads)
+    : BarycentricBaseMapping(constraint, dimensions, nThreads)
 {
   if (constraint == CONSISTENT) {
     setInputRequirement(Mapping::MeshRequirement::FULL);
@@ -74,17 +75,19 @@ void LinearCellInterpolationMapping::computeMapping()
   // @TODO Add a configuration option for this factor
   constexpr int nnearest = 4;
 
-  auto &                                 index = searchSpace->index();
-  utils::statistics::DistanceAccumulator fallbackStatistics;
+  auto &index = searchSpace->index();
+  if (isThreaded(fVertices.size())) {
+    index.buildProjectionTrees(true);
+  }
 
-  _interpolations.clear();
-  _interpolations.reserve(fVertices.size());
+  // Find tetrahedra (3D) or triangle (2D) or fall-back on NP
+  computeInterpolations(*origins, [&index](const Eigen::VectorXd &location) {
+    return index.findCellOrProjection(location, nnearest).polation;
+  });
 
-  for (const auto &fVertex : fVertices) {
-    // Find tetrahedra (3D) or triangle (2D) or fall-back on NP
-    auto match    = index.findCellOrProjection(fVertex.getCoords(), nnearest);
-    auto distance = match.polation.distance();
-    _interpolations.push_back(std::move(match.polation));
+  utils::statistics::DistanceAccumulator fallbackStatistics;
+  for (const auto &interpolation : _interpolations) {
+    const double distance = interpolation.distance();
     if (!math::equals(distance, 0.0)) {
       // Only push when fall-back occurs, so the number of entries is the number of vertices outside the domain
       fallbackStatistics(distance);
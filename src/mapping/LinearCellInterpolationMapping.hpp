@@ -12,8 +12,8 @@ namespace mapping {
  */
 class LinearCellInterpolationMapping : public BarycentricBaseMapping {
 public:
-  /// Constructor, taking mapping constraint.
-  LinearCellInterpolationMapping(Constraint constraint, int dimensions);
+  /// Constructor, taking mapping constraint and the number of threads to compute the mapping, see BarycentricBaseMapping().
+  LinearCellInterpolationMapping(Constraint constraint, int dimensions, unsigned int nThreads = 1);
 
   /// Computes the projections and interpolation relations.
   void computeMapping() final override;
@@ -23,9 +23,10 @@
 namespace precice::mapping {
 
 NearestProjectionMapping::NearestProjectionMapping(
-    Constraint constraint,
-    int        dimensions)
-    : BarycentricBaseMapping(constraint, dimensions)
+    Constraint   constraint,
+    int          dimensions,
+    unsigned int nThreads)
+    : BarycentricBaseMapping(constraint, dimensions, nThreads)
 {
   if (constraint == CONSISTENT) {
     setInputRequirement(Mapping::MeshRequirement::FULL);
@@ -80,18 +81,20 @@ void NearestProjectionMapping::computeMapping()
   // @TODO Add a configuration option for this factor
   constexpr int nnearest = 4;
 
-  utils::statistics::DistanceAccumulator distanceStatistics;
+  auto &index = searchSpace->index();
+  if (isThreaded(fVertices.size())) {
+    index.buildProjectionTrees(false);
+  }
 
-  _interpolations.clear();
-  _interpolations.reserve(fVertices.size());
+  // Nearest projection element is edge for 2d if exists, if not, it is the nearest vertex
+  // Nearest projection element is triangle for 3d if exists, if not the edge and at the worst case it is the nearest vertex
+  computeInterpolations(*origins, [&index](const Eigen::VectorXd &location) {
+    return index.findNearestProjection(location, nnearest).polation;
+  });
 
-  auto &index = searchSpace->index();
-  for (const auto &fVertex : fVertices) {
-    // Nearest projection element is edge for 2d if exists, if not, it is the nearest vertex
-    // Nearest projection element is triangle for 3d if exists, if not the edge and at the worst case it is the nearest vertex
-    auto match = index.findNearestProjection(fVertex.getCoords(), nnearest);
-    distanceStatistics(match.polation.distance());
-    _interpolations.push_back(std::move(match.polation));
+  utils::statistics::DistanceAccumulator distanceStatistics;
+  for (const auto &interpolation : _interpolations) {
+    distanceStatistics(interpolation.distance());
   }
 
   if (distanceStatistics.empty()) {
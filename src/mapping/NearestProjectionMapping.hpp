@@ -13,8 +13,8 @@ namespace mapping {
  */
 class NearestProjectionMapping : public BarycentricBaseMapping {
 public:
-  /// Constructor, taking mapping constraint.
-  NearestProjectionMapping(Constraint constraint, int dimensions);
+  /// Constructor, taking mapping constraint and the number of threads to compute the mapping, see BarycentricBaseMapping().
+  NearestProjectionMapping(Constraint constraint, int dimensions, unsigned int nThreads = 1);
 
   /// Computes the projections and interpolation relations.
   void computeMapping() final override;
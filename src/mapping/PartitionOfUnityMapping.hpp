@@ -2,6 +2,7 @@
 
 #include <Eigen/Core>
 #include <numeric>
+#include <thread>
 
 #include "com/Communication.hpp"
 #include "io/ExportVTU.hpp"
@@ -12,6 +13,7 @@
 #include "profiling/Event.hpp"
 #include "query/Index.hpp"
 #include "utils/IntraComm.hpp"
+#include "utils/ParallelFor.hpp"
 
 namespace precice {
 extern bool syncMode;
@@ -42,6 +44,10 @@ public:
    * clusters centers.
    * @param[in] projectToInput if enabled, places the cluster centers at the closest vertex of the input mesh.
    * See also \ref mapping::impl::createClustering()
+   * @param[in] nThreads Number of threads used to compute and evaluate the clusters. A value of 0 uses
+   * all hardware threads.
+   * @param[in] precomputeOperator if enabled, consistent mappings precompute the weighted mapping operator of each
+   * cluster, see \ref SphericalVertexCluster::computeConsistentOperator()
    */
   PartitionOfUnityMapping(
       Mapping::Constraint     constraint,
@@ -50,7 +56,9 @@ public:
       Polynomial              polynomial,
       unsigned int            verticesPerCluster,
       double                  relativeOverlap,
-      bool                    projectToInput);
+      bool                    projectToInput,
+      unsigned int            nThreads           = 1,
+      bool                    precomputeOperator = false);
 
   /**
    * Computes the clustering for the partition of unity method and fills the \p _clusters vector,
@@ -102,12 +110,22 @@ private:
   /// polynomial treatment of the RBF system
   Polynomial _polynomial;
 
+  /// number of threads used to compute the cluster solvers and to evaluate the clusters
+  const unsigned int _nThreads;
+
+  /// toggles whether consistent mappings precompute the operator of each cluster
+  const bool _precomputeOperator;
+
   /// @copydoc Mapping::mapConservative
   virtual void mapConservative(const time::Sample &inData, Eigen::VectorXd &outData) override;
 
   /// @copydoc Mapping::mapConsistent
   virtual void mapConsistent(const time::Sample &inData, Eigen::VectorXd &outData) override;
 
+  /// Applies \p mapCluster to all clusters and accumulates the results of the threads in \p outData
+  template <typename MapCluster>
+  void mapClusters(Eigen::VectorXd &outData, MapCluster &&mapCluster) const;
+
   /// export the center vertices of all clusters as a mesh with some additional data on it such as vertex count
   /// only enabled in debug builds and mainly for debugging purpose
   void exportClusterCentersAsVTU(mesh::Mesh &centers);
@@ -121,9 +139,12 @@ PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::PartitionOfUnityMapping(
     Polynomial              polynomial,
     unsigned int            verticesPerCluster,
     double                  relativeOverlap,
-    bool                    projectToInput)
+    bool                    projectToInput,
+    unsigned int            nThreads,
+    bool                    precomputeOperator)
     : Mapping(constraint, dimension, false, Mapping::InitialGuessRequirement::None),
-      _basisFunction(function), _verticesPerCluster(verticesPerCluster), _relativeOverlap(relativeOverlap), _projectToInput(projectToInput), _polynomial(polynomial)
+      _basisFunction(function), _verticesPerCluster(verticesPerCluster), _relativeOverlap(relativeOverlap), _projectToInput(projectToInput), _polynomial(polynomial),
+      _nThreads(nThreads == 0 ? std::max(std::thread::hardware_concurrency(), 1u) : nThreads), _precomputeOperator(precomputeOperator)
 {
   PRECICE_ASSERT(this->getDimensions() <= 3);
   PRECICE_ASSERT(_polynomial != Polynomial::ON, "Integrated polynomial is not supported for partition of unity data mappings.");
@@ -168,7 +189,6 @@ void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
   PRECICE_ASSERT(_clusterRadius > 0 || inMesh->nVertices() == 0 || outMesh->nVertices() == 0);
 
   // Step 2: check, which of the resulting clusters are non-empty and register the cluster centers in a mesh
-  // Here, the VertexCluster computes the matrix decompositions directly in case the cluster is non-empty
   mesh::Mesh centerMesh("pou-centers-" + inMesh->getName(), this->getDimensions(), mesh::Mesh::MESH_ID_UNDEFINED);
   auto &     meshVertices = centerMesh.vertices();
 
@@ -180,7 +200,7 @@ void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
     // of the cluster within the _clusters vector. That's required for the indexing further down and asserted below
     const VertexID                                  vertexID = meshVertices.size();
     mesh::Vertex                                    center(c.getCoords(), vertexID);
-    SphericalVertexCluster<RADIAL_BASIS_FUNCTION_T> cluster(center, _clusterRadius, _basisFunction, _polynomial, inMesh, outMesh);
+    SphericalVertexCluster<RADIAL_BASIS_FUNCTION_T> cluster(center, _clusterRadius, _polynomial, inMesh, outMesh);
 
     // Consider only non-empty clusters (more of a safeguard here)
     if (!cluster.empty()) {
@@ -191,6 +211,18 @@ void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
   }
 
   e.addData("n clusters", _clusters.size());
+
+  // Step 3: compute the matrix decompositions of all clusters. The clusters are independent of each other, such that
+  // we distribute them over the configured threads. The clusters are of similar size, hence, a static chunking suffices.
+  precice::profiling::Event eSolver("map.pou.computeMapping.rbfSolver");
+  utils::parallelForChunks(_clusters.size(), _nThreads, [&](std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+      _clusters[i].computeSolver(_basisFunction, *inMesh, *outMesh);
+    }
+  });
+  eSolver.addData("n threads", _nThreads);
+  eSolver.stop();
+
   // Log the average number of resulting clusters
   PRECICE_DEBUG("Partition of unity data mapping between mesh \"{}\" and mesh \"{}\": mesh \"{}\" on rank {} was decomposed into {} clusters.", this->input()->getName(), this->output()->getName(), inMesh->getName(), utils::IntraComm::getRank(), _clusters.size());
 
@@ -205,16 +237,16 @@ void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
   centerMesh.computeBoundingBox();
   PRECICE_DEBUG("Bounding Box of the cluster centers {}", centerMesh.getBoundingBox());
 
-  // Step 3: index the clusters / the center mesh in order to define the output vertex -> cluster ownership
-  // the ownership is required to compute the normalized partition of unity weights (Step 4)
+  // Step 4: index the clusters / the center mesh in order to define the output vertex -> cluster ownership
+  // the ownership is required to compute the normalized partition of unity weights (Step 5)
   query::Index clusterIndex(centerMesh);
-  // Step 4: find all clusters the output vertex lies in, i.e., find all cluster centers which have the distance of a cluster radius from the given output vertex
+  // Step 5: find all clusters the output vertex lies in, i.e., find all cluster centers which have the distance of a cluster radius from the given output vertex
   // Here, we do this using the RTree on the centerMesh: VertexID (queried from the centersMesh) == clusterID, by construction above. The loop uses
   // the vertices to compute the weights required for the partition of unity data mapping.
   // Note: this could also be done on-the-fly in the map data phase for dynamic queries, which would require to make the mesh as well as the indexTree member variables.
   PRECICE_DEBUG("Computing cluster-vertex association");
   for (const auto &vertex : outMesh->vertices()) {
-    // Step 4a: get the relevant clusters for the output vertex
+    // Step 5a: get the relevant clusters for the output vertex
     auto       clusterIDs            = clusterIndex.getVerticesInsideBox(vertex, _clusterRadius);
     const auto localNumberOfClusters = clusterIDs.size();
 
@@ -233,7 +265,7 @@ void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
     // Next we compute the normalized weights of each output vertex for each partition
     PRECICE_ASSERT(localNumberOfClusters > 0, "No cluster found for vertex {}", vertex.getCoords());
 
-    // Step 4b: compute the weight in each partition individually and store them in 'weights'
+    // Step 5b: compute the weight in each partition individually and store them in 'weights'
     std::vector<double> weights(localNumberOfClusters);
     std::transform(clusterIDs.cbegin(), clusterIDs.cend(), weights.begin(), [&](const auto &ids) { return _clusters[ids].computeWeight(vertex); });
     double weightSum = std::accumulate(weights.begin(), weights.end(), static_cast<double>(0.));
@@ -246,7 +278,7 @@ void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
     }
     PRECICE_ASSERT(weightSum > 0);
 
-    // Step 4c: scale the weight using the weight sum and store the normalized weight in all associated clusters
+    // Step 5c: scale the weight using the weight sum and store the normalized weight in all associated clusters
     for (unsigned int i = 0; i < localNumberOfClusters; ++i) {
       PRECICE_ASSERT(clusterIDs[i] < static_cast<int>(_clusters.size()));
       _clusters[clusterIDs[i]].setNormalizedWeight(weights[i] / weightSum, vertex.getID());
@@ -254,6 +286,16 @@ void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
   }
   eWeights.stop();
 
+  // Step 6: optionally precompute the operators of the clusters, which requires the normalized weights from Step 5
+  if (_precomputeOperator && !this->hasConstraint(Mapping::CONSERVATIVE)) {
+    precice::profiling::Event eOperator("map.pou.computeMapping.precomputeOperator");
+    utils::parallelForChunks(_clusters.size(), _nThreads, [&](std::size_t begin, std::size_t end) {
+      for (std::size_t i = begin; i < end; ++i) {
+        _clusters[i].computeConsistentOperator();
+      }
+    });
+  }
+
   // Uncomment to add a VTK export of the cluster center distribution for visualization purposes
   // exportClusterCentersAsVTU(centerMesh);
 
@@ -272,7 +314,7 @@ void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::mapConservative(const tim
   PRECICE_ASSERT(outData.isZero());
 
   // 2. Iterate over all clusters and accumulate the result in the output data
-  std::for_each(_clusters.begin(), _clusters.end(), [&](auto &cluster) { cluster.mapConservative(inData, outData); });
+  mapClusters(outData, [&inData](const auto &cluster, Eigen::VectorXd &out) { cluster.mapConservative(inData, out); });
 }
 
 template <typename RADIAL_BASIS_FUNCTION_T>
@@ -287,7 +329,33 @@ void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::mapConsistent(const time:
   PRECICE_ASSERT(outData.isZero());
 
   // 2. Execute the actual mapping evaluation in all vertex clusters and accumulate the data
-  std::for_each(_clusters.begin(), _clusters.end(), [&](auto &clusters) { clusters.mapConsistent(inData, outData); });
+  mapClusters(outData, [&inData](const auto &cluster, Eigen::VectorXd &out) { cluster.mapConsistent(inData, out); });
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+template <typename MapCluster>
+void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::mapClusters(Eigen::VectorXd &outData, MapCluster &&mapCluster) const
+{
+  if (_nThreads <= 1 || _clusters.size() <= 1) {
+    std::for_each(_clusters.begin(), _clusters.end(), [&](const auto &cluster) { mapCluster(cluster, outData); });
+    return;
+  }
+
+  // Clusters overlap, hence, every thread accumulates into its own output vector. The partial results
+  // are summed in a fixed order, such that the result only depends on the number of threads.
+  const std::size_t            nChunks = std::min<std::size_t>(_nThreads, _clusters.size());
+  std::vector<Eigen::VectorXd> partialData(nChunks, Eigen::VectorXd::Zero(outData.size()));
+  utils::parallelForChunks(nChunks, nChunks, [&](std::size_t chunkBegin, std::size_t chunkEnd) {
+    for (std::size_t chunk = chunkBegin; chunk < chunkEnd; ++chunk) {
+      const auto [begin, end] = utils::chunkBounds(_clusters.size(), nChunks, chunk);
+      for (std::size_t i = begin; i < end; ++i) {
+        mapCluster(_clusters[i], partialData[chunk]);
+      }
+    }
+  });
+  for (const auto &partial : partialData) {
+    outData += partial;
+  }
 }
 
 template <typename RADIAL_BASIS_FUNCTION_T>
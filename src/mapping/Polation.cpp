@@ -1,5 +1,6 @@
 #include "mapping/Polation.hpp"
 #include <Eigen/src/Core/Matrix.h>
+#include <utility>
 #include "math/barycenter.hpp"
 #include "math/differences.hpp"
 
@@ -9,26 +10,58 @@ Polation::Polation(const Eigen::VectorXd &location, const mesh::Vertex &element)
 {
   _weightedElements.emplace_back(WeightedElement{element.getID(), 1.0});
   // The projection in this case is simply the nearest point.
-  _distance = (location - element.getCoords()).norm();
+  if (element.getDimensions() == 2) {
+    _distance = (Eigen::Vector2d(location) - element.getCoords<2>()).norm();
+  } else {
+    _distance = (Eigen::Vector3d(location) - element.getCoords<3>()).norm();
+  }
+}
+
+namespace {
+
+/// Computes the barycentric coordinates and the projection distance of a location on an edge in fixed dimensions
+template <int Dim>
+std::pair<Eigen::Vector2d, double> projectOnEdge(const Eigen::VectorXd &location, const mesh::Edge &element)
+{
+  using Vector = Eigen::Matrix<double, Dim, 1>;
+  const Vector a = element.vertex(0).getCoords<Dim>();
+  const Vector b = element.vertex(1).getCoords<Dim>();
+  const Vector u = location;
+
+  const auto   bcoords    = math::barycenter::calcBarycentricCoordsForEdge<Dim>(a, b, u);
+  const Vector projection = a * bcoords(0) + b * bcoords(1);
+  return {bcoords, (u - projection).norm()};
 }
 
+/// Computes the barycentric coordinates and the projection distance of a location on a triangle in fixed dimensions
+template <int Dim>
+std::pair<Eigen::Vector3d, double> projectOnTriangle(const Eigen::VectorXd &location, const mesh::Triangle &element)
+{
+  using Vector = Eigen::Matrix<double, Dim, 1>;
+  const Vector a = element.vertex(0).getCoords<Dim>();
+  const Vector b = element.vertex(1).getCoords<Dim>();
+  const Vector c = element.vertex(2).getCoords<Dim>();
+  const Vector u = location;
+
+  const auto   bcoords    = math::barycenter::calcBarycentricCoordsForTriangle<Dim>(a, b, c, u);
+  const Vector projection = a * bcoords(0) + b * bcoords(1) + c * bcoords(2);
+  return {bcoords, (u - projection).norm()};
+}
+
+} // namespace
+
 Polation::Polation(const Eigen::VectorXd &location, const mesh::Edge &element)
 {
   PRECICE_ASSERT(location.size() == element.getDimensions(), location.size(), element.getDimensions());
   const auto &A = element.vertex(0);
   const auto &B = element.vertex(1);
 
-  const auto bcoords = math::barycenter::calcBarycentricCoordsForEdge(
-      A.getCoords(),
-      B.getCoords(),
-      location);
+  const auto [bcoords, distance] = (element.getDimensions() == 2) ? projectOnEdge<2>(location, element) : projectOnEdge<3>(location, element);
 
+  _weightedElements.reserve(2);
   _weightedElements.emplace_back(WeightedElement{A.getID(), bcoords(0)});
   _weightedElements.emplace_back(WeightedElement{B.getID(), bcoords(1)});
-
-  Eigen::VectorXd projection = A.getCoords() * bcoords(0) +
-                               B.getCoords() * bcoords(1);
-  _distance = (location - projection).norm();
+  _distance = distance;
 }
 
 Polation::Polation(const Eigen::VectorXd &location, const mesh::Triangle &element)
@@ -38,20 +71,13 @@ Polation::Polation(const Eigen::VectorXd &location, const mesh::Triangle &elemen
   auto &B = element.vertex(1);
   auto &C = element.vertex(2);
 
-  const auto bcoords = math::barycenter::calcBarycentricCoordsForTriangle(
-      A.getCoords(),
-      B.getCoords(),
-      C.getCoords(),
-      location);
+  const auto [bcoords, distance] = (element.getDimensions() == 2) ? projectOnTriangle<2>(location, element) : projectOnTriangle<3>(location, element);
 
+  _weightedElements.reserve(3);
   _weightedElements.emplace_back(WeightedElement{A.getID(), bcoords(0)});
   _weightedElements.emplace_back(WeightedElement{B.getID(), bcoords(1)});
   _weightedElements.emplace_back(WeightedElement{C.getID(), bcoords(2)});
-
-  Eigen::VectorXd projection = A.getCoords() * bcoords(0) +
-                               B.getCoords() * bcoords(1) +
-                               C.getCoords() * bcoords(2);
-  _distance = (location - projection).norm();
+  _distance = distance;
 }
 
 Polation::Polation(const Eigen::VectorXd &location, const mesh::Tetrahedron &element)
@@ -63,12 +89,13 @@ Polation::Polation(const Eigen::VectorXd &location, const mesh::Tetrahedron &ele
   auto &D = element.vertex(3);
 
   const auto bcoords = math::barycenter::calcBarycentricCoordsForTetrahedron(
-      A.getCoords(),
-      B.getCoords(),
-      C.getCoords(),
-      D.getCoords(),
-      location);
+      A.getCoords<3>(),
+      B.getCoords<3>(),
+      C.getCoords<3>(),
+      D.getCoords<3>(),
+      Eigen::Vector3d(location));
 
+  _weightedElements.reserve(4);
   _weightedElements.emplace_back(WeightedElement{A.getID(), bcoords(0)});
   _weightedElements.emplace_back(WeightedElement{B.getID(), bcoords(1)});
   _weightedElements.emplace_back(WeightedElement{C.getID(), bcoords(2)});
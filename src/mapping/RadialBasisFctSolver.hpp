@@ -3,8 +3,16 @@
 #include <Eigen/Cholesky>
 #include <Eigen/QR>
 #include <Eigen/SVD>
+#include <Eigen/SparseCholesky>
+#include <Eigen/SparseCore>
+#include <Eigen/SparseLU>
+#include <algorithm>
+#include <array>
 #include <boost/range/adaptor/indexed.hpp>
 #include <boost/range/irange.hpp>
+#include <cmath>
+#include <cstdint>
+#include <memory>
 #include <numeric>
 #include <type_traits>
 #include "mapping/MathHelper.hpp"
@@ -21,12 +29,26 @@ namespace mapping {
  * The class uses a dense matrix decomposition in order to decompose the resulting system(s) and a backward substitution
  * in order to solve the system at runtime. The functionality uses Eigen and supports only serial execution. In case
  * the polynomial="separate" option is used, the polynomial system is solved using a QR decomposition.
+ *
+ * For basis functions with compact support and large systems, the matrices are assembled using neighbor queries
+ * on a uniform grid of the input vertices instead. If the resulting fill is low (see \ref sparseMaximalFill),
+ * the system is stored and decomposed as sparse matrices, which allows to use the solver for meshes far beyond
+ * the size of dense systems.
  */
 template <typename RADIAL_BASIS_FUNCTION_T>
 class RadialBasisFctSolver {
 public:
-  using DecompositionType = std::conditional_t<RADIAL_BASIS_FUNCTION_T::isStrictlyPositiveDefinite(), Eigen::LLT<Eigen::MatrixXd>, Eigen::ColPivHouseholderQR<Eigen::MatrixXd>>;
-  using BASIS_FUNCTION_T  = RADIAL_BASIS_FUNCTION_T;
+  using DecompositionType       = std::conditional_t<RADIAL_BASIS_FUNCTION_T::isStrictlyPositiveDefinite(), Eigen::LLT<Eigen::MatrixXd>, Eigen::ColPivHouseholderQR<Eigen::MatrixXd>>;
+  using SparseMatrixType        = Eigen::SparseMatrix<double>;
+  using SparseDecompositionType = std::conditional_t<RADIAL_BASIS_FUNCTION_T::isStrictlyPositiveDefinite(), Eigen::SimplicialLDLT<SparseMatrixType>, Eigen::SparseLU<SparseMatrixType, Eigen::COLAMDOrdering<int>>>;
+  using BASIS_FUNCTION_T        = RADIAL_BASIS_FUNCTION_T;
+
+  /// Minimal number of input vertices for which a sparse system is considered
+  static constexpr std::size_t sparseMinimalSize = 1000;
+
+  /// Maximal ratio of nonzero entries in the interpolation matrix for which a sparse system is used
+  static constexpr double sparseMaximalFill = 0.05;
+
   /// Default constructor
   RadialBasisFctSolver() = default;
 
@@ -47,6 +69,12 @@ public:
   /// Maps the given input data
   Eigen::VectorXd solveConservative(const Eigen::VectorXd &inputData, Polynomial polynomial) const;
 
+  /**
+   * Computes the dense matrix (output x input), which maps input data in the same way as \ref solveConsistent().
+   * The computation requires a solve per input vertex, but applying the result is a single matrix product.
+   */
+  Eigen::MatrixXd computeConsistentOperator(Polynomial polynomial) const;
+
   // Clear all stored matrices
   void clear();
 
@@ -56,10 +84,24 @@ public:
   // Returns the size of the input data
   Eigen::Index getOutputSize() const;
 
+  /// Returns whether the system is stored and decomposed as sparse matrices
+  bool isSparse() const;
+
 private:
   mutable precice::logging::Logger _log{"mapping::RadialBasisFctSolver"};
 
   double evaluateRippaLOOCVerror(const Eigen::VectorXd &lambda) const;
+
+  /**
+   * Assembles the interpolation and evaluation matrices as sparse matrices and decomposes the interpolation matrix.
+   *
+   * @return false, if the fill of the interpolation matrix exceeds \ref sparseMaximalFill or the decomposition
+   *         failed. The solver then remains in its dense state.
+   */
+  template <typename IndexContainer>
+  bool computeSparseSystem(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh::Mesh &inputMesh, const IndexContainer &inputIDs,
+                           const mesh::Mesh &outputMesh, const IndexContainer &outputIDs, std::array<bool, 3> activeAxis, Polynomial polynomial);
+
   /// Decomposition of the interpolation matrix
   DecompositionType _decMatrixC;
 
@@ -78,6 +120,12 @@ private:
   /// Evaluation matrix (output x input)
   Eigen::MatrixXd _matrixA;
 
+  /// Decomposition of the sparse interpolation matrix, replaces \ref _decMatrixC if set
+  std::unique_ptr<SparseDecompositionType> _sparseDecMatrixC;
+
+  /// Sparse evaluation matrix (output x input), replaces \ref _matrixA if \ref _sparseDecMatrixC is set
+  SparseMatrixType _sparseMatrixA;
+
   bool computeCrossValidation = false;
 };
 
@@ -332,14 +380,25 @@ RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::RadialBasisFctSolver(RADIAL_BASIS
   std::array<bool, 3> activeAxis({{false, false, false}});
   std::transform(deadAxis.begin(), deadAxis.end(), activeAxis.begin(), [](const auto ax) { return !ax; });
 
-  // First, assemble the interpolation matrix and check the invertability
+  // First, try the sparse system for compact basis functions. Its uniform grid sorts the vertices by all coordinates,
+  // hence, we cannot use it in case of dead axis.
   bool decompositionSuccessful = false;
-  if constexpr (RADIAL_BASIS_FUNCTION_T::isStrictlyPositiveDefinite()) {
-    _decMatrixC             = buildMatrixCLU(basisFunction, inputMesh, inputIDs, activeAxis, polynomial).llt();
-    decompositionSuccessful = _decMatrixC.info() == Eigen::ComputationInfo::Success;
-  } else {
-    _decMatrixC             = buildMatrixCLU(basisFunction, inputMesh, inputIDs, activeAxis, polynomial).colPivHouseholderQr();
-    decompositionSuccessful = _decMatrixC.isInvertible();
+  if constexpr (RADIAL_BASIS_FUNCTION_T::hasCompactSupport()) {
+    const bool noDeadAxis = std::all_of(activeAxis.begin(), activeAxis.begin() + inputMesh.getDimensions(), [](auto ax) { return ax; });
+    if (noDeadAxis && polynomial != Polynomial::ON && inputIDs.size() >= sparseMinimalSize) {
+      decompositionSuccessful = computeSparseSystem(basisFunction, inputMesh, inputIDs, outputMesh, outputIDs, activeAxis, polynomial);
+    }
+  }
+
+  // Otherwise, assemble the dense interpolation matrix and check the invertability
+  if (!isSparse()) {
+    if constexpr (RADIAL_BASIS_FUNCTION_T::isStrictlyPositiveDefinite()) {
+      _decMatrixC             = buildMatrixCLU(basisFunction, inputMesh, inputIDs, activeAxis, polynomial).llt();
+      decompositionSuccessful = _decMatrixC.info() == Eigen::ComputationInfo::Success;
+    } else {
+      _decMatrixC             = buildMatrixCLU(basisFunction, inputMesh, inputIDs, activeAxis, polynomial).colPivHouseholderQr();
+      decompositionSuccessful = _decMatrixC.isInvertible();
+    }
   }
 
   PRECICE_CHECK(decompositionSuccessful,
@@ -349,14 +408,21 @@ RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::RadialBasisFctSolver(RADIAL_BASIS
                 "your basis-function (e.g. reduce the support-radius).",
                 inputMesh.getName(), outputMesh.getName());
 
+  // The LOOCV requires the inverse diagonal, which the sparse decomposition does not provide
+  PRECICE_WARN_IF(computeCrossValidation && isSparse(),
+                  "The cross validation error (LOOCV) of the RBF mapping from mesh \"{}\" to mesh \"{}\" is not computed, "
+                  "as the mapping uses a sparse interpolation matrix.",
+                  inputMesh.getName(), outputMesh.getName());
   // For polynomial on, the algorithm might fail in determining the size of the system
-  if (polynomial != Polynomial::ON && computeCrossValidation) {
+  if (polynomial != Polynomial::ON && computeCrossValidation && !isSparse()) {
     // TODO: Disable synchronization
     precice::profiling::Event e("map.rbf.computeLOOCV");
     _inverseDiagonal = computeInverseDiagonal(_decMatrixC);
   }
-  // Second, assemble evaluation matrix
-  _matrixA = buildMatrixA(basisFunction, inputMesh, inputIDs, outputMesh, outputIDs, activeAxis, polynomial);
+  // Second, assemble evaluation matrix, which the sparse system has done already
+  if (!isSparse()) {
+    _matrixA = buildMatrixA(basisFunction, inputMesh, inputIDs, outputMesh, outputIDs, activeAxis, polynomial);
+  }
 
   // In case we deal with separated polynomials, we need dedicated matrices for the polynomial contribution
   if (polynomial == Polynomial::SEPARATE) {
@@ -395,18 +461,111 @@ RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::RadialBasisFctSolver(RADIAL_BASIS
   }
 }
 
+template <typename RADIAL_BASIS_FUNCTION_T>
+template <typename IndexContainer>
+bool RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::computeSparseSystem(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh::Mesh &inputMesh, const IndexContainer &inputIDs,
+                                                                        const mesh::Mesh &outputMesh, const IndexContainer &outputIDs, std::array<bool, 3> activeAxis, Polynomial polynomial)
+{
+  // The integrated polynomial would add dense rows and columns
+  PRECICE_ASSERT(polynomial != Polynomial::ON);
+  using Triplet = Eigen::Triplet<double>;
+
+  const Eigen::Index n             = inputIDs.size();
+  const double       supportRadius = basisFunction.getSupportRadius();
+
+  // Sort the input vertices into a uniform grid with the support radius as cell width, such that all input vertices
+  // within the support radius of a point are located in the adjacent cells. We don't use a query::Index here, as it
+  // creates profiling events, and the solver may be constructed concurrently (see SphericalVertexCluster).
+  using Cell = std::array<std::int64_t, 3>;
+
+  const int dimensions = inputMesh.getDimensions();
+  auto      toCell     = [&](const mesh::Vertex::RawCoords &coords) {
+    Cell cell{{0, 0, 0}};
+    for (int d = 0; d < dimensions; ++d) {
+      cell[d] = static_cast<std::int64_t>(std::floor(coords[d] / supportRadius));
+    }
+    return cell;
+  };
+
+  std::vector<const mesh::Vertex *>          inputVertices;
+  std::vector<std::pair<Cell, Eigen::Index>> cells;
+  inputVertices.reserve(n);
+  cells.reserve(n);
+  for (auto id : inputIDs) {
+    cells.emplace_back(toCell(inputMesh.vertex(id).rawCoords()), inputVertices.size());
+    inputVertices.push_back(&inputMesh.vertex(id));
+  }
+  std::sort(cells.begin(), cells.end());
+
+  // Appends the entries of all input vertices within the support radius to the given row
+  const int    nAdjacentCells       = dimensions == 2 ? 9 : 27;
+  const double squaredSupportRadius = supportRadius * supportRadius;
+  auto         appendRow            = [&](std::vector<Triplet> &triplets, Eigen::Index row, const mesh::Vertex &vertex) {
+    const auto &u      = vertex.rawCoords();
+    const Cell  center = toCell(u);
+    Cell        adjacent{center};
+    for (int offset = 0; offset < nAdjacentCells; ++offset) {
+      for (int d = 0, rest = offset; d < dimensions; ++d, rest /= 3) {
+        adjacent[d] = center[d] + rest % 3 - 1;
+      }
+      auto entry = std::lower_bound(cells.begin(), cells.end(), adjacent, [](const auto &e, const Cell &cell) { return e.first < cell; });
+      for (; entry != cells.end() && entry->first == adjacent; ++entry) {
+        const auto   col               = entry->second;
+        const double squaredDifference = computeSquaredDifference(u, inputVertices[col]->rawCoords(), activeAxis);
+        if (squaredDifference <= squaredSupportRadius) {
+          triplets.emplace_back(row, col, basisFunction.evaluate(std::sqrt(squaredDifference)));
+        }
+      }
+    }
+  };
+
+  // First, the interpolation matrix. We stop early, if the fill gets too large for a sparse decomposition.
+  const double         maxNonZeros = sparseMaximalFill * static_cast<double>(n) * static_cast<double>(n);
+  std::vector<Triplet> triplets;
+  for (Eigen::Index i = 0; i < n; ++i) {
+    appendRow(triplets, i, *inputVertices[i]);
+    if (static_cast<double>(triplets.size()) > maxNonZeros) {
+      PRECICE_DEBUG("The interpolation matrix exceeds the fill of {} for a sparse system. Using a dense system instead.", sparseMaximalFill);
+      return false;
+    }
+  }
+
+  SparseMatrixType matrixC(n, n);
+  matrixC.setFromTriplets(triplets.begin(), triplets.end());
+  triplets.clear();
+
+  auto decomposition = std::make_unique<SparseDecompositionType>();
+  decomposition->compute(matrixC);
+  if (decomposition->info() != Eigen::ComputationInfo::Success) {
+    PRECICE_DEBUG("The sparse decomposition of the interpolation matrix failed. Using a dense system instead.");
+    return false;
+  }
+  PRECICE_DEBUG("Using a sparse interpolation matrix with {} nonzeros for {} input vertices", matrixC.nonZeros(), n);
+
+  // Second, the evaluation matrix
+  Eigen::Index row = 0;
+  for (auto id : outputIDs) {
+    appendRow(triplets, row, outputMesh.vertex(id));
+    ++row;
+  }
+  _sparseMatrixA.resize(row, n);
+  _sparseMatrixA.setFromTriplets(triplets.begin(), triplets.end());
+  _sparseDecMatrixC = std::move(decomposition);
+  return true;
+}
+
 template <typename RADIAL_BASIS_FUNCTION_T>
 Eigen::VectorXd RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::solveConservative(const Eigen::VectorXd &inputData, Polynomial polynomial) const
 {
   PRECICE_ASSERT((_matrixV.size() > 0 && polynomial == Polynomial::SEPARATE) || _matrixV.size() == 0, _matrixV.size());
   // TODO: Avoid temporary allocations
   // Au is equal to the eta in our PETSc implementation
-  PRECICE_ASSERT(inputData.size() == _matrixA.rows());
-  Eigen::VectorXd Au = _matrixA.transpose() * inputData;
-  PRECICE_ASSERT(Au.size() == _matrixA.cols());
+  PRECICE_ASSERT(inputData.size() == getOutputSize());
+  Eigen::VectorXd Au = isSparse() ? static_cast<Eigen::VectorXd>(_sparseMatrixA.transpose() * inputData) : static_cast<Eigen::VectorXd>(_matrixA.transpose() * inputData);
+  PRECICE_ASSERT(Au.size() == getInputSize());
 
   // mu in the PETSc implementation
-  Eigen::VectorXd out = _decMatrixC.solve(Au);
+  Eigen::VectorXd out = isSparse() ? static_cast<Eigen::VectorXd>(_sparseDecMatrixC->solve(Au)) : static_cast<Eigen::VectorXd>(_decMatrixC.solve(Au));
 
   if (polynomial == Polynomial::SEPARATE) {
     Eigen::VectorXd epsilon = _matrixV.transpose() * inputData;
@@ -434,15 +593,15 @@ Eigen::VectorXd RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::solveConsistent(E
   }
 
   // Integrated polynomial (and separated)
-  PRECICE_ASSERT(inputData.size() == _matrixA.cols());
-  Eigen::VectorXd p = _decMatrixC.solve(inputData);
+  PRECICE_ASSERT(inputData.size() == getInputSize());
+  Eigen::VectorXd p = isSparse() ? static_cast<Eigen::VectorXd>(_sparseDecMatrixC->solve(inputData)) : static_cast<Eigen::VectorXd>(_decMatrixC.solve(inputData));
 
-  if (polynomial != Polynomial::ON && computeCrossValidation) {
+  if (polynomial != Polynomial::ON && computeCrossValidation && !isSparse()) {
     precice::profiling::Event e("map.rbf.evaluateLOOCV");
     PRECICE_INFO("Cross validation error (LOOCV): {}", evaluateRippaLOOCVerror(p));
   }
-  PRECICE_ASSERT(p.size() == _matrixA.cols());
-  Eigen::VectorXd out = _matrixA * p;
+  PRECICE_ASSERT(p.size() == getInputSize());
+  Eigen::VectorXd out = isSparse() ? static_cast<Eigen::VectorXd>(_sparseMatrixA * p) : static_cast<Eigen::VectorXd>(_matrixA * p);
 
   // Add the polynomial part again for separated polynomial
   if (polynomial == Polynomial::SEPARATE) {
@@ -451,23 +610,52 @@ Eigen::VectorXd RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::solveConsistent(E
   return out;
 }
 
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::MatrixXd RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::computeConsistentOperator(Polynomial polynomial) const
+{
+  PRECICE_ASSERT((_matrixQ.size() > 0 && polynomial == Polynomial::SEPARATE) || _matrixQ.size() == 0);
+  // The same steps as in solveConsistent, applied to all unit vectors at once
+  Eigen::MatrixXd rhs = Eigen::MatrixXd::Identity(getInputSize(), getInputSize());
+  Eigen::MatrixXd polynomialContribution;
+  if (polynomial == Polynomial::SEPARATE) {
+    polynomialContribution = _qrMatrixQ.solve(rhs);
+    rhs -= _matrixQ * polynomialContribution;
+  }
+
+  Eigen::MatrixXd p   = isSparse() ? static_cast<Eigen::MatrixXd>(_sparseDecMatrixC->solve(rhs)) : static_cast<Eigen::MatrixXd>(_decMatrixC.solve(rhs));
+  Eigen::MatrixXd out = isSparse() ? static_cast<Eigen::MatrixXd>(_sparseMatrixA * p) : static_cast<Eigen::MatrixXd>(_matrixA * p);
+
+  if (polynomial == Polynomial::SEPARATE) {
+    out += _matrixV * polynomialContribution;
+  }
+  return out;
+}
+
 template <typename RADIAL_BASIS_FUNCTION_T>
 void RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::clear()
 {
   _matrixA    = Eigen::MatrixXd();
   _decMatrixC = DecompositionType();
+  _sparseMatrixA.resize(0, 0);
+  _sparseDecMatrixC.reset();
 }
 
 template <typename RADIAL_BASIS_FUNCTION_T>
 Eigen::Index RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::getInputSize() const
 {
-  return _matrixA.cols();
+  return isSparse() ? _sparseMatrixA.cols() : _matrixA.cols();
 }
 
 template <typename RADIAL_BASIS_FUNCTION_T>
 Eigen::Index RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::getOutputSize() const
 {
-  return _matrixA.rows();
+  return isSparse() ? _sparseMatrixA.rows() : _matrixA.rows();
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+bool RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::isSparse() const
+{
+  return _sparseDecMatrixC != nullptr;
 }
 } // namespace mapping
 } // namespace precice
@@ -233,6 +233,9 @@ MappingConfiguration::MappingConfiguration(
                              .setDocumentation("Value between 0 and 1 indicating the relative overlap between clusters. A value of 0.15 is usually a good trade-off between accuracy and efficiency.");
   auto projectToInput = XMLAttribute<bool>(ATTR_PROJECT_TO_INPUT, true)
                             .setDocumentation("If enabled, places the cluster centers at the closest vertex of the input mesh. Should be enabled in case of non-uniform point distributions such as for shell structures.");
+  auto precomputeOperator = XMLAttribute<bool>(ATTR_PRECOMPUTE_OPERATOR, false)
+                                .setDocumentation("If enabled, consistent mappings precompute the mapping operator of each cluster, such that every mapping evaluation requires a single matrix product per cluster. "
+                                                  "This makes computing the mapping more expensive and evaluating it cheaper. Clusters using a sparse system are not affected. Has no effect on conservative mappings.");
 
   auto attrGeoMultiscaleType = XMLAttribute<std::string>(ATTR_GEOMETRIC_MULTISCALE_TYPE)
                                    .setDocumentation("Type of geometric multiscale mapping. Either 'spread' or 'collect'.")
@@ -243,11 +246,19 @@ MappingConfiguration::MappingConfiguration(
   auto attrGeoMultiscaleRadius = XMLAttribute<double>(ATTR_GEOMETRIC_MULTISCALE_RADIUS)
                                      .setDocumentation("Radius of the circular interface between the 1D and 3D participant.");
 
+  auto attrProjectionNThreads = makeXMLAttribute(ATTR_N_THREADS, 1)
+                                    .setDocumentation("Number of threads per rank used to compute the projections or enclosing cells of all vertices. A value of \"0\" uses all hardware threads.");
+
   // Add the relevant attributes to the relevant tags
   addAttributes(projectionTags, {attrFromMesh, attrToMesh, attrDirection, attrConstraint});
+  for (XMLTag &tag : projectionTags) {
+    if (tag.getName() == TYPE_NEAREST_PROJECTION || tag.getName() == TYPE_LINEAR_CELL_INTERPOLATION) {
+      tag.addAttribute(attrProjectionNThreads);
+    }
+  }
   addAttributes(rbfDirectTags, {attrFromMesh, attrToMesh, attrDirection, attrConstraint, attrPolynomial, attrXDead, attrYDead, attrZDead});
   addAttributes(rbfIterativeTags, {attrFromMesh, attrToMesh, attrDirection, attrConstraint, attrPolynomial, attrXDead, attrYDead, attrZDead, attrSolverRtol});
-  addAttributes(pumDirectTags, {attrFromMesh, attrToMesh, attrDirection, attrConstraint, attrPumPolynomial, verticesPerCluster, relativeOverlap, projectToInput});
+  addAttributes(pumDirectTags, {attrFromMesh, attrToMesh, attrDirection, attrConstraint, attrPumPolynomial, verticesPerCluster, relativeOverlap, projectToInput, precomputeOperator});
   addAttributes(rbfAliasTag, {attrFromMesh, attrToMesh, attrDirection, attrConstraint, attrXDead, attrYDead, attrZDead});
   addAttributes(geoMultiscaleTags, {attrFromMesh, attrToMesh, attrDirection, attrConstraint, attrGeoMultiscaleType, attrGeoMultiscaleAxis, attrGeoMultiscaleRadius});
 
@@ -289,8 +300,13 @@ MappingConfiguration::MappingConfiguration(
   }
   {
     std::list<XMLTag> cpuExecutor{
-        XMLTag{*this, EXECUTOR_CPU, once, SUBTAG_EXECUTOR}.setDocumentation("The default (and currently only) executor using a CPU and a distributed memory parallelism via MPI.")};
+        XMLTag{*this, EXECUTOR_CPU, once, SUBTAG_EXECUTOR}.setDocumentation("The default executor using a CPU and a distributed memory parallelism via MPI.")};
+    std::list<XMLTag> ompExecutor{
+        XMLTag{*this, EXECUTOR_OMP, once, SUBTAG_EXECUTOR}.setDocumentation("OpenMP executor, which computes and evaluates the clusters on multiple CPU threads per rank in addition to the distributed memory parallelism via MPI. A value of \"0\" for the number of threads uses all hardware threads.")};
+
+    addAttributes(ompExecutor, {attrNThreads});
     addSubtagsToParents(cpuExecutor, pumDirectTags);
+    addSubtagsToParents(ompExecutor, pumDirectTags);
   }
   // The alias tag doesn't receive the subtag at all
 
@@ -390,6 +406,10 @@ void MappingConfiguration::xmlTagCallback(
     std::string geoMultiscaleAxis = tag.getStringAttributeValue(ATTR_GEOMETRIC_MULTISCALE_AXIS, "");
     double      multiscaleRadius  = tag.getDoubleAttributeValue(ATTR_GEOMETRIC_MULTISCALE_RADIUS, 1.0);
 
+    // threading of the nearest-projection and linear-cell-interpolation mappings
+    int nThreads = tag.getIntAttributeValue(ATTR_N_THREADS, 1);
+    PRECICE_CHECK(nThreads >= 0, "The number of threads of the {} mapping from mesh {} to mesh {} cannot be negative.", type, fromMesh, toMesh);
+
     if (type == TYPE_AXIAL_GEOMETRIC_MULTISCALE || type == TYPE_RADIAL_GEOMETRIC_MULTISCALE) {
       PRECICE_CHECK(_experimental, "Axial geometric multiscale is experimental and the configuration can change between minor releases. Set experimental=\"on\" in the precice-configuration tag.");
     }
@@ -406,6 +426,7 @@ void MappingConfiguration::xmlTagCallback(
     int    verticesPerCluster = tag.getIntAttributeValue(ATTR_VERTICES_PER_CLUSTER, 100);
     double relativeOverlap    = tag.getDoubleAttributeValue(ATTR_RELATIVE_OVERLAP, 0.3);
     bool   projectToInput     = tag.getBooleanAttributeValue(ATTR_PROJECT_TO_INPUT, true);
+    bool   precomputeOperator = tag.getBooleanAttributeValue(ATTR_PRECOMPUTE_OPERATOR, false);
 
     // Convert raw string into enum types as the constructors take enums
     if (constraint == CONSTRAINT_CONSERVATIVE) {
@@ -420,9 +441,9 @@ void MappingConfiguration::xmlTagCallback(
       PRECICE_UNREACHABLE("Unknown mapping constraint \"{}\".", constraint);
     }
 
-    ConfiguredMapping configuredMapping = createMapping(dir, type, fromMesh, toMesh, geoMultiscaleType, geoMultiscaleAxis, multiscaleRadius);
+    ConfiguredMapping configuredMapping = createMapping(dir, type, fromMesh, toMesh, geoMultiscaleType, geoMultiscaleAxis, multiscaleRadius, nThreads);
 
-    _rbfConfig = configureRBFMapping(type, strPolynomial, xDead, yDead, zDead, solverRtol, verticesPerCluster, relativeOverlap, projectToInput);
+    _rbfConfig = configureRBFMapping(type, strPolynomial, xDead, yDead, zDead, solverRtol, verticesPerCluster, relativeOverlap, projectToInput, precomputeOperator);
 
     checkDuplicates(configuredMapping);
     _mappings.push_back(configuredMapping);
@@ -481,7 +502,8 @@ MappingConfiguration::RBFConfiguration MappingConfiguration::configureRBFMapping
                                                                                  double solverRtol,
                                                                                  double verticesPerCluster,
                                                                                  double relativeOverlap,
-                                                                                 bool   projectToInput) const
+                                                                                 bool   projectToInput,
+                                                                                 bool   precomputeOperator) const
 {
   RBFConfiguration rbfConfig;
 
@@ -515,6 +537,7 @@ MappingConfiguration::RBFConfiguration MappingConfiguration::configureRBFMapping
   rbfConfig.verticesPerCluster = verticesPerCluster;
   rbfConfig.relativeOverlap    = relativeOverlap;
   rbfConfig.projectToInput     = projectToInput;
+  rbfConfig.precomputeOperator = precomputeOperator;
 
   return rbfConfig;
 }
@@ -526,7 +549,8 @@ MappingConfiguration::ConfiguredMapping MappingConfiguration::createMapping(
     const std::string &toMeshName,
     const std::string &geoMultiscaleType,
     const std::string &geoMultiscaleAxis,
-    const double &     multiscaleRadius) const
+    const double &     multiscaleRadius,
+    int                nThreads) const
 {
   PRECICE_TRACE(direction, type);
 
@@ -564,9 +588,9 @@ MappingConfiguration::ConfiguredMapping MappingConfiguration::createMapping(
   if (type == TYPE_NEAREST_NEIGHBOR) {
     configuredMapping.mapping = PtrMapping(new NearestNeighborMapping(constraintValue, fromMesh->getDimensions()));
   } else if (type == TYPE_NEAREST_PROJECTION) {
-    configuredMapping.mapping = PtrMapping(new NearestProjectionMapping(constraintValue, fromMesh->getDimensions()));
+    configuredMapping.mapping = PtrMapping(new NearestProjectionMapping(constraintValue, fromMesh->getDimensions(), static_cast<unsigned int>(nThreads)));
   } else if (type == TYPE_LINEAR_CELL_INTERPOLATION) {
-    configuredMapping.mapping = PtrMapping(new LinearCellInterpolationMapping(constraintValue, fromMesh->getDimensions()));
+    configuredMapping.mapping = PtrMapping(new LinearCellInterpolationMapping(constraintValue, fromMesh->getDimensions(), static_cast<unsigned int>(nThreads)));
   } else if (type == TYPE_NEAREST_NEIGHBOR_GRADIENT) {
 
     // NNG is not applicable with the conservative constraint
@@ -680,6 +704,8 @@ void MappingConfiguration::finishRBFConfiguration()
 {
   PRECICE_ASSERT(_executorConfig);
   ConfiguredMapping &mapping = _mappings.back();
+  // Global systems are gathered on the primary rank or solved in parallel, hence, every map() communicates
+  mapping.isCollective = _rbfConfig.solver != RBFConfiguration::SystemSolver::PUMDirect;
   // Instantiate the RBF mapping classes
   // We first categorize according to the executor
   // 1. the CPU executor
@@ -696,11 +722,15 @@ void MappingConfiguration::finishRBFConfiguration()
       PRECICE_CHECK(false, "The global-iterative RBF solver on a CPU requires a preCICE build with PETSc enabled.");
 #endif
     } else if (_rbfConfig.solver == RBFConfiguration::SystemSolver::PUMDirect) {
-      mapping.mapping = getRBFMapping<RBFBackend::PUM>(_rbfConfig.basisFunction, constraintValue, mapping.fromMesh->getDimensions(), _rbfConfig.supportRadius, _rbfConfig.shapeParameter, _rbfConfig.polynomial, _rbfConfig.verticesPerCluster, _rbfConfig.relativeOverlap, _rbfConfig.projectToInput);
+      mapping.mapping = getRBFMapping<RBFBackend::PUM>(_rbfConfig.basisFunction, constraintValue, mapping.fromMesh->getDimensions(), _rbfConfig.supportRadius, _rbfConfig.shapeParameter, _rbfConfig.polynomial, _rbfConfig.verticesPerCluster, _rbfConfig.relativeOverlap, _rbfConfig.projectToInput, 1u, _rbfConfig.precomputeOperator);
     } else {
       PRECICE_UNREACHABLE("Unknown RBF solver.");
     }
-    // 2. any other executor is configured via Ginkgo
+    // 2. the OpenMP executor of the partition of unity mapping, which distributes the clusters over CPU threads
+  } else if (_executorConfig->executor == ExecutorConfiguration::Executor::OpenMP && _rbfConfig.solver == RBFConfiguration::SystemSolver::PUMDirect) {
+    PRECICE_CHECK(_executorConfig->nThreads >= 0, "The number of threads of the openmp executor (configured for the mapping from mesh {} to mesh {}) cannot be negative.", mapping.fromMesh->getName(), mapping.toMesh->getName());
+    mapping.mapping = getRBFMapping<RBFBackend::PUM>(_rbfConfig.basisFunction, constraintValue, mapping.fromMesh->getDimensions(), _rbfConfig.supportRadius, _rbfConfig.shapeParameter, _rbfConfig.polynomial, _rbfConfig.verticesPerCluster, _rbfConfig.relativeOverlap, _rbfConfig.projectToInput, static_cast<unsigned int>(_executorConfig->nThreads), _rbfConfig.precomputeOperator);
+    // 3. any other executor is configured via Ginkgo
   } else {
 #ifndef PRECICE_NO_GINKGO
     _ginkgoParameter                   = GinkgoParameter();
@@ -34,6 +34,8 @@ public:
     bool requiresBasisFunction;
     /// used the automatic rbf alias tag in order to set the mapping
     bool configuredWithAliasTag = false;
+    /// true if map() communicates between the ranks of a parallel participant, as for global RBF mappings
+    bool isCollective = false;
   };
 
   struct GinkgoParameter {
@@ -92,6 +94,7 @@ public:
     int                 verticesPerCluster{};
     double              relativeOverlap{};
     bool                projectToInput{};
+    bool                precomputeOperator{};
     BasisFunction       basisFunction{};
     double              supportRadius{};
     double              shapeParameter{};
@@ -172,6 +175,7 @@ private:
   const std::string ATTR_VERTICES_PER_CLUSTER = "vertices-per-cluster";
   const std::string ATTR_RELATIVE_OVERLAP     = "relative-overlap";
   const std::string ATTR_PROJECT_TO_INPUT     = "project-to-input";
+  const std::string ATTR_PRECOMPUTE_OPERATOR  = "precompute-operator";
 
   // We declare the basis function as subtag
   const std::string SUBTAG_BASIS_FUNCTION = "basis-function";
@@ -263,7 +267,8 @@ private:
       const std::string &toMeshName,
       const std::string &geoMultiscaleType,
       const std::string &geoMultiscaleAxis,
-      const double &     multiscaleRadius) const;
+      const double &     multiscaleRadius,
+      int                nThreads) const;
 
   /**
    * Stores additional information about the requested RBF mapping such as the
@@ -277,7 +282,8 @@ private:
                                        double solverRtol,
                                        double verticesPerCluster,
                                        double relativeOverlap,
-                                       bool   projectToInput) const;
+                                       bool   projectToInput,
+                                       bool   precomputeOperator) const;
 
   void finishRBFConfiguration();
 
@@ -39,25 +39,36 @@ public:
    * the vertexIDs of the input mesh and the output mesh lying within the spherical domain of the cluster.
    * Note that the index trees of the meshes are constructed in case they are empty.
    * If there are no input vertices or output verices in the given domain ( \p center and \p radius ),
-   * the cluster is considered empty ( see also \ref empty() ) and the constructor returns immediately.
-   * If the cluster is non-empty, an RBF solver is constructed. The RBF solver assembles the mapping
-   * matrices and computes the matrix decomposition directly.
+   * the cluster is considered empty ( see also \ref empty() ).
+   * The local RBF system is not assembled here, see \ref computeSolver().
    *
    * @param[in] center Spatial center of the vertex cluster
    * @param[in] radius Spatial radius of the cluster associated to the \p center
-   * @param[in] function Radial basis function type used in interpolation
    * @param[in] polynomial The polynomial treatment in the RBF system.
    * @param[in] inputMesh mesh where the interpolants are build on, i.e., the input mesh for consistent
    *                      mappings and the output mesh for conservative mappings
    * @param[in] outputMesh mesh where we evaluate the interpolants, i.e., the output mesh consistent
    *                      mappings and the input mesh for conservative mappings
    */
-  SphericalVertexCluster(mesh::Vertex            center,
-                         double                  radius,
-                         RADIAL_BASIS_FUNCTION_T function,
-                         Polynomial              polynomial,
-                         mesh::PtrMesh           inputMesh,
-                         mesh::PtrMesh           outputMesh);
+  SphericalVertexCluster(mesh::Vertex  center,
+                         double        radius,
+                         Polynomial    polynomial,
+                         mesh::PtrMesh inputMesh,
+                         mesh::PtrMesh outputMesh);
+
+  /**
+   * Constructs the RBF solver of a non-empty cluster, which assembles the mapping matrices and computes
+   * the matrix decomposition directly.
+   *
+   * The function only reads the given meshes, creates no profiling events, and logs solely through the
+   * logger owned by the solver of this cluster. Hence, it may be called concurrently for different clusters
+   * of the same mapping.
+   *
+   * @param[in] function Radial basis function type used in interpolation
+   * @param[in] inputMesh the input mesh passed to the constructor
+   * @param[in] outputMesh the output mesh passed to the constructor
+   */
+  void computeSolver(RADIAL_BASIS_FUNCTION_T function, const mesh::Mesh &inputMesh, const mesh::Mesh &outputMesh);
 
   /// Evaluates a conservative mapping and agglomerates the result in the given output data
   void mapConservative(const time::Sample &inData, Eigen::VectorXd &outData) const;
@@ -68,6 +79,14 @@ public:
   /// Set the normalized weight for the given \p vertexID in the outputMesh
   void setNormalizedWeight(double normalizedWeight, VertexID vertexID);
 
+  /**
+   * Precomputes the weighted operator of a consistent mapping and releases the RBF solver.
+   * Afterwards, \ref mapConsistent() requires a single matrix product for all data components.
+   * Clusters with a sparse RBF solver keep the solver, as the dense operator would require more memory.
+   * Requires all normalized weights to be set.
+   */
+  void computeConsistentOperator();
+
   /// Compute the weight for a given vertex
   double computeWeight(const mesh::Vertex &v) const;
 
@@ -112,6 +131,9 @@ private:
   /// (consistent mapping) or input mesh data (conservative data)
   Eigen::VectorXd _normalizedWeights;
 
+  /// Weighted consistent mapping operator (output x input), replaces the RBF solver if computed
+  Eigen::MatrixXd _consistentOperator;
+
   /// Polynomial treatment in the RBF solver
   Polynomial _polynomial;
 
@@ -126,12 +148,11 @@ private:
 
 template <typename RADIAL_BASIS_FUNCTION_T>
 SphericalVertexCluster<RADIAL_BASIS_FUNCTION_T>::SphericalVertexCluster(
-    mesh::Vertex            center,
-    double                  radius,
-    RADIAL_BASIS_FUNCTION_T function,
-    Polynomial              polynomial,
-    mesh::PtrMesh           inputMesh,
-    mesh::PtrMesh           outputMesh)
+    mesh::Vertex  center,
+    double        radius,
+    Polynomial    polynomial,
+    mesh::PtrMesh inputMesh,
+    mesh::PtrMesh outputMesh)
     : _center(center), _radius(radius), _polynomial(polynomial), _weightingFunction(radius)
 {
   PRECICE_TRACE(_center.getCoords(), _radius);
@@ -157,6 +178,14 @@ SphericalVertexCluster<RADIAL_BASIS_FUNCTION_T>::SphericalVertexCluster(
 
   PRECICE_DEBUG("SphericalVertexCluster input size: {}", inIDs.size());
   PRECICE_DEBUG("SphericalVertexCluster output size: {}", outIDs.size());
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void SphericalVertexCluster<RADIAL_BASIS_FUNCTION_T>::computeSolver(RADIAL_BASIS_FUNCTION_T function, const mesh::Mesh &inputMesh, const mesh::Mesh &outputMesh)
+{
+  // Empty partitions shouldn't be stored at all
+  PRECICE_ASSERT(!empty());
+  PRECICE_ASSERT(!_hasComputedMapping);
 
   // The polynomial system is underdetermined if inIDs.size() < dimension + 1. However, the dynamic adoption of the axis in the RBF solver
   // disables axis, if necessary. Hence, we don't disable the complete polynomial here for underdetermined systems. The case should anyway
@@ -164,9 +193,8 @@ SphericalVertexCluster<RADIAL_BASIS_FUNCTION_T>::SphericalVertexCluster(
 
   // Construct the solver. Here, the constructor of the RadialBasisFctSolver computes already the decompositions etc, such that we can mark the
   // mapping in this cluster as computed (mostly for debugging purpose)
-  std::vector<bool>         deadAxis(inputMesh->getDimensions(), false);
-  precice::profiling::Event e("map.pou.computeMapping.rbfSolver");
-  _rbfSolver          = RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>{function, *inputMesh.get(), _inputIDs, *outputMesh.get(), _outputIDs, deadAxis, _polynomial};
+  std::vector<bool> deadAxis(inputMesh.getDimensions(), false);
+  _rbfSolver          = RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>{function, inputMesh, _inputIDs, outputMesh, _outputIDs, deadAxis, _polynomial};
   _hasComputedMapping = true;
 }
 
@@ -187,6 +215,22 @@ void SphericalVertexCluster<RADIAL_BASIS_FUNCTION_T>::setNormalizedWeight(double
   _normalizedWeights[localID] = normalizedWeight;
 }
 
+template <typename RADIAL_BASIS_FUNCTION_T>
+void SphericalVertexCluster<RADIAL_BASIS_FUNCTION_T>::computeConsistentOperator()
+{
+  PRECICE_ASSERT(!empty());
+  PRECICE_ASSERT(_hasComputedMapping);
+  PRECICE_ASSERT(_normalizedWeights.size() == static_cast<Eigen::Index>(_outputIDs.size()));
+
+  if (_rbfSolver.isSparse()) {
+    return;
+  }
+  // The integrated polynomial isn't supported here, i.e., the input size of the solver matches the input vertices
+  _consistentOperator = _normalizedWeights.asDiagonal() * _rbfSolver.computeConsistentOperator(_polynomial);
+  PRECICE_ASSERT(_consistentOperator.cols() == static_cast<Eigen::Index>(_inputIDs.size()));
+  _rbfSolver.clear();
+}
+
 template <typename RADIAL_BASIS_FUNCTION_T>
 void SphericalVertexCluster<RADIAL_BASIS_FUNCTION_T>::mapConservative(const time::Sample &inData, Eigen::VectorXd &outData) const
 {
@@ -239,6 +283,29 @@ void SphericalVertexCluster<RADIAL_BASIS_FUNCTION_T>::mapConsistent(const time::
   const unsigned int nComponents = inData.dataDims;
   const auto &       localInData = inData.values;
 
+  // With a precomputed operator, we map all components using a single matrix product
+  if (_consistentOperator.size() > 0) {
+    Eigen::MatrixXd in(_inputIDs.size(), nComponents);
+    for (unsigned int i = 0; i < _inputIDs.size(); ++i) {
+      const auto dataIndex = *(_inputIDs.nth(i));
+      for (unsigned int c = 0; c < nComponents; ++c) {
+        PRECICE_ASSERT(dataIndex * nComponents + c < localInData.size(), dataIndex * nComponents + c, localInData.size());
+        in(i, c) = localInData[dataIndex * nComponents + c];
+      }
+    }
+
+    // The operator includes the weighting already
+    const Eigen::MatrixXd result = _consistentOperator * in;
+    for (unsigned int i = 0; i < _outputIDs.size(); ++i) {
+      const auto dataIndex = *(_outputIDs.nth(i));
+      for (unsigned int c = 0; c < nComponents; ++c) {
+        PRECICE_ASSERT(dataIndex * nComponents + c < outData.size(), dataIndex * nComponents + c, outData.size());
+        outData[dataIndex * nComponents + c] += result(i, c);
+      }
+    }
+    return;
+  }
+
   Eigen::VectorXd in(_rbfSolver.getInputSize());
 
   // Now we perform the data mapping component-wise
@@ -300,6 +367,7 @@ void SphericalVertexCluster<RADIAL_BASIS_FUNCTION_T>::clear()
   _inputIDs.clear();
   _outputIDs.clear();
   _rbfSolver.clear();
+  _consistentOperator = Eigen::MatrixXd();
   _hasComputedMapping = false;
 }
 } // namespace mapping
@@ -296,5 +296,58 @@ BOOST_AUTO_TEST_CASE(ConservativeOneTetra3D)
   BOOST_CHECK(equals(netForce, outValuesScalar.sum()));
 }
 
+BOOST_AUTO_TEST_CASE(ConsistentThreaded)
+{
+  PRECICE_TEST(1_rank);
+  constexpr int dimensions = 2;
+  constexpr int n          = 10;
+
+  // Triangulated unit square
+  PtrMesh inMesh(new Mesh("InMesh", dimensions, testing::nextMeshID()));
+  for (int i = 0; i <= n; ++i) {
+    for (int j = 0; j <= n; ++j) {
+      inMesh->createVertex(Eigen::Vector2d(static_cast<double>(i) / n, static_cast<double>(j) / n));
+    }
+  }
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      Vertex &v0 = inMesh->vertex(i * (n + 1) + j);
+      Vertex &v1 = inMesh->vertex((i + 1) * (n + 1) + j);
+      Vertex &v2 = inMesh->vertex(i * (n + 1) + j + 1);
+      Vertex &v3 = inMesh->vertex((i + 1) * (n + 1) + j + 1);
+      inMesh->createTriangle(v0, v1, v3);
+      inMesh->createTriangle(v0, v3, v2);
+    }
+  }
+  Eigen::VectorXd inValues(inMesh->nVertices());
+  for (const auto &v : inMesh->vertices()) {
+    inValues(v.getID()) = 1.0 + v.coord(0) - 3 * v.coord(1);
+  }
+
+  // Vertices inside and outside of the square, the latter fall back to nearest projection
+  PtrMesh outMesh(new Mesh("OutMesh", dimensions, testing::nextMeshID()));
+  for (int i = 0; i < 2 * n; ++i) {
+    for (int j = 0; j < 2 * n; ++j) {
+      outMesh->createVertex(Eigen::Vector2d(-0.1 + i * 0.06, -0.1 + j * 0.06));
+    }
+  }
+
+  auto runMapping = [&](unsigned int nThreads) {
+    precice::mapping::LinearCellInterpolationMapping mapping(precice::mapping::Mapping::CONSISTENT, dimensions, nThreads);
+    mapping.setMeshes(inMesh, outMesh);
+    inMesh->index().clear();
+    mapping.computeMapping();
+    Eigen::VectorXd outValues = Eigen::VectorXd::Zero(outMesh->nVertices());
+    mapping.map(time::Sample{1, inValues}, outValues);
+    return outValues;
+  };
+
+  const Eigen::VectorXd serialValues = runMapping(1);
+  BOOST_TEST(serialValues(0) == 1.0);
+  for (unsigned int nThreads : {2u, 3u, 0u}) {
+    BOOST_TEST(serialValues == runMapping(nThreads), boost::test_tools::per_element());
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
@@ -114,9 +114,36 @@ BOOST_AUTO_TEST_CASE(RBFPUMConfiguration)
     BOOST_TEST(mappingConfig.rbfConfig().verticesPerCluster == 10);
     BOOST_TEST(mappingConfig.rbfConfig().relativeOverlap == 0.4);
     BOOST_TEST(mappingConfig.rbfConfig().projectToInput == true);
+    BOOST_TEST(mappingConfig.rbfConfig().precomputeOperator == true);
   }
 }
 
+BOOST_AUTO_TEST_CASE(RBFPUMOMPConfiguration)
+{
+  PRECICE_TEST(1_rank);
+
+  std::string pathToTests = testing::getPathToSources() + "/mapping/tests/";
+  std::string file(pathToTests + "mapping-rbf-pum-omp-config.xml");
+  using xml::XMLTag;
+  XMLTag                        tag = xml::getRootTag();
+  mesh::PtrDataConfiguration    dataConfig(new mesh::DataConfiguration(tag));
+  mesh::PtrMeshConfiguration    meshConfig(new mesh::MeshConfiguration(tag, dataConfig));
+  mapping::MappingConfiguration mappingConfig(tag, meshConfig);
+  xml::configure(tag, xml::ConfigurationContext{}, file);
+
+  BOOST_TEST(meshConfig->meshes().size() == 3);
+  BOOST_TEST(mappingConfig.mappings().size() == 2);
+  for (unsigned int i = 0; i < mappingConfig.mappings().size(); ++i) {
+    BOOST_TEST(mappingConfig.mappings().at(i).mapping != nullptr);
+    BOOST_TEST(mappingConfig.mappings().at(i).mapping->getName() == "partition-of-unity RBF");
+    BOOST_TEST(mappingConfig.mappings().at(i).fromMesh == meshConfig->meshes().at(i + 1));
+    BOOST_TEST(mappingConfig.mappings().at(i).toMesh == meshConfig->meshes().at(i));
+    BOOST_TEST(mappingConfig.mappings().at(i).requiresBasisFunction == true);
+  }
+  bool solverSelection = mappingConfig.rbfConfig().solver == MappingConfiguration::RBFConfiguration::SystemSolver::PUMDirect;
+  BOOST_TEST(solverSelection);
+}
+
 #ifndef PRECICE_NO_PETSC
 
 BOOST_AUTO_TEST_CASE(RBFIterativeConfiguration)
@@ -1,5 +1,7 @@
 #include <Eigen/Core>
 #include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <memory>
 #include <ostream>
 #include "mapping/Mapping.hpp"
@@ -723,5 +725,66 @@ BOOST_AUTO_TEST_CASE(TriangleDistances)
   BOOST_TEST(values(0) == 1.0);
 }
 
+/// Compares the threaded computation of the mapping to the serial one on a triangulated curved surface
+BOOST_AUTO_TEST_CASE(ThreadedComputeMappingBenchmark)
+{
+  PRECICE_TEST(1_rank);
+  using namespace precice::mesh;
+  constexpr int dimensions = 3;
+  constexpr int n          = 30;
+
+  PtrMesh inMesh(new Mesh("InMesh", dimensions, testing::nextMeshID()));
+  for (int i = 0; i <= n; ++i) {
+    for (int j = 0; j <= n; ++j) {
+      const double x = static_cast<double>(i) / n;
+      const double y = static_cast<double>(j) / n;
+      inMesh->createVertex(Eigen::Vector3d(x, y, 0.1 * std::sin(3 * x) * std::cos(2 * y)));
+    }
+  }
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      auto &v0 = inMesh->vertex(i * (n + 1) + j);
+      auto &v1 = inMesh->vertex((i + 1) * (n + 1) + j);
+      auto &v2 = inMesh->vertex(i * (n + 1) + j + 1);
+      auto &v3 = inMesh->vertex((i + 1) * (n + 1) + j + 1);
+      makeTriangle(inMesh, v0, v1, v3);
+      makeTriangle(inMesh, v0, v3, v2);
+    }
+  }
+  Eigen::VectorXd inValues(inMesh->nVertices());
+  for (const auto &v : inMesh->vertices()) {
+    inValues(v.getID()) = v.coord(0) + 2 * v.coord(1);
+  }
+
+  PtrMesh outMesh(new Mesh("OutMesh", dimensions, testing::nextMeshID()));
+  for (int i = 0; i < 3 * n; ++i) {
+    for (int j = 0; j < 3 * n; ++j) {
+      outMesh->createVertex(Eigen::Vector3d(0.01 + i / (3.0 * n), 0.02 + j / (3.0 * n), 0.05));
+    }
+  }
+
+  using Clock = std::chrono::steady_clock;
+  auto runMapping = [&](unsigned int nThreads) {
+    precice::mapping::NearestProjectionMapping mapping(precice::mapping::Mapping::CONSISTENT, dimensions, nThreads);
+    mapping.setMeshes(inMesh, outMesh);
+    inMesh->index().clear();
+    const auto start = Clock::now();
+    mapping.computeMapping();
+    const std::chrono::duration<double, std::milli> elapsed = Clock::now() - start;
+
+    Eigen::VectorXd outValues = Eigen::VectorXd::Zero(outMesh->nVertices());
+    mapping.map(time::Sample{1, inValues}, outValues);
+    return std::make_pair(outValues, elapsed.count());
+  };
+
+  const auto [serialValues, serialTime]     = runMapping(1);
+  const auto [threadedValues, threadedTime] = runMapping(4);
+
+  // The interpolations are collected in vertex order, hence the results are identical
+  BOOST_TEST(serialValues == threadedValues, boost::test_tools::per_element());
+  BOOST_TEST_MESSAGE("Nearest-projection computeMapping on " << outMesh->nVertices() << " vertices: serial "
+                                                             << serialTime << "ms, 4 threads " << threadedTime << "ms");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
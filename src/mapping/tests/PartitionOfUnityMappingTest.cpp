@@ -1,5 +1,6 @@
 #include <Eigen/Core>
 #include <algorithm>
+#include <cmath>
 #include <memory>
 #include <ostream>
 #include <string>
@@ -1140,6 +1141,187 @@ BOOST_AUTO_TEST_CASE(PartitionOfUnityMappingTests)
   perform3DTestConservativeMappingVector(conservativeMap3DVector);
 }
 
+BOOST_AUTO_TEST_CASE(PartitionOfUnityMappingThreadedTests)
+{
+  PRECICE_TEST(1_rank);
+  mapping::CompactPolynomialC0                          function(3);
+  mapping::PartitionOfUnityMapping<CompactPolynomialC0> consistentMap3D(Mapping::CONSISTENT, 3, function, Polynomial::SEPARATE, 5, 0.265, false, 3);
+  perform3DTestConsistentMapping(consistentMap3D);
+  mapping::PartitionOfUnityMapping<CompactPolynomialC0> consistentMap3DVector(Mapping::CONSISTENT, 3, function, Polynomial::SEPARATE, 5, 0.265, false, 3);
+  perform3DTestConsistentMappingVector(consistentMap3DVector);
+  mapping::PartitionOfUnityMapping<CompactPolynomialC0> conservativeMap3D(Mapping::CONSERVATIVE, 3, function, Polynomial::SEPARATE, 5, 0.265, false, 3);
+  perform3DTestConservativeMapping(conservativeMap3D);
+  mapping::PartitionOfUnityMapping<CompactPolynomialC0> conservativeMap3DVector(Mapping::CONSERVATIVE, 3, function, Polynomial::SEPARATE, 5, 0.265, false, 0);
+  perform3DTestConservativeMappingVector(conservativeMap3DVector);
+}
+
+// Compares the threaded mapping to the serial one on meshes with many clusters
+BOOST_AUTO_TEST_CASE(PartitionOfUnityMappingThreadsMatchSerial)
+{
+  PRECICE_TEST(1_rank);
+  const int dimensions = 3;
+
+  mesh::PtrMesh inMesh(new mesh::Mesh("InMesh", dimensions, testing::nextMeshID()));
+  mesh::PtrData inData = inMesh->createData("InData", 1, 0_dataID);
+  for (int i = 0; i < 8; ++i) {
+    for (int j = 0; j < 8; ++j) {
+      for (int k = 0; k < 8; ++k) {
+        inMesh->createVertex(Eigen::Vector3d(i / 7., j / 7., k / 7.));
+      }
+    }
+  }
+  inMesh->allocateDataValues();
+  addGlobalIndex(inMesh);
+  for (const auto &v : inMesh->vertices()) {
+    inData->values()(v.getID()) = v.coord(0) + 2 * v.coord(1) * v.coord(1) + std::sin(3 * v.coord(2));
+  }
+
+  mesh::PtrMesh outMesh(new mesh::Mesh("OutMesh", dimensions, testing::nextMeshID()));
+  mesh::PtrData outData = outMesh->createData("OutData", 1, 1_dataID);
+  for (int i = 0; i < 6; ++i) {
+    for (int j = 0; j < 6; ++j) {
+      for (int k = 0; k < 6; ++k) {
+        outMesh->createVertex(Eigen::Vector3d(0.05 + i / 6., 0.05 + j / 6., 0.05 + k / 6.));
+      }
+    }
+  }
+  outMesh->allocateDataValues();
+  addGlobalIndex(outMesh);
+
+  for (auto constraint : {Mapping::CONSISTENT, Mapping::CONSERVATIVE}) {
+    mesh::PtrMesh from     = constraint == Mapping::CONSISTENT ? inMesh : outMesh;
+    mesh::PtrMesh to       = constraint == Mapping::CONSISTENT ? outMesh : inMesh;
+    mesh::PtrData fromData = constraint == Mapping::CONSISTENT ? inData : outData;
+    mesh::PtrData toData   = constraint == Mapping::CONSISTENT ? outData : inData;
+    if (constraint == Mapping::CONSERVATIVE) {
+      fromData->values() = Eigen::VectorXd::LinSpaced(fromData->values().size(), 1., 2.);
+    }
+
+    std::vector<Eigen::VectorXd> results;
+    for (unsigned int nThreads : {1, 2, 4}) {
+      mapping::PartitionOfUnityMapping<CompactPolynomialC6> mapping(constraint, dimensions, CompactPolynomialC6(0.8), Polynomial::SEPARATE, 20, 0.3, false, nThreads);
+      mapping.setMeshes(from, to);
+      mapping.computeMapping();
+      toData->values().setZero();
+      mapping.map(fromData->getID(), toData->getID());
+      results.push_back(toData->values());
+    }
+    BOOST_TEST(results[0].norm() > 0);
+    BOOST_TEST(testing::equals(results[0], results[1], 1e-12));
+    BOOST_TEST(testing::equals(results[0], results[2], 1e-12));
+  }
+}
+
+// Clusters of at least RadialBasisFctSolver::sparseMinimalSize vertices assemble sparse systems in the worker threads
+BOOST_AUTO_TEST_CASE(PartitionOfUnityMappingThreadedSparseClusters)
+{
+  PRECICE_TEST(1_rank);
+  const int dimensions = 2;
+
+  mesh::PtrMesh inMesh(new mesh::Mesh("InMesh", dimensions, testing::nextMeshID()));
+  mesh::PtrData inData = inMesh->createData("InData", 1, 0_dataID);
+  for (int i = 0; i < 100; ++i) {
+    for (int j = 0; j < 100; ++j) {
+      inMesh->createVertex(Eigen::Vector2d(i / 99., j / 99.));
+    }
+  }
+  inMesh->allocateDataValues();
+  addGlobalIndex(inMesh);
+  for (const auto &v : inMesh->vertices()) {
+    inData->values()(v.getID()) = v.coord(0) + std::sin(3 * v.coord(1));
+  }
+
+  mesh::PtrMesh outMesh(new mesh::Mesh("OutMesh", dimensions, testing::nextMeshID()));
+  mesh::PtrData outData = outMesh->createData("OutData", 1, 1_dataID);
+  for (int i = 0; i < 40; ++i) {
+    for (int j = 0; j < 40; ++j) {
+      outMesh->createVertex(Eigen::Vector2d(0.01 + i / 40., 0.01 + j / 40.));
+    }
+  }
+  outMesh->allocateDataValues();
+  addGlobalIndex(outMesh);
+
+  std::vector<Eigen::VectorXd> results;
+  for (unsigned int nThreads : {1, 4}) {
+    mapping::PartitionOfUnityMapping<CompactPolynomialC2> mapping(Mapping::CONSISTENT, dimensions, CompactPolynomialC2(0.03), Polynomial::SEPARATE, 1500, 0.3, false, nThreads);
+    mapping.setMeshes(inMesh, outMesh);
+    mapping.computeMapping();
+    outData->values().setZero();
+    mapping.map(inData->getID(), outData->getID());
+    results.push_back(outData->values());
+  }
+  BOOST_TEST(results[0].norm() > 0);
+  BOOST_TEST(testing::equals(results[0], results[1], 1e-12));
+}
+
+BOOST_AUTO_TEST_CASE(PartitionOfUnityMappingPrecomputedOperatorTests)
+{
+  PRECICE_TEST(1_rank);
+  Polynomial                                            polynomial = Polynomial::SEPARATE;
+  mapping::CompactPolynomialC0                          function(3);
+  mapping::PartitionOfUnityMapping<CompactPolynomialC0> consistentMap2D(Mapping::CONSISTENT, 2, function, polynomial, 5, 0.4, false, 1, true);
+  perform2DTestConsistentMapping(consistentMap2D);
+  mapping::PartitionOfUnityMapping<CompactPolynomialC0> consistentMap2DVector(Mapping::CONSISTENT, 2, function, polynomial, 5, 0.4, false, 1, true);
+  perform2DTestConsistentMappingVector(consistentMap2DVector);
+  mapping::PartitionOfUnityMapping<CompactPolynomialC6> consistentMap2DDeadAxis(Mapping::CONSISTENT, 2, mapping::CompactPolynomialC6(6), polynomial, 5, 0.4, false, 1, true);
+  performTestConsistentMapDeadAxis(consistentMap2DDeadAxis, 2);
+  mapping::PartitionOfUnityMapping<CompactPolynomialC0> consistentMap3D(Mapping::CONSISTENT, 3, function, polynomial, 5, 0.265, false, 2, true);
+  perform3DTestConsistentMapping(consistentMap3D);
+  mapping::PartitionOfUnityMapping<CompactPolynomialC0> consistentMap3DVector(Mapping::CONSISTENT, 3, function, polynomial, 5, 0.265, false, 2, true);
+  perform3DTestConsistentMappingVector(consistentMap3DVector);
+  // Has no effect on conservative mappings
+  mapping::PartitionOfUnityMapping<CompactPolynomialC0> conservativeMap3DVector(Mapping::CONSERVATIVE, 3, function, polynomial, 5, 0.265, false, 1, true);
+  perform3DTestConservativeMappingVector(conservativeMap3DVector);
+}
+
+// Compares the precomputed operators to the cluster solvers for vector data
+BOOST_AUTO_TEST_CASE(PartitionOfUnityMappingPrecomputedOperatorMatchesSolver)
+{
+  PRECICE_TEST(1_rank);
+  const int dimensions = 3;
+
+  mesh::PtrMesh inMesh(new mesh::Mesh("InMesh", dimensions, testing::nextMeshID()));
+  mesh::PtrData inData = inMesh->createData("InData", dimensions, 0_dataID);
+  for (int i = 0; i < 8; ++i) {
+    for (int j = 0; j < 8; ++j) {
+      for (int k = 0; k < 8; ++k) {
+        inMesh->createVertex(Eigen::Vector3d(i / 7., j / 7., k / 7.));
+      }
+    }
+  }
+  inMesh->allocateDataValues();
+  addGlobalIndex(inMesh);
+  for (const auto &v : inMesh->vertices()) {
+    inData->values()(v.getID() * dimensions)     = v.coord(0) + 2 * v.coord(1) * v.coord(1);
+    inData->values()(v.getID() * dimensions + 1) = std::sin(3 * v.coord(2));
+    inData->values()(v.getID() * dimensions + 2) = 1. - v.coord(0) * v.coord(2);
+  }
+
+  mesh::PtrMesh outMesh(new mesh::Mesh("OutMesh", dimensions, testing::nextMeshID()));
+  mesh::PtrData outData = outMesh->createData("OutData", dimensions, 1_dataID);
+  for (int i = 0; i < 6; ++i) {
+    for (int j = 0; j < 6; ++j) {
+      for (int k = 0; k < 6; ++k) {
+        outMesh->createVertex(Eigen::Vector3d(0.05 + i / 6., 0.05 + j / 6., 0.05 + k / 6.));
+      }
+    }
+  }
+  outMesh->allocateDataValues();
+  addGlobalIndex(outMesh);
+
+  std::vector<Eigen::VectorXd> results;
+  for (bool precomputeOperator : {false, true}) {
+    mapping::PartitionOfUnityMapping<CompactPolynomialC6> mapping(Mapping::CONSISTENT, dimensions, CompactPolynomialC6(0.8), Polynomial::SEPARATE, 20, 0.3, false, 1, precomputeOperator);
+    mapping.setMeshes(inMesh, outMesh);
+    mapping.computeMapping();
+    outData->values().setZero();
+    mapping.map(inData->getID(), outData->getID());
+    results.push_back(outData->values());
+  }
+  BOOST_TEST(results[0].norm() > 0);
+  BOOST_TEST(testing::equals(results[0], results[1], 1e-10));
+}
+
 // Test for small meshes, where the number of requested vertices per cluster is bigger than the global
 BOOST_AUTO_TEST_CASE(TestSingleClusterPartitionOfUnity)
 {
@@ -1,6 +1,8 @@
+#include <chrono>
 #include <vector>
 #include "Eigen/Core"
 #include "mapping/Polation.hpp"
+#include "math/barycenter.hpp"
 #include "mesh/Edge.hpp"
 #include "mesh/Triangle.hpp"
 #include "mesh/Vertex.hpp"
@@ -303,5 +305,49 @@ BOOST_AUTO_TEST_CASE(PolationToleranceTetra)
   BOOST_TEST(polation.isInterpolation());
 }
 
+/// Projections on a triangle as performed per vertex by the nearest-projection mapping
+BOOST_AUTO_TEST_CASE(TriangleProjectionBenchmark)
+{
+  PRECICE_TEST(1_rank);
+  mesh::Vertex   v1(Eigen::Vector3d(0.0, 0.0, 0.0), 0);
+  mesh::Vertex   v2(Eigen::Vector3d(2.0, 0.0, 0.0), 1);
+  mesh::Vertex   v3(Eigen::Vector3d(1.0, 2.0, 0.0), 2);
+  mesh::Edge     e1(v1, v2);
+  mesh::Edge     e2(v2, v3);
+  mesh::Edge     e3(v1, v3);
+  mesh::Triangle triangle(e1, e2, e3);
+
+  const int       repetitions = 100000;
+  Eigen::VectorXd location(3);
+
+  using Clock      = std::chrono::steady_clock;
+  const auto start = Clock::now();
+  double     dynamicSum{0.0};
+  for (int i = 0; i < repetitions; ++i) {
+    location << 1.0, 0.6, 1.0 + i * 1e-6;
+    // Dynamically-sized coordinates as returned by Vertex::getCoords()
+    const Eigen::VectorXd a          = triangle.vertex(0).getCoords();
+    const Eigen::VectorXd b          = triangle.vertex(1).getCoords();
+    const Eigen::VectorXd c          = triangle.vertex(2).getCoords();
+    const Eigen::Vector3d bcoords    = math::barycenter::calcBarycentricCoordsForTriangle(a, b, c, location);
+    const Eigen::VectorXd projection = a * bcoords(0) + b * bcoords(1) + c * bcoords(2);
+    dynamicSum += (location - projection).norm();
+  }
+  const auto middle = Clock::now();
+  double     fixedSum{0.0};
+  for (int i = 0; i < repetitions; ++i) {
+    location << 1.0, 0.6, 1.0 + i * 1e-6;
+    fixedSum += Polation(location, triangle).distance();
+  }
+  const auto end = Clock::now();
+
+  BOOST_TEST(fixedSum == dynamicSum, boost::test_tools::tolerance(1e-12));
+
+  const std::chrono::duration<double, std::nano> dynamicTime = middle - start;
+  const std::chrono::duration<double, std::nano> fixedTime   = end - middle;
+  BOOST_TEST_MESSAGE("Triangle projection: dynamic size " << dynamicTime.count() / repetitions << "ns, "
+                                                          << "fixed size " << fixedTime.count() / repetitions << "ns");
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Interpolation
 BOOST_AUTO_TEST_SUITE_END() // Mapping
@@ -1557,6 +1557,72 @@ BOOST_AUTO_TEST_CASE(DeadAxis3DConervative)
   testDeadAxis3d(Polynomial::SEPARATE, Mapping::CONSERVATIVE);
 }
 
+// Large systems of compact basis functions are assembled and decomposed as sparse matrices
+BOOST_AUTO_TEST_CASE(SparseSystem)
+{
+  PRECICE_TEST(1_rank);
+  const int dimensions = 3;
+
+  mesh::Mesh inMesh("InMesh", dimensions, testing::nextMeshID());
+  for (int i = 0; i < 10; ++i) {
+    for (int j = 0; j < 10; ++j) {
+      for (int k = 0; k < 10; ++k) {
+        inMesh.createVertex(Eigen::Vector3d(i / 9., j / 9., k / 9.));
+      }
+    }
+  }
+  mesh::Mesh outMesh("OutMesh", dimensions, testing::nextMeshID());
+  for (int i = 0; i < 7; ++i) {
+    for (int j = 0; j < 7; ++j) {
+      for (int k = 0; k < 7; ++k) {
+        outMesh.createVertex(Eigen::Vector3d(0.07 + i * 0.14, 0.07 + j * 0.14, 0.07 + k * 0.14));
+      }
+    }
+  }
+  const auto inIDs  = boost::irange<Eigen::Index>(0, inMesh.nVertices());
+  const auto outIDs = boost::irange<Eigen::Index>(0, outMesh.nVertices());
+
+  CompactPolynomialC2 function(0.22);
+  BOOST_TEST_REQUIRE(inMesh.nVertices() >= RadialBasisFctSolver<CompactPolynomialC2>::sparseMinimalSize);
+
+  Eigen::VectorXd inValues(inMesh.nVertices());
+  for (const auto &v : inMesh.vertices()) {
+    inValues(v.getID()) = 1 + 2 * v.coord(0) - v.coord(1) + 0.5 * v.coord(2);
+  }
+
+  {
+    // Compare against the dense system
+    RadialBasisFctSolver<CompactPolynomialC2> solver(function, inMesh, inIDs, outMesh, outIDs, {false, false, false}, Polynomial::OFF);
+    BOOST_TEST(solver.isSparse());
+    BOOST_TEST(solver.getInputSize() == inMesh.nVertices());
+    BOOST_TEST(solver.getOutputSize() == outMesh.nVertices());
+
+    const std::array<bool, 3> activeAxis{{true, true, true}};
+    Eigen::MatrixXd           matrixA = buildMatrixA(function, inMesh, inIDs, outMesh, outIDs, activeAxis, Polynomial::OFF);
+    auto                      llt     = buildMatrixCLU(function, inMesh, inIDs, activeAxis, Polynomial::OFF).llt();
+
+    Eigen::VectorXd in       = inValues;
+    Eigen::VectorXd expected = matrixA * llt.solve(inValues);
+    BOOST_TEST(testing::equals(solver.solveConsistent(in, Polynomial::OFF), expected, 1e-9));
+
+    Eigen::VectorXd outValues    = Eigen::VectorXd::LinSpaced(outMesh.nVertices(), 1., 2.);
+    Eigen::VectorXd conservative = llt.solve(matrixA.transpose() * outValues);
+    BOOST_TEST(testing::equals(solver.solveConservative(outValues, Polynomial::OFF), conservative, 1e-9));
+  }
+  {
+    // The separated polynomial reproduces linear functions
+    RadialBasisFctSolver<CompactPolynomialC2> solver(function, inMesh, inIDs, outMesh, outIDs, {false, false, false}, Polynomial::SEPARATE);
+    BOOST_TEST(solver.isSparse());
+    Eigen::VectorXd in       = inValues;
+    Eigen::VectorXd result   = solver.solveConsistent(in, Polynomial::SEPARATE);
+    Eigen::VectorXd expected = Eigen::VectorXd::Zero(outMesh.nVertices());
+    for (const auto &v : outMesh.vertices()) {
+      expected(v.getID()) = 1 + 2 * v.coord(0) - v.coord(1) + 0.5 * v.coord(2);
+    }
+    BOOST_TEST(testing::equals(result, expected, 1e-9));
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Serial
 
 BOOST_AUTO_TEST_SUITE(Helper)
@@ -8,28 +8,23 @@
 
 namespace precice::math::barycenter {
 
+template <int Dim>
 Eigen::Vector2d calcBarycentricCoordsForEdge(
-    const Eigen::VectorXd &a,
-    const Eigen::VectorXd &b,
-    const Eigen::VectorXd &u)
+    const Eigen::Matrix<double, Dim, 1> &a,
+    const Eigen::Matrix<double, Dim, 1> &b,
+    const Eigen::Matrix<double, Dim, 1> &u)
 {
-  using Eigen::Vector2d;
-  using Eigen::VectorXd;
-
-  const int dimensions = a.size();
-  PRECICE_ASSERT(dimensions == b.size(), "A and B need to have the same dimensions.", dimensions, b.size());
-  PRECICE_ASSERT(dimensions == u.size(), "A and the point need to have the same dimensions.", dimensions, u.size());
-  PRECICE_ASSERT((dimensions == 2) || (dimensions == 3), dimensions);
+  static_assert(Dim == 2 || Dim == 3);
+  using Vector = Eigen::Matrix<double, Dim, 1>;
 
-  Vector2d barycentricCoords;
-  VectorXd ab, au;
+  Eigen::Vector2d barycentricCoords;
 
   // Let AB be the edge and U the input point. We compute the projection P of U on the edge.
   // To find P, start from A and move from dot(AU, AB) / |AB| along the AB direction.
   // Divide again by |AB| to find the barycentric coordinate of P relative to U
   // This means we just need to compute dot(AU, AB) / dot(AB, AB)
-  ab = b - a;
-  au = u - a;
+  const Vector ab = b - a;
+  const Vector au = u - a;
 
   barycentricCoords(1) = au.dot(ab) / ab.dot(ab);
   barycentricCoords(0) = 1 - barycentricCoords(1);
@@ -37,30 +32,47 @@ Eigen::Vector2d calcBarycentricCoordsForEdge(
   return barycentricCoords;
 }
 
+template Eigen::Vector2d calcBarycentricCoordsForEdge<2>(const Eigen::Vector2d &, const Eigen::Vector2d &, const Eigen::Vector2d &);
+template Eigen::Vector2d calcBarycentricCoordsForEdge<3>(const Eigen::Vector3d &, const Eigen::Vector3d &, const Eigen::Vector3d &);
+
+Eigen::Vector2d calcBarycentricCoordsForEdge(
+    const Eigen::VectorXd &a,
+    const Eigen::VectorXd &b,
+    const Eigen::VectorXd &u)
+{
+  const int dimensions = a.size();
+  PRECICE_ASSERT(dimensions == b.size(), "A and B need to have the same dimensions.", dimensions, b.size());
+  PRECICE_ASSERT(dimensions == u.size(), "A and the point need to have the same dimensions.", dimensions, u.size());
+  PRECICE_ASSERT((dimensions == 2) || (dimensions == 3), dimensions);
+
+  if (dimensions == 2) {
+    return calcBarycentricCoordsForEdge<2>(a, b, u);
+  } else {
+    return calcBarycentricCoordsForEdge<3>(a, b, u);
+  }
+}
+
 static double crossProduct2D(const Eigen::Vector2d &u, const Eigen::Vector2d &v)
 {
   return u(0) * v(1) - u(1) * v(0);
 }
 
+template <int Dim>
 Eigen::Vector3d calcBarycentricCoordsForTriangle(
-    const Eigen::VectorXd &a,
-    const Eigen::VectorXd &b,
-    const Eigen::VectorXd &c,
-    const Eigen::VectorXd &u)
+    const Eigen::Matrix<double, Dim, 1> &a,
+    const Eigen::Matrix<double, Dim, 1> &b,
+    const Eigen::Matrix<double, Dim, 1> &c,
+    const Eigen::Matrix<double, Dim, 1> &u)
 {
+  static_assert(Dim == 2 || Dim == 3);
   using Eigen::Vector2d;
   using Eigen::Vector3d;
 
-  const int dimensions = a.size();
-  PRECICE_ASSERT(dimensions == b.size(), "A and B need to have the same dimensions.", dimensions, b.size());
-  PRECICE_ASSERT(dimensions == c.size(), "A and C need to have the same dimensions.", dimensions, c.size());
-  PRECICE_ASSERT(dimensions == u.size(), "A and the point need to have the same dimensions.", dimensions, u.size());
-
   Vector3d barycentricCoords;
   double   scaleFactor;
 
   // constant per triangle
-  if (dimensions == 3) {
+  if constexpr (Dim == 3) {
     Vector3d ab, ac, au, n;
 
     ab         = b - a;
@@ -98,23 +110,37 @@ Eigen::Vector3d calcBarycentricCoordsForTriangle(
   return barycentricCoords;
 }
 
-Eigen::Vector4d calcBarycentricCoordsForTetrahedron(
+template Eigen::Vector3d calcBarycentricCoordsForTriangle<2>(const Eigen::Vector2d &, const Eigen::Vector2d &, const Eigen::Vector2d &, const Eigen::Vector2d &);
+template Eigen::Vector3d calcBarycentricCoordsForTriangle<3>(const Eigen::Vector3d &, const Eigen::Vector3d &, const Eigen::Vector3d &, const Eigen::Vector3d &);
+
+Eigen::Vector3d calcBarycentricCoordsForTriangle(
     const Eigen::VectorXd &a,
     const Eigen::VectorXd &b,
     const Eigen::VectorXd &c,
-    const Eigen::VectorXd &d,
     const Eigen::VectorXd &u)
 {
-  using Eigen::Vector3d;
-  using Eigen::Vector4d;
-
   const int dimensions = a.size();
-
-  PRECICE_ASSERT(dimensions == 3, dimensions);
   PRECICE_ASSERT(dimensions == b.size(), "A and B need to have the same dimensions.", dimensions, b.size());
   PRECICE_ASSERT(dimensions == c.size(), "A and C need to have the same dimensions.", dimensions, c.size());
-  PRECICE_ASSERT(dimensions == d.size(), "A and D need to have the same dimensions.", dimensions, d.size());
   PRECICE_ASSERT(dimensions == u.size(), "A and the point need to have the same dimensions.", dimensions, u.size());
+  PRECICE_ASSERT((dimensions == 2) || (dimensions == 3), dimensions);
+
+  if (dimensions == 2) {
+    return calcBarycentricCoordsForTriangle<2>(a, b, c, u);
+  } else {
+    return calcBarycentricCoordsForTriangle<3>(a, b, c, u);
+  }
+}
+
+Eigen::Vector4d calcBarycentricCoordsForTetrahedron(
+    const Eigen::Vector3d &a,
+    const Eigen::Vector3d &b,
+    const Eigen::Vector3d &c,
+    const Eigen::Vector3d &d,
+    const Eigen::Vector3d &u)
+{
+  using Eigen::Vector3d;
+  using Eigen::Vector4d;
 
   Vector4d barycentricCoords;
 
@@ -144,4 +170,22 @@ Eigen::Vector4d calcBarycentricCoordsForTetrahedron(
   return barycentricCoords;
 }
 
+Eigen::Vector4d calcBarycentricCoordsForTetrahedron(
+    const Eigen::VectorXd &a,
+    const Eigen::VectorXd &b,
+    const Eigen::VectorXd &c,
+    const Eigen::VectorXd &d,
+    const Eigen::VectorXd &u)
+{
+  const int dimensions = a.size();
+
+  PRECICE_ASSERT(dimensions == 3, dimensions);
+  PRECICE_ASSERT(dimensions == b.size(), "A and B need to have the same dimensions.", dimensions, b.size());
+  PRECICE_ASSERT(dimensions == c.size(), "A and C need to have the same dimensions.", dimensions, c.size());
+  PRECICE_ASSERT(dimensions == d.size(), "A and D need to have the same dimensions.", dimensions, d.size());
+  PRECICE_ASSERT(dimensions == u.size(), "A and the point need to have the same dimensions.", dimensions, u.size());
+
+  return calcBarycentricCoordsForTetrahedron(Eigen::Vector3d(a), Eigen::Vector3d(b), Eigen::Vector3d(c), Eigen::Vector3d(d), Eigen::Vector3d(u));
+}
+
 } // namespace precice::math::barycenter
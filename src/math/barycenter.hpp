@@ -23,6 +23,13 @@ Eigen::Vector2d calcBarycentricCoordsForEdge(
     const Eigen::VectorXd &b,
     const Eigen::VectorXd &u);
 
+/// Allocation-free variant of calcBarycentricCoordsForEdge() for points of fixed dimension 2 or 3
+template <int Dim>
+Eigen::Vector2d calcBarycentricCoordsForEdge(
+    const Eigen::Matrix<double, Dim, 1> &a,
+    const Eigen::Matrix<double, Dim, 1> &b,
+    const Eigen::Matrix<double, Dim, 1> &u);
+
 /** Takes the corner vertices of a triangle and a point in 3D space.
  *  Returns the barycentric coordinates for that point's projection onto the given triangle.
  *
@@ -41,6 +48,14 @@ Eigen::Vector3d calcBarycentricCoordsForTriangle(
     const Eigen::VectorXd &c,
     const Eigen::VectorXd &u);
 
+/// Allocation-free variant of calcBarycentricCoordsForTriangle() for points of fixed dimension 2 or 3
+template <int Dim>
+Eigen::Vector3d calcBarycentricCoordsForTriangle(
+    const Eigen::Matrix<double, Dim, 1> &a,
+    const Eigen::Matrix<double, Dim, 1> &b,
+    const Eigen::Matrix<double, Dim, 1> &c,
+    const Eigen::Matrix<double, Dim, 1> &u);
+
 /** Takes the corner vertices of a tetrahedron and a point in 3D space.
  *  Returns the barycentric coordinates for that point's projection onto the given tetrahedron.
  *
@@ -61,6 +76,14 @@ Eigen::Vector4d calcBarycentricCoordsForTetrahedron(
     const Eigen::VectorXd &d,
     const Eigen::VectorXd &u);
 
+/// Allocation-free variant of calcBarycentricCoordsForTetrahedron()
+Eigen::Vector4d calcBarycentricCoordsForTetrahedron(
+    const Eigen::Vector3d &a,
+    const Eigen::Vector3d &b,
+    const Eigen::Vector3d &c,
+    const Eigen::Vector3d &d,
+    const Eigen::Vector3d &u);
+
 } // namespace barycenter
 } // namespace math
 } // namespace precice
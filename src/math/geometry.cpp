@@ -90,6 +90,25 @@ ResultConstants segmentPlaneIntersection(
   return INTERSECTION;
 }
 
+template <int Dim>
+double triangleArea(
+    const Eigen::Matrix<double, Dim, 1> &a,
+    const Eigen::Matrix<double, Dim, 1> &b,
+    const Eigen::Matrix<double, Dim, 1> &c)
+{
+  static_assert(Dim == 2 || Dim == 3);
+  const Eigen::Matrix<double, Dim, 1> A = b - a;
+  const Eigen::Matrix<double, Dim, 1> B = c - a;
+  if constexpr (Dim == 2) {
+    return 0.5 * std::fabs(A(0) * B(1) - A(1) * B(0));
+  } else {
+    return 0.5 * A.cross(B).norm();
+  }
+}
+
+template double triangleArea<2>(const Eigen::Vector2d &, const Eigen::Vector2d &, const Eigen::Vector2d &);
+template double triangleArea<3>(const Eigen::Vector3d &, const Eigen::Vector3d &, const Eigen::Vector3d &);
+
 double triangleArea(
     const Eigen::VectorXd &a,
     const Eigen::VectorXd &b,
@@ -98,18 +117,10 @@ double triangleArea(
   PRECICE_ASSERT(a.size() == b.size(), a.size(), b.size());
   PRECICE_ASSERT(b.size() == c.size(), b.size(), c.size());
   if (a.size() == 2) {
-    Eigen::Vector2d A = b;
-    A -= a;
-    Eigen::Vector2d B = c;
-    B -= a;
-    return 0.5 * std::fabs(A(0) * B(1) - A(1) * B(0));
+    return triangleArea<2>(a, b, c);
   } else {
     PRECICE_ASSERT(a.size() == 3, a.size());
-    Eigen::Vector3d A = b;
-    A -= a;
-    Eigen::Vector3d B = c;
-    B -= a;
-    return 0.5 * A.cross(B).norm();
+    return triangleArea<3>(a, b, c);
   }
 }
 
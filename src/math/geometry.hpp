@@ -119,6 +119,13 @@ double triangleArea(
     const Eigen::VectorXd &b,
     const Eigen::VectorXd &c);
 
+/// Allocation-free variant of triangleArea() for points of fixed dimension 2 or 3
+template <int Dim>
+double triangleArea(
+    const Eigen::Matrix<double, Dim, 1> &a,
+    const Eigen::Matrix<double, Dim, 1> &b,
+    const Eigen::Matrix<double, Dim, 1> &c);
+
 /// Computes the (unsigned) area of a triangle in 3D.
 double tetraVolume(
     const Eigen::Vector3d &a,
@@ -22,18 +22,23 @@ Edge::Edge(
 
 double Edge::getLength() const
 {
-  double length = (_vertices[1]->getCoords() - _vertices[0]->getCoords()).norm();
-  return length;
+  if (getDimensions() == 2) {
+    return (_vertices[1]->getCoords<2>() - _vertices[0]->getCoords<2>()).norm();
+  }
+  return (_vertices[1]->getCoords<3>() - _vertices[0]->getCoords<3>()).norm();
 }
 
 const Eigen::VectorXd Edge::getCenter() const
 {
-  return 0.5 * (_vertices[0]->getCoords() + _vertices[1]->getCoords());
+  if (getDimensions() == 2) {
+    return 0.5 * (_vertices[0]->getCoords<2>() + _vertices[1]->getCoords<2>());
+  }
+  return 0.5 * (_vertices[0]->getCoords<3>() + _vertices[1]->getCoords<3>());
 }
 
 double Edge::getEnclosingRadius() const
 {
-  return (_vertices[0]->getCoords() - getCenter()).norm();
+  return 0.5 * getLength();
 }
 
 bool Edge::connectedTo(const Edge &other) const
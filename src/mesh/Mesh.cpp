@@ -17,6 +17,7 @@
 #include "logging/LogMacros.hpp"
 #include "math/geometry.hpp"
 #include "mesh/Data.hpp"
+#include "mesh/Utils.hpp"
 #include "mesh/Vertex.hpp"
 #include "precice/impl/Types.hpp"
 #include "query/Index.hpp"
@@ -105,6 +106,7 @@ Vertex &Mesh::createVertex(const Eigen::VectorXd &coords)
   PRECICE_ASSERT(coords.size() == _dimensions, coords.size(), _dimensions);
   auto nextID = _vertices.size();
   _vertices.emplace_back(coords, nextID);
+  clearGeometry();
   return _vertices.back();
 }
 
@@ -113,6 +115,7 @@ Edge &Mesh::createEdge(
     Vertex &vertexTwo)
 {
   _edges.emplace_back(vertexOne, vertexTwo);
+  clearGeometry();
   return _edges.back();
 }
 
@@ -126,6 +129,7 @@ Triangle &Mesh::createTriangle(
       edgeTwo.connectedTo(edgeThree) &&
       edgeThree.connectedTo(edgeOne));
   _triangles.emplace_back(edgeOne, edgeTwo, edgeThree);
+  clearGeometry();
   return _triangles.back();
 }
 
@@ -135,6 +139,7 @@ Triangle &Mesh::createTriangle(
     Vertex &vertexThree)
 {
   _triangles.emplace_back(vertexOne, vertexTwo, vertexThree);
+  clearGeometry();
   return _triangles.back();
 }
 
@@ -145,6 +150,7 @@ Tetrahedron &Mesh::createTetrahedron(
     Vertex &vertexFour)
 {
   _tetrahedra.emplace_back(vertexOne, vertexTwo, vertexThree, vertexFour);
+  clearGeometry();
   return _tetrahedra.back();
 }
 
@@ -260,6 +266,7 @@ void Mesh::clear()
   _vertices.clear();
   _tetrahedra.clear();
   _index.clear();
+  clearGeometry();
 
   for (mesh::PtrData &data : _data) {
     data->values().resize(0);
@@ -385,10 +392,59 @@ void Mesh::expandBoundingBox(const BoundingBox &boundingBox)
   _boundingBox.expandBy(boundingBox);
 }
 
+const Eigen::VectorXd &Mesh::vertexAreas() const
+{
+  validateGeometry();
+  if (!_vertexAreas) {
+    _vertexAreas = computeVertexAreas(*this);
+  }
+  return *_vertexAreas;
+}
+
+const Eigen::VectorXd &Mesh::vertexVolumes() const
+{
+  validateGeometry();
+  if (!_vertexVolumes) {
+    _vertexVolumes = computeVertexVolumes(*this);
+  }
+  return *_vertexVolumes;
+}
+
+const Eigen::MatrixXd &Mesh::vertexCoordinates() const
+{
+  validateGeometry();
+  if (!_vertexCoordinates) {
+    _vertexCoordinates.emplace(_dimensions, nVertices());
+    for (const Vertex &vertex : _vertices) {
+      _vertexCoordinates->col(vertex.getID()) = vertex.getCoords();
+    }
+  }
+  return *_vertexCoordinates;
+}
+
+void Mesh::clearGeometry()
+{
+  _vertexAreas.reset();
+  _vertexVolumes.reset();
+  _vertexCoordinates.reset();
+}
+
+void Mesh::validateGeometry() const
+{
+  const auto generation = Vertex::coordinatesGeneration();
+  if (generation != _geometryGeneration) {
+    _vertexAreas.reset();
+    _vertexVolumes.reset();
+    _vertexCoordinates.reset();
+    _geometryGeneration = generation;
+  }
+}
+
 void Mesh::preprocess()
 {
   removeDuplicates();
   generateImplictPrimitives();
+  clearGeometry();
 }
 
 void Mesh::removeDuplicates()
@@ -1,10 +1,12 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <cstdint>
 #include <deque>
 #include <iosfwd>
 #include <list>
 #include <map>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -314,6 +316,34 @@ public:
 
   bool operator!=(const Mesh &other) const;
 
+  /**
+   * @brief Returns the surface measure lumped to each vertex.
+   *
+   * In 2D, a vertex gets half the length of each adjacent edge.
+   * In 3D, a vertex gets a third of the area of each adjacent triangle.
+   *
+   * The result is computed on first access and reused until vertices or connectivity are added or removed,
+   * or vertices are moved using Vertex::setCoords().
+   */
+  const Eigen::VectorXd &vertexAreas() const;
+
+  /**
+   * @brief Returns the volume measure lumped to each vertex.
+   *
+   * In 2D, a vertex gets a third of the area of each adjacent triangle.
+   * In 3D, a vertex gets a quarter of the volume of each adjacent tetrahedron.
+   *
+   * The result is computed on first access and reused like vertexAreas(), see computeVertexVolumes().
+   */
+  const Eigen::VectorXd &vertexVolumes() const;
+
+  /**
+   * @brief Returns the coordinates of all vertices as one contiguous matrix with a column per vertex.
+   *
+   * The result is computed on first access and reused like vertexAreas().
+   */
+  const Eigen::MatrixXd &vertexCoordinates() const;
+
   /// Call preprocess() before index() to ensure correct projection handling
   const query::Index &index() const
   {
@@ -394,6 +424,24 @@ private:
 
   query::Index _index;
 
+  /// Cached result of vertexAreas(), reset if the mesh changes
+  mutable std::optional<Eigen::VectorXd> _vertexAreas;
+
+  /// Cached result of vertexVolumes(), reset if the mesh changes
+  mutable std::optional<Eigen::VectorXd> _vertexVolumes;
+
+  /// Cached result of vertexCoordinates(), reset if the mesh changes
+  mutable std::optional<Eigen::MatrixXd> _vertexCoordinates;
+
+  /// Vertex::coordinatesGeneration() when the cached geometric quantities were computed
+  mutable std::uint64_t _geometryGeneration = 0;
+
+  /// Resets the cached geometric quantities
+  void clearGeometry();
+
+  /// Resets the cached geometric quantities if any vertex was moved since they were computed
+  void validateGeometry() const;
+
   /// Removes all duplicate connectivity.
   void removeDuplicates();
 
@@ -39,7 +39,7 @@ Tetrahedron::Tetrahedron(
 
 double Tetrahedron::getVolume() const
 {
-  return math::geometry::tetraVolume(vertex(0).getCoords(), vertex(1).getCoords(), vertex(2).getCoords(), vertex(3).getCoords());
+  return math::geometry::tetraVolume(vertex(0).getCoords<3>(), vertex(1).getCoords<3>(), vertex(2).getCoords<3>(), vertex(3).getCoords<3>());
 }
 
 int Tetrahedron::getDimensions() const
@@ -49,7 +49,7 @@ int Tetrahedron::getDimensions() const
 
 const Eigen::VectorXd Tetrahedron::getCenter() const
 {
-  return (vertex(0).getCoords() + vertex(1).getCoords() + vertex(2).getCoords() + vertex(3).getCoords()) / 4.0;
+  return (vertex(0).getCoords<3>() + vertex(1).getCoords<3>() + vertex(2).getCoords<3>() + vertex(3).getCoords<3>()) / 4.0;
 }
 
 double Tetrahedron::getEnclosingRadius() const
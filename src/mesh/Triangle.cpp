@@ -69,13 +69,17 @@ Triangle::Triangle(
 
 double Triangle::getArea() const
 {
-  return math::geometry::triangleArea(vertex(0).getCoords(), vertex(1).getCoords(), vertex(2).getCoords());
+  if (getDimensions() == 2) {
+    return math::geometry::triangleArea<2>(vertex(0).getCoords<2>(), vertex(1).getCoords<2>(), vertex(2).getCoords<2>());
+  }
+  return math::geometry::triangleArea<3>(vertex(0).getCoords<3>(), vertex(1).getCoords<3>(), vertex(2).getCoords<3>());
 }
 
 Eigen::VectorXd Triangle::computeNormal() const
 {
-  Eigen::Vector3d vectorA = (vertex(1).getCoords() - vertex(0).getCoords()) / 2.0;
-  Eigen::Vector3d vectorB = (vertex(1).getCoords() - vertex(0).getCoords()) / 2.0;
+  const Eigen::Vector3d a       = vertex(0).getCoords<3>();
+  const Eigen::Vector3d vectorA = vertex(1).getCoords<3>() - a;
+  const Eigen::Vector3d vectorB = vertex(2).getCoords<3>() - a;
 
   // Compute cross-product of vector A and vector B
   return vectorA.cross(vectorB).normalized();
@@ -88,7 +92,10 @@ int Triangle::getDimensions() const
 
 const Eigen::VectorXd Triangle::getCenter() const
 {
-  return (_vertices[0]->getCoords() + _vertices[1]->getCoords() + _vertices[2]->getCoords()) / 3.0;
+  if (getDimensions() == 2) {
+    return (_vertices[0]->getCoords<2>() + _vertices[1]->getCoords<2>() + _vertices[2]->getCoords<2>()) / 3.0;
+  }
+  return (_vertices[0]->getCoords<3>() + _vertices[1]->getCoords<3>() + _vertices[2]->getCoords<3>()) / 3.0;
 }
 
 double Triangle::getEnclosingRadius() const
@@ -138,6 +138,12 @@ std::array<Eigen::VectorXd, n> coordsFor(const std::array<Vertex *, n> &vertexPt
   return coords;
 }
 
+/// Computes the surface measure lumped to each vertex, see Mesh::vertexAreas() for the cached version
+Eigen::VectorXd computeVertexAreas(const Mesh &mesh);
+
+/// Computes the volume measure lumped to each vertex, see Mesh::vertexVolumes() for the cached version
+Eigen::VectorXd computeVertexVolumes(const Mesh &mesh);
+
 /// Given the data and the mesh, this function returns the surface integral. Assumes no overlap exists for the mesh
 Eigen::VectorXd integrateSurface(const PtrMesh &mesh, const Eigen::VectorXd &input);
 
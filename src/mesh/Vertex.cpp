@@ -4,6 +4,13 @@
 
 namespace precice::mesh {
 
+std::atomic<std::uint64_t> Vertex::_coordinatesGeneration{0};
+
+std::uint64_t Vertex::coordinatesGeneration()
+{
+  return _coordinatesGeneration.load(std::memory_order_relaxed);
+}
+
 int Vertex::getDimensions() const
 {
   return _dim;
@@ -2,6 +2,8 @@
 
 #include <Eigen/Core>
 #include <array>
+#include <atomic>
+#include <cstdint>
 #include <iostream>
 #include <utility>
 
@@ -31,12 +33,19 @@ public:
   template <typename VECTOR_T>
   void setCoords(const VECTOR_T &coordinates);
 
+  /// Returns a counter, which changes whenever the coordinates of any vertex are set
+  static std::uint64_t coordinatesGeneration();
+
   /// Returns the unique (among vertices of one mesh on one processor) ID of the vertex.
   VertexID getID() const;
 
   /// Returns the coordinates of the vertex.
   Eigen::VectorXd getCoords() const;
 
+  /// Returns the coordinates of the vertex as fixed-size vector, Dim has to match getDimensions()
+  template <int Dim>
+  Eigen::Matrix<double, Dim, 1> getCoords() const;
+
   /// Direct access to the coordinates
   const RawCoords &rawCoords() const;
 
@@ -81,6 +90,9 @@ private:
 
   /// true if this vertex is tagged for partition
   bool _tagged = false;
+
+  /// Incremented by setCoords(), allows meshes to detect moved vertices
+  static std::atomic<std::uint64_t> _coordinatesGeneration;
 };
 
 // ------------------------------------------------------ HEADER IMPLEMENTATION
@@ -106,6 +118,7 @@ void Vertex::setCoords(
   _coords[0] = coordinates[0];
   _coords[1] = coordinates[1];
   _coords[2] = (_dim == 3) ? coordinates[2] : 0.0;
+  _coordinatesGeneration.fetch_add(1, std::memory_order_relaxed);
 }
 
 inline VertexID Vertex::getID() const
@@ -120,6 +133,14 @@ inline Eigen::VectorXd Vertex::getCoords() const
   return v;
 }
 
+template <int Dim>
+Eigen::Matrix<double, Dim, 1> Vertex::getCoords() const
+{
+  static_assert(Dim == 2 || Dim == 3, "Vertices are either 2D or 3D");
+  PRECICE_ASSERT(_dim == Dim, _dim, Dim);
+  return Eigen::Map<const Eigen::Matrix<double, Dim, 1>>(_coords.data());
+}
+
 inline const Vertex::RawCoords &Vertex::rawCoords() const
 {
   return _coords;
@@ -783,6 +783,75 @@ BOOST_FIXTURE_TEST_CASE(Integrate3DVectorDataVolume, OneTetraFixture)
 
 BOOST_AUTO_TEST_SUITE_END() // VolumeIntegrals
 
+BOOST_AUTO_TEST_CASE(VertexAreasAndVolumes)
+{
+  PRECICE_TEST(1_rank);
+  Mesh mesh("Mesh1", 3, testing::nextMeshID());
+
+  auto &v1 = mesh.createVertex(Eigen::Vector3d(0.0, 0.0, 0.0));
+  auto &v2 = mesh.createVertex(Eigen::Vector3d(3.0, 0.0, 0.0));
+  auto &v3 = mesh.createVertex(Eigen::Vector3d(3.0, 4.0, 0.0));
+  auto &v4 = mesh.createVertex(Eigen::Vector3d(0.0, 8.0, 0.0));
+
+  mesh.createTriangle(v1, v2, v3); // Area = 6.0
+  mesh.createTriangle(v3, v4, v1); // Area = 12.0
+
+  Eigen::Vector4d expectedAreas(6.0, 2.0, 6.0, 4.0);
+  BOOST_TEST(mesh.vertexAreas() == expectedAreas);
+  BOOST_TEST(mesh.vertexVolumes() == Eigen::Vector4d::Zero());
+
+  // Repeated accesses return the cached result
+  BOOST_TEST(&mesh.vertexAreas() == &mesh.vertexAreas());
+
+  // New connectivity invalidates the cache
+  auto &v5 = mesh.createVertex(Eigen::Vector3d(0.0, 0.0, 1.0));
+  mesh.createTetrahedron(v1, v2, v3, v5); // Volume = 2.0
+  BOOST_TEST(mesh.vertexAreas().size() == 5);
+  BOOST_TEST(mesh.vertexAreas()(4) == 0.0);
+  Eigen::VectorXd expectedVolumes(5);
+  expectedVolumes << 0.5, 0.5, 0.5, 0.0, 0.5;
+  BOOST_TEST(mesh.vertexVolumes() == expectedVolumes);
+
+  // Moving a vertex invalidates the cache as well
+  v4.setCoords(Eigen::Vector3d(0.0, 4.0, 0.0)); // Area = 6.0
+  Eigen::VectorXd movedAreas(5);
+  movedAreas << 4.0, 2.0, 4.0, 2.0, 0.0;
+  BOOST_TEST(mesh.vertexAreas() == movedAreas);
+  BOOST_TEST(mesh.vertexVolumes() == expectedVolumes);
+
+  mesh.clear();
+  BOOST_TEST(mesh.vertexAreas().size() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(VertexCoordinates)
+{
+  PRECICE_TEST(1_rank);
+  Mesh  mesh("MyMesh", 3, testing::nextMeshID());
+  auto &v0 = mesh.createVertex(Eigen::Vector3d(0.0, 1.0, 2.0));
+  mesh.createVertex(Eigen::Vector3d(3.0, 4.0, 5.0));
+
+  Eigen::MatrixXd expected(3, 2);
+  expected << 0.0, 3.0,
+      1.0, 4.0,
+      2.0, 5.0;
+  BOOST_TEST(testing::equals(mesh.vertexCoordinates(), expected));
+
+  // Column-major storage places the coordinates of each vertex next to each other
+  BOOST_TEST(mesh.vertexCoordinates().data()[3] == 3.0);
+
+  // Repeated accesses return the cached result
+  BOOST_TEST(&mesh.vertexCoordinates() == &mesh.vertexCoordinates());
+
+  // Moving a vertex invalidates the cache
+  v0.setCoords(Eigen::Vector3d(-1.0, 1.0, 2.0));
+  BOOST_TEST(mesh.vertexCoordinates()(0, 0) == -1.0);
+
+  // New vertices invalidate the cache
+  mesh.createVertex(Eigen::Vector3d(6.0, 7.0, 8.0));
+  BOOST_TEST(mesh.vertexCoordinates().cols() == 3);
+  BOOST_TEST(mesh.vertexCoordinates()(2, 2) == 8.0);
+}
+
 BOOST_AUTO_TEST_CASE(AddMesh)
 {
   PRECICE_TEST(1_rank);
@@ -1,4 +1,5 @@
 #include <Eigen/Core>
+#include <cmath>
 #include <iterator>
 #include <sstream>
 #include <string>
@@ -179,6 +180,26 @@ BOOST_AUTO_TEST_CASE(ReversedLastFlipped)
   BOOST_TEST(triangle.getArea() == expectedArea);
 }
 
+BOOST_AUTO_TEST_CASE(ComputeNormal)
+{
+  PRECICE_TEST(1_rank);
+  using Eigen::Vector3d;
+  Vertex v1(Vector3d(1.0, 0.0, 0.0), 0);
+  Vertex v2(Vector3d(0.0, 1.0, 0.0), 1);
+  Vertex v3(Vector3d(0.0, 0.0, 1.0), 2);
+
+  Edge e1(v1, v2);
+  Edge e2(v2, v3);
+  Edge e3(v3, v1);
+
+  Triangle triangle(e1, e2, e3);
+
+  // The normal follows the right-hand rule of the vertices ordered by their IDs
+  Vector3d normal = triangle.computeNormal();
+  BOOST_TEST(normal.norm() == 1.0, boost::test_tools::tolerance(1e-14));
+  BOOST_TEST(testing::equals(normal, Vector3d::Constant(1.0 / std::sqrt(3.0))));
+}
+
 BOOST_AUTO_TEST_CASE(RangeAccess)
 {
   PRECICE_TEST(1_rank);
@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <numeric>
@@ -95,7 +96,7 @@ void ProvidedPartition::communicate()
           }
         }
         if (utils::IntraComm::isSecondary()) {
-          com::sendMesh(*utils::IntraComm::getCommunication(), 0, *_mesh);
+          com::sendMesh(*utils::IntraComm::getCommunication(), 0, *_mesh, m2n->usesMeshCompression());
         }
         hasMeshBeenGathered = true;
       }
@@ -108,7 +109,7 @@ void ProvidedPartition::communicate()
         PRECICE_CHECK(globalMesh.nVertices() > 0,
                       "The provided mesh \"{}\" is empty. Please set the mesh using setMeshVertex()/setMeshVertices() prior to calling initialize().",
                       globalMesh.getName());
-        com::sendMesh(*m2n->getPrimaryRankCommunication(), 0, globalMesh);
+        com::sendMesh(*m2n->getPrimaryRankCommunication(), 0, globalMesh, m2n->usesMeshCompression());
       }
     }
   }
@@ -130,30 +131,18 @@ void ProvidedPartition::prepare()
       _mesh->vertex(i).setGlobalIndex(i);
     }
 
-    mesh::Mesh::VertexOffsets vertexOffsets(utils::IntraComm::getSize());
-    vertexOffsets[0]           = numberOfVertices;
-    int globalNumberOfVertices = numberOfVertices;
-
-    // receive number of secondary vertices and fill vertex offsets
-    for (Rank secondaryRank : utils::IntraComm::allSecondaryRanks()) {
-      int numberOfSecondaryRankVertices = -1;
-      utils::IntraComm::getCommunication()->receive(numberOfSecondaryRankVertices, secondaryRank);
-      vertexOffsets[secondaryRank] = numberOfSecondaryRankVertices + vertexOffsets[secondaryRank - 1];
-      utils::IntraComm::getCommunication()->send(globalNumberOfVertices, secondaryRank);
-      globalNumberOfVertices += numberOfSecondaryRankVertices;
-    }
+    // gather the number of vertices of all ranks and accumulate them to vertex offsets
+    mesh::Mesh::VertexOffsets vertexOffsets;
+    utils::IntraComm::getCommunication()->allgather(numberOfVertices, vertexOffsets);
+    std::partial_sum(vertexOffsets.begin(), vertexOffsets.end(), vertexOffsets.begin());
+    PRECICE_ASSERT(vertexOffsets.size() == static_cast<std::size_t>(utils::IntraComm::getSize()));
     PRECICE_ASSERT(std::all_of(vertexOffsets.begin(), vertexOffsets.end(), [](auto i) { return i >= 0; }));
+    PRECICE_DEBUG("My vertex offsets: {}", vertexOffsets);
     PRECICE_ASSERT(_mesh->getVertexOffsets().empty());
     _mesh->setVertexOffsets(vertexOffsets);
 
-    // set and broadcast global number of vertices
-    _mesh->setGlobalNumberOfVertices(globalNumberOfVertices);
-    PRECICE_DEBUG("Broadcast global number of vertices: {}", globalNumberOfVertices);
-    utils::IntraComm::getCommunication()->broadcast(globalNumberOfVertices);
-
-    // broadcast vertex offsets to secondary ranks
-    PRECICE_DEBUG("My vertex offsets: {}", vertexOffsets);
-    utils::IntraComm::getCommunication()->broadcast(vertexOffsets);
+    // set global number of vertices
+    _mesh->setGlobalNumberOfVertices(vertexOffsets.back());
 
     // fill vertex distribution
     if (std::any_of(_m2ns.begin(), _m2ns.end(), [](const m2n::PtrM2N &m2n) { return not m2n->usesTwoLevelInitialization(); }) && utils::IntraComm::isPrimary()) {
@@ -177,27 +166,23 @@ void ProvidedPartition::prepare()
     }
   } else if (utils::IntraComm::isSecondary()) {
 
-    // send number of own vertices
-    PRECICE_DEBUG("Send number of vertices: {}", numberOfVertices);
-    utils::IntraComm::getCommunication()->send(numberOfVertices, 0);
+    // gather the number of vertices of all ranks and accumulate them to vertex offsets
+    PRECICE_DEBUG("Gather number of vertices: {}", numberOfVertices);
+    mesh::Mesh::VertexOffsets vertexOffsets;
+    utils::IntraComm::getCommunication()->allgather(numberOfVertices, vertexOffsets, 0);
+    std::partial_sum(vertexOffsets.begin(), vertexOffsets.end(), vertexOffsets.begin());
+    PRECICE_ASSERT(vertexOffsets.size() == static_cast<std::size_t>(utils::IntraComm::getSize()));
 
     // set global IDs
-    int globalVertexCounter = -1;
-    utils::IntraComm::getCommunication()->receive(globalVertexCounter, 0);
+    const int globalVertexCounter = vertexOffsets[utils::IntraComm::getRank() - 1];
     PRECICE_DEBUG("Set global vertex indices");
     for (int i = 0; i < numberOfVertices; i++) {
       _mesh->vertex(i).setGlobalIndex(globalVertexCounter + i);
     }
 
     // set global number of vertices
-    int globalNumberOfVertices = -1;
-    utils::IntraComm::getCommunication()->broadcast(globalNumberOfVertices, 0);
-    PRECICE_ASSERT(globalNumberOfVertices != -1);
-    _mesh->setGlobalNumberOfVertices(globalNumberOfVertices);
+    _mesh->setGlobalNumberOfVertices(vertexOffsets.back());
 
-    // receive set vertex offsets
-    mesh::Mesh::VertexOffsets vertexOffsets;
-    utils::IntraComm::getCommunication()->broadcast(vertexOffsets, 0);
     PRECICE_DEBUG("My vertex offsets: {}", vertexOffsets);
     PRECICE_ASSERT(_mesh->getVertexOffsets().empty());
     _mesh->setVertexOffsets(std::move(vertexOffsets));
@@ -1,7 +1,9 @@
 #include "partition/ReceivedPartition.hpp"
 #include <algorithm>
+#include <cstddef>
 #include <map>
 #include <memory>
+#include <numeric>
 #include <ostream>
 #include <utility>
 #include <vector>
@@ -29,15 +31,34 @@ using precice::profiling::Event;
 
 namespace precice::partition {
 
+namespace {
+
+/// Returns the remote ranks whose bounding boxes overlap the given bounding box, in ascending order
+std::vector<Rank> overlappingRanks(const mesh::BoundingBox &bb, const mesh::Mesh::BoundingBoxMap &remoteBBMap)
+{
+  // Every rank compares its bounding box only once, hence building a spatial index would not pay off
+  std::vector<Rank> ranks;
+  for (const auto &[rank, remoteBB] : remoteBBMap) {
+    if (bb.overlapping(remoteBB)) {
+      ranks.push_back(rank);
+    }
+  }
+  return ranks;
+}
+
+} // namespace
+
 ReceivedPartition::ReceivedPartition(
-    const mesh::PtrMesh &mesh, GeometricFilter geometricFilter, double safetyFactor, bool allowDirectAccess)
+    const mesh::PtrMesh &mesh, GeometricFilter geometricFilter, double safetyFactor, bool allowDirectAccess, int rankTreeArity)
     : Partition(mesh),
       _geometricFilter(geometricFilter),
       _bb(mesh->getDimensions()),
       _dimensions(mesh->getDimensions()),
       _safetyFactor(safetyFactor),
-      _allowDirectAccess(allowDirectAccess)
+      _allowDirectAccess(allowDirectAccess),
+      _rankTreeArity(rankTreeArity)
 {
+  PRECICE_ASSERT(_rankTreeArity > 0);
 }
 
 void ReceivedPartition::communicate()
@@ -229,36 +250,19 @@ void ReceivedPartition::compute()
 
   // (7) Compute vertex offsets
   PRECICE_DEBUG("Compute vertex offsets");
-  if (utils::IntraComm::isSecondary()) {
-
-    // send number of vertices
-    PRECICE_DEBUG("Send number of vertices: {}", _mesh->nVertices());
-    int numberOfVertices = _mesh->nVertices();
-    utils::IntraComm::getCommunication()->send(numberOfVertices, 0);
-
-    // receive vertex offsets
+  if (utils::IntraComm::isParallel()) {
+    // gather the number of vertices of all ranks and accumulate them to vertex offsets
+    const int numberOfVertices = _mesh->nVertices();
+    PRECICE_DEBUG("Gather number of vertices: {}", numberOfVertices);
     mesh::Mesh::VertexOffsets vertexOffsets;
-    utils::IntraComm::getCommunication()->broadcast(vertexOffsets, 0);
-    PRECICE_DEBUG("My vertex offsets: {}", vertexOffsets);
-    PRECICE_ASSERT(_mesh->getVertexOffsets().empty());
-    _mesh->setVertexOffsets(std::move(vertexOffsets));
-
-  } else if (utils::IntraComm::isPrimary()) {
-
-    mesh::Mesh::VertexOffsets vertexOffsets(utils::IntraComm::getSize());
-    vertexOffsets[0] = _mesh->nVertices();
-
-    // receive number of secondary vertices and fill vertex offsets
-    for (int secondaryRank : utils::IntraComm::allSecondaryRanks()) {
-      int numberOfSecondaryRankVertices = -1;
-      utils::IntraComm::getCommunication()->receive(numberOfSecondaryRankVertices, secondaryRank);
-      PRECICE_ASSERT(numberOfSecondaryRankVertices >= 0);
-      vertexOffsets[secondaryRank] = numberOfSecondaryRankVertices + vertexOffsets[secondaryRank - 1];
+    if (utils::IntraComm::isPrimary()) {
+      utils::IntraComm::getCommunication()->allgather(numberOfVertices, vertexOffsets);
+    } else {
+      utils::IntraComm::getCommunication()->allgather(numberOfVertices, vertexOffsets, 0);
     }
-
-    // broadcast vertex offsets
+    std::partial_sum(vertexOffsets.begin(), vertexOffsets.end(), vertexOffsets.begin());
+    PRECICE_ASSERT(vertexOffsets.size() == static_cast<std::size_t>(utils::IntraComm::getSize()));
     PRECICE_DEBUG("My vertex offsets: {}", vertexOffsets);
-    utils::IntraComm::getCommunication()->broadcast(vertexOffsets);
     PRECICE_ASSERT(_mesh->getVertexOffsets().empty());
     _mesh->setVertexOffsets(std::move(vertexOffsets));
   }
@@ -290,6 +294,11 @@ void ReceivedPartition::filterByBoundingBox()
                       "(option \"filter-on-primary-rank\") if it is communicated by an m2n communication that uses "
                       "two-level initialization. Use \"filter-on-secondary-rank\" or \"no-filter\" instead.";
     PRECICE_CHECK(_geometricFilter != ON_PRIMARY_RANK, msg);
+    PRECICE_CHECK(_geometricFilter != ON_RANK_TREE,
+                  "The received mesh {} cannot be filtered along a tree of ranks (option \"on-rank-tree\") "
+                  "if it is communicated by an m2n communication that uses two-level initialization. "
+                  "Use \"on-secondary-ranks\" or \"no-filter\" instead.",
+                  _mesh->getName());
   }
 
   prepareBoundingBox();
@@ -322,7 +331,7 @@ void ReceivedPartition::filterByBoundingBox()
         mesh::Mesh secondaryMesh("SecondaryMesh", _dimensions, mesh::Mesh::MESH_ID_UNDEFINED);
         mesh::filterMesh(secondaryMesh, *_mesh, [&secondaryBB](const mesh::Vertex &v) { return secondaryBB.contains(v); });
         PRECICE_DEBUG("Send filtered mesh to secondary rank: {}", secondaryRank);
-        com::sendMesh(*utils::IntraComm::getCommunication(), secondaryRank, secondaryMesh);
+        com::sendMesh(*utils::IntraComm::getCommunication(), secondaryRank, secondaryMesh, m2n().usesMeshCompression());
       }
 
       // Now also filter the remaining primary mesh
@@ -339,6 +348,17 @@ void ReceivedPartition::filterByBoundingBox()
         PRECICE_CHECK(not _mesh->empty(), errorMeshFilteredOut(_mesh->getName(), utils::IntraComm::getRank()));
       }
     }
+  } else if (_geometricFilter == ON_RANK_TREE) {
+
+    PRECICE_ASSERT(not m2n().usesTwoLevelInitialization());
+    PRECICE_INFO("Pre-filter mesh {} by bounding box along a tree of ranks", _mesh->getName());
+    Event e("partition.treeFilterMesh." + _mesh->getName(), profiling::Synchronize);
+
+    filterByRankTree();
+
+    if (isAnyProvidedMeshNonEmpty()) {
+      PRECICE_CHECK(not _mesh->empty(), errorMeshFilteredOut(_mesh->getName(), utils::IntraComm::getRank()));
+    }
   } else {
     if (not m2n().usesTwoLevelInitialization()) {
       PRECICE_INFO("Broadcast mesh {}", _mesh->getName());
@@ -348,7 +368,7 @@ void ReceivedPartition::filterByBoundingBox()
         com::broadcastReceiveMesh(*utils::IntraComm::getCommunication(), *_mesh);
       } else { // Primary
         PRECICE_ASSERT(utils::IntraComm::isPrimary());
-        com::broadcastSendMesh(*utils::IntraComm::getCommunication(), *_mesh);
+        com::broadcastSendMesh(*utils::IntraComm::getCommunication(), *_mesh, m2n().usesMeshCompression());
       }
     }
     if (_geometricFilter == ON_SECONDARY_RANKS) {
@@ -375,6 +395,60 @@ void ReceivedPartition::filterByBoundingBox()
   }
 }
 
+void ReceivedPartition::filterByRankTree()
+{
+  PRECICE_TRACE();
+  PRECICE_ASSERT(utils::IntraComm::isParallel());
+  auto &intraComm = *utils::IntraComm::getCommunication();
+
+  const Rank rank = utils::IntraComm::getRank();
+  const int  size = utils::IntraComm::getSize();
+  // Without connections between secondary ranks, the tree degenerates to the primary rank and all secondary ranks as its children
+  const int arity = intraComm.connectsAllRanks() ? _rankTreeArity : std::max(size - 1, 1);
+  PRECICE_ASSERT(arity > 0);
+
+  std::vector<Rank> children;
+  for (Rank child = arity * rank + 1; child <= arity * rank + arity && child < size; ++child) {
+    children.push_back(child);
+  }
+
+  // (1) Accumulate the bounding boxes of all subtrees from the leaves to the primary rank
+  std::vector<mesh::BoundingBox> childBBs(children.size(), mesh::BoundingBox(_dimensions));
+  mesh::BoundingBox              subtreeBB = _bb;
+  for (std::size_t i = 0; i < children.size(); ++i) {
+    com::receiveBoundingBox(intraComm, children[i], childBBs[i]);
+    PRECICE_DEBUG("From child rank {}, subtree bounding box: {}", children[i], childBBs[i]);
+    subtreeBB.expandBy(childBBs[i]);
+  }
+
+  // (2) Receive the mesh region of this subtree, the primary rank holds the entire mesh
+  if (utils::IntraComm::isSecondary()) {
+    const Rank parent = (rank - 1) / arity;
+    PRECICE_DEBUG("Send subtree bounding box to parent rank {}", parent);
+    com::sendBoundingBox(intraComm, parent, subtreeBB);
+    PRECICE_DEBUG("Receive filtered mesh from parent rank {}", parent);
+    com::receiveMesh(intraComm, parent, *_mesh);
+  }
+
+  // (3) Forward the mesh regions of the subtrees to the children
+  for (std::size_t i = 0; i < children.size(); ++i) {
+    mesh::Mesh childMesh("ChildMesh", _dimensions, mesh::Mesh::MESH_ID_UNDEFINED);
+    mesh::filterMesh(childMesh, *_mesh, [&childBB = childBBs[i]](const mesh::Vertex &v) { return childBB.contains(v); });
+    PRECICE_DEBUG("Send filtered mesh to child rank: {}", children[i]);
+    com::sendMesh(intraComm, children[i], childMesh, m2n().usesMeshCompression());
+  }
+
+  // (4) Filter the own mesh region
+  mesh::Mesh filteredMesh("FilteredMesh", _dimensions, mesh::Mesh::MESH_ID_UNDEFINED);
+  mesh::filterMesh(filteredMesh, *_mesh, [&](const mesh::Vertex &v) { return _bb.contains(v); });
+  PRECICE_DEBUG("Tree filter, filtered from {} to {} vertices, {} to {} edges, and {} to {} triangles.",
+                _mesh->nVertices(), filteredMesh.nVertices(),
+                _mesh->edges().size(), filteredMesh.edges().size(),
+                _mesh->triangles().size(), filteredMesh.triangles().size());
+  _mesh->clear();
+  _mesh->addMesh(filteredMesh);
+}
+
 void ReceivedPartition::compareBoundingBoxes()
 {
   PRECICE_TRACE();
@@ -426,25 +500,20 @@ void ReceivedPartition::compareBoundingBoxes()
     std::vector<Rank>            connectedRanksList; // local ranks with any connection
 
     // connected ranks for primary rank
-    std::vector<Rank> connectedRanks;
-    for (auto &remoteBB : remoteBBMap) {
-      if (_bb.overlapping(remoteBB.second)) {
-        connectedRanks.push_back(remoteBB.first); // connected remote ranks for this rank
-      }
-    }
+    std::vector<Rank> connectedRanks = overlappingRanks(_bb, remoteBBMap);
     PRECICE_ASSERT(_mesh->getConnectedRanks().empty());
     _mesh->setConnectedRanks(connectedRanks);
-    if (not connectedRanks.empty()) {
-      connectionMap.emplace(0, std::move(connectedRanks));
-      connectedRanksList.push_back(0);
-    }
 
-    // receive connected ranks from secondary ranks and add them to the connection map
-    for (int rank : utils::IntraComm::allSecondaryRanks()) {
-      std::vector<Rank> secondaryConnectedRanks = utils::IntraComm::getCommunication()->receiveRange(rank, com::asVector<Rank>);
-      if (!secondaryConnectedRanks.empty()) {
+    // gather connected ranks of all ranks and assemble the connection map
+    std::vector<Rank> allConnectedRanks;
+    std::vector<int>  counts;
+    utils::IntraComm::getCommunication()->gather(connectedRanks, allConnectedRanks, counts);
+    auto begin = allConnectedRanks.begin();
+    for (Rank rank = 0; rank < static_cast<Rank>(counts.size()); ++rank) {
+      if (counts[rank] > 0) {
         connectedRanksList.push_back(rank);
-        connectionMap.emplace(rank, std::move(secondaryConnectedRanks));
+        connectionMap.emplace(rank, std::vector<Rank>(begin, begin + counts[rank]));
+        begin += counts[rank];
       }
     }
 
@@ -459,17 +528,12 @@ void ReceivedPartition::compareBoundingBoxes()
   } else {
     PRECICE_ASSERT(utils::IntraComm::isSecondary());
 
-    std::vector<Rank> connectedRanks;
-    for (const auto &remoteBB : remoteBBMap) {
-      if (_bb.overlapping(remoteBB.second)) {
-        connectedRanks.push_back(remoteBB.first);
-      }
-    }
+    std::vector<Rank> connectedRanks = overlappingRanks(_bb, remoteBBMap);
     PRECICE_ASSERT(_mesh->getConnectedRanks().empty());
     _mesh->setConnectedRanks(connectedRanks);
 
     // send connected ranks to primary rank
-    utils::IntraComm::getCommunication()->sendRange(connectedRanks, 0);
+    utils::IntraComm::getCommunication()->gather(connectedRanks, 0);
   }
 }
 
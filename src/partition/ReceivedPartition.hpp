@@ -36,11 +36,17 @@ public:
     /// Filter at primary rank and communicate only filtered mesh.
     ON_PRIMARY_RANK,
     /// Filter after communication on all secondary ranks
-    ON_SECONDARY_RANKS
+    ON_SECONDARY_RANKS,
+    /// Filter along a tree of ranks, every rank forwards the filtered mesh to its subtrees
+    ON_RANK_TREE
   };
 
-  /// Constructor
-  ReceivedPartition(const mesh::PtrMesh &mesh, GeometricFilter geometricFilter, double safetyFactor, bool allowDirectAccess = false);
+  /**
+   * @brief Constructor
+   *
+   * @param[in] rankTreeArity Number of children of every rank in the tree of the ON_RANK_TREE filter
+   */
+  ReceivedPartition(const mesh::PtrMesh &mesh, GeometricFilter geometricFilter, double safetyFactor, bool allowDirectAccess = false, int rankTreeArity = 4);
 
   virtual ~ReceivedPartition() {}
 
@@ -56,6 +62,15 @@ private:
 
   void filterByBoundingBox();
 
+  /**
+   * @brief Distributes the mesh of the primary rank along a k-ary tree of ranks.
+   *
+   * The bounding boxes of all subtrees are accumulated towards the primary rank. Afterwards, every rank
+   * filters the mesh region it received from its parent by the bounding boxes of the subtrees of its
+   * children, forwards the filtered regions, and finally filters its own region by its bounding box.
+   */
+  void filterByRankTree();
+
   /// Sets _bb to the union with the mesh from fromMapping resp. toMapping, also enlage by _safetyFactor
   void prepareBoundingBox();
 
@@ -93,6 +108,9 @@ private:
 
   bool _allowDirectAccess;
 
+  /// Number of children of every rank in the tree used by filterByRankTree()
+  int _rankTreeArity;
+
   logging::Logger _log{"partition::ReceivedPartition"};
 
   /// Max global vertex IDs of remote connected ranks
@@ -387,6 +387,60 @@ BOOST_AUTO_TEST_CASE(RePartitionNPPreFilterPostFilter2D)
   }
 }
 
+BOOST_AUTO_TEST_CASE(RePartitionNPRankTreeFilter2D)
+{
+  PRECICE_TEST("Solid"_on(1_rank), "Fluid"_on(3_ranks).setupIntraComm(), Require::Events);
+  auto m2n = context.connectPrimaryRanks("Solid", "Fluid");
+
+  int dimensions = 2;
+
+  if (context.isNamed("Solid")) { //SOLIDZ
+    mesh::PtrMesh pSolidzMesh(new mesh::Mesh("SolidzMesh", dimensions, testing::nextMeshID()));
+    createSolidzMesh2D(pSolidzMesh);
+    ProvidedPartition part(pSolidzMesh);
+    part.addM2N(m2n);
+    part.communicate();
+  } else {
+    BOOST_TEST(context.isNamed("Fluid"));
+    mesh::PtrMesh pNastinMesh(new mesh::Mesh("NastinMesh", dimensions, testing::nextMeshID()));
+    mesh::PtrMesh pSolidzMesh(new mesh::Mesh("SolidzMesh", dimensions, testing::nextMeshID()));
+
+    mapping::PtrMapping boundingFromMapping = mapping::PtrMapping(
+        new mapping::NearestProjectionMapping(mapping::Mapping::CONSISTENT, dimensions));
+    mapping::PtrMapping boundingToMapping = mapping::PtrMapping(
+        new mapping::NearestNeighborMapping(mapping::Mapping::CONSERVATIVE, dimensions));
+    boundingFromMapping->setMeshes(pSolidzMesh, pNastinMesh);
+    boundingToMapping->setMeshes(pNastinMesh, pSolidzMesh);
+
+    createNastinMesh2D(pNastinMesh, context.rank);
+
+    double            safetyFactor = 0.1;
+    // A chain of ranks, such that rank 1 forwards the mesh region of rank 2
+    const int         rankTreeArity = 1;
+    ReceivedPartition part(pSolidzMesh, ReceivedPartition::ON_RANK_TREE, safetyFactor, false, rankTreeArity);
+    part.addM2N(m2n);
+    part.addFromMapping(boundingFromMapping);
+    part.addToMapping(boundingToMapping);
+    part.communicate();
+    part.compute();
+
+    BOOST_TEST_CONTEXT(*pSolidzMesh)
+    {
+      // check if the sending and filtering worked right
+      if (context.isPrimary()) { //Primary
+        BOOST_TEST(pSolidzMesh->nVertices() == 3);
+        BOOST_TEST(pSolidzMesh->edges().size() == 2);
+      } else if (context.isRank(1)) { //SecondaryRank1
+        BOOST_TEST(pSolidzMesh->nVertices() == 0);
+        BOOST_TEST(pSolidzMesh->edges().size() == 0);
+      } else if (context.isRank(2)) { //Secondary rank 2
+        BOOST_TEST(pSolidzMesh->nVertices() == 3);
+        BOOST_TEST(pSolidzMesh->edges().size() == 2);
+      }
+    }
+  }
+}
+
 #ifndef PRECICE_NO_PETSC
 BOOST_AUTO_TEST_CASE(RePartitionRBFGlobal2D)
 {
@@ -54,6 +54,17 @@ void Participant::advance(
   _impl->advance(computedTimeStepSize);
 }
 
+void Participant::startAdvance(
+    double computedTimeStepSize)
+{
+  _impl->startAdvance(computedTimeStepSize);
+}
+
+void Participant::finishAdvance()
+{
+  _impl->finishAdvance();
+}
+
 void Participant::finalize()
 {
   return _impl->finalize();
@@ -298,6 +298,51 @@ public:
    */
   void advance(double computedTimeStepSize);
 
+  /**
+   * @brief Starts advancing the coupled participant in a background thread.
+   *
+   * This is the first half of a split-phase alternative to \ref advance().
+   * The call returns as soon as the time step size is validated and the coupling scheme time is updated.
+   * Mapping written data, exchanging data with other participants, computing convergence measures,
+   * and applying acceleration then continue in a background thread.
+   * Meanwhile, the solver can perform work that does not depend on the coupling data, such as assembling the next time step.
+   * The advance is completed by calling \ref finishAdvance().
+   *
+   * The sequence startAdvance(dt); finishAdvance(); is equivalent to advance(dt).
+   *
+   * @param[in] computedTimeStepSize Size of time step used by the solver.
+   *
+   * @attention No other function of this participant may be called before \ref finishAdvance().
+   * @attention The participant has to enable split-advance in the configuration, otherwise this function fails with an error.
+   * As the background thread calls MPI, preCICE then requests MPI_THREAD_SERIALIZED if it initializes MPI itself.
+   * If the solver initializes MPI, it has to use MPI_Init_thread() and provide at least this level.
+   *
+   * @pre The same preconditions as for \ref advance() apply.
+   * @pre The participant enables split-advance in the configuration.
+   * @pre There is no advance in progress, started by a previous call to startAdvance().
+   *
+   * @post The coupling scheme time state is updated.
+   * @post An advance is in progress and has to be completed by \ref finishAdvance().
+   *
+   * @see advance()
+   * @see finishAdvance()
+   */
+  void startAdvance(double computedTimeStepSize);
+
+  /**
+   * @brief Completes the advance started by \ref startAdvance().
+   *
+   * Waits for the data exchange and acceleration running in the background, maps read data, and exports meshes if configured.
+   * Errors raised in the background are reported by this call.
+   *
+   * @pre \ref startAdvance() has been called and was not yet completed.
+   *
+   * @post The same postconditions as for \ref advance() hold.
+   *
+   * @see startAdvance()
+   */
+  void finishAdvance();
+
   /**
    * @brief Finalizes preCICE.
    *
@@ -30,6 +30,7 @@
 #include "precice/impl/WatchIntegral.hpp"
 #include "precice/impl/WatchPoint.hpp"
 #include "utils/IntraComm.hpp"
+#include "utils/String.hpp"
 #include "utils/assertion.hpp"
 #include "utils/networking.hpp"
 #include "xml/ConfigParser.hpp"
@@ -56,6 +57,13 @@ ParticipantConfiguration::ParticipantConfiguration(
                           "of the precice::Participant object used by the participant.");
   tag.addAttribute(attrName);
 
+  auto attrSplitAdvance = makeXMLAttribute(ATTR_SPLIT_ADVANCE, false)
+                              .setDocumentation(
+                                  "Enables startAdvance() and finishAdvance(), which continue the advance in a background thread. "
+                                  "If preCICE initializes MPI, it then requests MPI_THREAD_SERIALIZED. "
+                                  "If the solver initializes MPI, it has to provide at least this level of thread support.");
+  tag.addAttribute(attrSplitAdvance);
+
   XMLTag tagWriteData(*this, TAG_WRITE, XMLTag::OCCUR_ARBITRARY);
   doc = "Sets data to be written by the participant to preCICE. ";
   doc += "Data is defined by using the <data> tag.";
@@ -74,6 +82,14 @@ ParticipantConfiguration::ParticipantConfiguration(
                           "meshes, this has to be specified separately for each mesh.");
   tagWriteData.addAttribute(attrMesh);
   tagReadData.addAttribute(attrMesh);
+  auto attrLazyMapping = makeXMLAttribute(ATTR_LAZY_MAPPING, false)
+                             .setDocumentation(
+                                 "If enabled, the read mapping of this data is executed on the first call to readData() "
+                                 "after receiving new data instead of after every data exchange. "
+                                 "Data, which is not read in a time window, is then not mapped at all. "
+                                 "Parallel participants cannot use this option with global RBF read mappings, as these communicate between all ranks. "
+                                 "Has no effect if the participant defines read-mapping-post actions.");
+  tagReadData.addAttribute(attrLazyMapping);
 
   tag.addSubtag(tagWriteData);
   tag.addSubtag(tagReadData);
@@ -104,6 +120,13 @@ ParticipantConfiguration::ParticipantConfiguration(
                                 "mesh is considered instead, and values/coordinates are interpolated "
                                 "linearly to that point.");
   tagWatchPoint.addAttribute(attrCoordinate);
+  auto attrFormat = XMLAttribute<std::string>(ATTR_FORMAT)
+                        .setDocumentation("Format of the output file. \"text\" writes a human-readable table to a \".log\" file. "
+                                          "\"binary\" writes the table column-wise in native byte order to a \".bin\" file, "
+                                          "which is cheaper to write for long simulations.")
+                        .setOptions({VALUE_FORMAT_TEXT, VALUE_FORMAT_BINARY})
+                        .setDefaultValue(VALUE_FORMAT_TEXT);
+  tagWatchPoint.addAttribute(attrFormat);
   tag.addSubtag(tagWatchPoint);
 
   auto attrScaleWitConn = XMLAttribute<bool>(ATTR_SCALE_WITH_CONN)
@@ -123,6 +146,7 @@ ParticipantConfiguration::ParticipantConfiguration(
   attrMesh.setDocumentation(doc);
   tagWatchIntegral.addAttribute(attrMesh);
   tagWatchIntegral.addAttribute(attrScaleWitConn);
+  tagWatchIntegral.addAttribute(attrFormat);
   tag.addSubtag(tagWatchIntegral);
 
   XMLTag tagProvideMesh(*this, TAG_PROVIDE_MESH, XMLTag::OCCUR_ARBITRARY);
@@ -160,11 +184,22 @@ ParticipantConfiguration::ParticipantConfiguration(
                                "\"on-secondary\" strategy, which performs better for a very high number of "
                                "processors. Both result in the same distribution (if the safety factor is sufficiently large). "
                                "\"on-primary\" is not supported if you use two-level initialization. "
+                               "The \"on-rank-tree\" strategy filters like \"on-primary\", but distributes the mesh along a tree of ranks, "
+                               "which spreads the filtering and communication over all ranks for a huge mesh and a high number of processors. "
+                               "Without an MPI intra-participant communication, it falls back to the behavior of \"on-primary\". "
+                               "\"on-rank-tree\" is not supported with two-level initialization either. "
                                "For very asymmetric cases, the filter can also be switched off completely (\"no-filter\").")
-                           .setOptions({VALUE_NO_FILTER, VALUE_FILTER_ON_PRIMARY_RANK, VALUE_FILTER_ON_SECONDARY_RANKS})
+                           .setOptions({VALUE_NO_FILTER, VALUE_FILTER_ON_PRIMARY_RANK, VALUE_FILTER_ON_SECONDARY_RANKS, VALUE_FILTER_ON_RANK_TREE})
                            .setDefaultValue(VALUE_FILTER_ON_SECONDARY_RANKS);
   tagReceiveMesh.addAttribute(attrGeoFilter);
 
+  auto attrRankTreeArity = makeXMLAttribute(ATTR_RANK_TREE_ARITY, 4)
+                               .setDocumentation(
+                                   "Number of children of every rank in the tree of ranks used by the \"on-rank-tree\" geometric filter. "
+                                   "Smaller values spread the filtering and communication over more levels of the tree. "
+                                   "Has no effect for other geometric filters.");
+  tagReceiveMesh.addAttribute(attrRankTreeArity);
+
   auto attrDirectAccess = makeXMLAttribute(ATTR_DIRECT_ACCESS, false)
                               .setDocumentation(
                                   "If a mesh is received from another partipant (see tag <from>), it needs to be"
@@ -249,6 +284,7 @@ void ParticipantConfiguration::xmlTagCallback(
   if (tag.getName() == TAG) {
     const std::string &  name = tag.getStringAttributeValue(ATTR_NAME);
     impl::PtrParticipant p(new impl::ParticipantState(name, _meshConfig));
+    p->setSplitAdvance(tag.getBooleanAttributeValue(ATTR_SPLIT_ADVANCE));
     _participants.push_back(p);
   } else if (tag.getName() == TAG_PROVIDE_MESH) {
     std::string name = tag.getStringAttributeValue(ATTR_NAME);
@@ -264,6 +300,7 @@ void ParticipantConfiguration::xmlTagCallback(
     double                                        safetyFactor      = tag.getDoubleAttributeValue(ATTR_SAFETY_FACTOR);
     partition::ReceivedPartition::GeometricFilter geoFilter         = getGeoFilter(tag.getStringAttributeValue(ATTR_GEOMETRIC_FILTER));
     const bool                                    allowDirectAccess = tag.getBooleanAttributeValue(ATTR_DIRECT_ACCESS);
+    const int                                     rankTreeArity     = tag.getIntAttributeValue(ATTR_RANK_TREE_ARITY);
 
     // Start with defining the mesh
     mesh::PtrMesh mesh = _meshConfig->getMesh(name);
@@ -287,7 +324,12 @@ void ParticipantConfiguration::xmlTagCallback(
                   "Please use a positive or zero safety-factor instead.",
                   context.name, name, safetyFactor);
 
-    _participants.back()->receiveMesh(mesh, from, safetyFactor, geoFilter, allowDirectAccess);
+    PRECICE_CHECK(rankTreeArity > 0,
+                  "Participant \"{}\" receives mesh \"{}\" with rank-tree-arity=\"{}\". "
+                  "Please use a positive rank-tree-arity instead.",
+                  context.name, name, rankTreeArity);
+
+    _participants.back()->receiveMesh(mesh, from, safetyFactor, geoFilter, allowDirectAccess, rankTreeArity);
   } else if (tag.getName() == TAG_WRITE) {
     const std::string &dataName = tag.getStringAttributeValue(ATTR_NAME);
     std::string        meshName = tag.getStringAttributeValue(ATTR_MESH);
@@ -304,19 +346,22 @@ void ParticipantConfiguration::xmlTagCallback(
     PRECICE_CHECK(mesh,
                   R"(Participant "{}" attempts to read data "{}" to an unknown mesh "{}". <mesh name="{}"> needs to be defined first.)",
                   _participants.back()->getName(), dataName, meshName, meshName);
-    mesh::PtrData data = getData(mesh, dataName);
-    _participants.back()->addReadData(data, mesh);
+    mesh::PtrData data        = getData(mesh, dataName);
+    const bool    lazyMapping = tag.getBooleanAttributeValue(ATTR_LAZY_MAPPING);
+    _participants.back()->addReadData(data, mesh, lazyMapping);
   } else if (tag.getName() == TAG_WATCH_POINT) {
     WatchPointConfig config;
     config.name        = tag.getStringAttributeValue(ATTR_NAME);
     config.nameMesh    = tag.getStringAttributeValue(ATTR_MESH);
     config.coordinates = tag.getEigenVectorXdAttributeValue(ATTR_COORDINATE, _meshConfig->getMesh(config.nameMesh)->getDimensions());
+    config.format      = getFormat(tag.getStringAttributeValue(ATTR_FORMAT));
     _watchPointConfigs.push_back(config);
   } else if (tag.getName() == TAG_WATCH_INTEGRAL) {
     WatchIntegralConfig config;
     config.name        = tag.getStringAttributeValue(ATTR_NAME);
     config.nameMesh    = tag.getStringAttributeValue(ATTR_MESH);
     config.isScalingOn = tag.getBooleanAttributeValue(ATTR_SCALE_WITH_CONN);
+    config.format      = getFormat(tag.getStringAttributeValue(ATTR_FORMAT));
     _watchIntegralConfigs.push_back(config);
   } else if (tag.getNamespace() == TAG_INTRA_COMM) {
     com::CommunicationConfiguration comConfig;
@@ -341,6 +386,23 @@ ParticipantConfiguration::getParticipants() const
   return _participants;
 }
 
+bool ParticipantConfiguration::readSplitAdvance(std::string_view configurationFileName, std::string_view participantName)
+{
+  // The names of the tag and the attribute match TAG and ATTR_SPLIT_ADVANCE, which are not static
+  xml::ConfigParser parser(configurationFileName);
+  for (const auto &tag : parser.getAllTags()) {
+    if (tag->m_Prefix.empty() && tag->m_Name == "participant") {
+      const auto &attributes = tag->m_aAttributes;
+      const auto  name       = attributes.find("name");
+      const auto  split      = attributes.find("split-advance");
+      if (name != attributes.end() && name->second == participantName && split != attributes.end()) {
+        return utils::convertStringToBool(split->second);
+      }
+    }
+  }
+  return false;
+}
+
 const impl::PtrParticipant ParticipantConfiguration::getParticipant(const std::string &participantName) const
 {
   auto participant = std::find_if(_participants.begin(), _participants.end(), [&participantName](const auto &p) { return p->getName() == participantName; });
@@ -381,12 +443,29 @@ partition::ReceivedPartition::GeometricFilter ParticipantConfiguration::getGeoFi
     return partition::ReceivedPartition::GeometricFilter::ON_PRIMARY_RANK;
   } else if (geoFilter == VALUE_FILTER_ON_SECONDARY_RANKS) {
     return partition::ReceivedPartition::GeometricFilter::ON_SECONDARY_RANKS;
+  } else if (geoFilter == VALUE_FILTER_ON_RANK_TREE) {
+    return partition::ReceivedPartition::GeometricFilter::ON_RANK_TREE;
   } else {
     PRECICE_ASSERT(geoFilter == VALUE_NO_FILTER);
     return partition::ReceivedPartition::GeometricFilter::NO_FILTER;
   }
 }
 
+io::TXTTableWriter::Format ParticipantConfiguration::getFormat(const std::string &format) const
+{
+  if (format == VALUE_FORMAT_BINARY) {
+    return io::TXTTableWriter::Format::Binary;
+  } else {
+    PRECICE_ASSERT(format == VALUE_FORMAT_TEXT);
+    return io::TXTTableWriter::Format::Text;
+  }
+}
+
+std::string ParticipantConfiguration::getFileExtension(io::TXTTableWriter::Format format) const
+{
+  return format == io::TXTTableWriter::Format::Binary ? ".bin" : ".log";
+}
+
 const mesh::PtrData &ParticipantConfiguration::getData(
     const mesh::PtrMesh &mesh,
     const std::string &  nameData) const
@@ -445,6 +524,16 @@ void ParticipantConfiguration::finishParticipantConfiguration(
         PRECICE_ERROR("Scaled consistent mapping is not yet supported for a parallel participant. "
                       "You could run in serial or use a plain (read-)consistent mapping instead.");
       }
+      if (confMapping.direction == mapping::MappingConfiguration::READ && confMapping.isCollective) {
+        for (const auto &context : participant->readDataContexts()) {
+          PRECICE_CHECK(!(context.isMappedLazily() && context.getMeshName() == toMesh),
+                        "Participant \"{}\" reads data \"{}\" from mesh \"{}\" with lazy-mapping=\"true\", but the read mapping "
+                        "from mesh \"{}\" communicates between all ranks of the parallel participant. "
+                        "Executing this mapping on the first read would deadlock, if the ranks don't read the data at the same time. "
+                        "Please remove the lazy-mapping attribute or use a mapping that doesn't communicate, such as a partition of unity RBF mapping.",
+                        participant->getName(), context.getDataName(), toMesh, fromMesh);
+        }
+      }
     }
 
     const auto &       fromMeshID      = confMapping.fromMesh->getID();
@@ -672,8 +761,8 @@ void ParticipantConfiguration::finishParticipantConfiguration(
                   "Please move the watchpoint definition to the participant providing mesh \"{}\".",
                   participant->getName(), config.name, config.nameMesh, config.nameMesh);
 
-    std::string filename = "precice-" + participant->getName() + "-watchpoint-" + config.name + ".log";
-    participant->addWatchPoint(std::make_shared<impl::WatchPoint>(config.coordinates, meshContext.mesh, std::move(filename)));
+    std::string filename = "precice-" + participant->getName() + "-watchpoint-" + config.name + getFileExtension(config.format);
+    participant->addWatchPoint(std::make_shared<impl::WatchPoint>(config.coordinates, meshContext.mesh, std::move(filename), config.format));
   }
   _watchPointConfigs.clear();
 
@@ -689,8 +778,8 @@ void ParticipantConfiguration::finishParticipantConfiguration(
                   "Please move the watchpoint definition to the participant providing mesh \"{}\".",
                   participant->getName(), config.name, config.nameMesh, config.nameMesh);
 
-    std::string filename = "precice-" + participant->getName() + "-watchintegral-" + config.name + ".log";
-    participant->addWatchIntegral(std::make_shared<impl::WatchIntegral>(meshContext.mesh, std::move(filename), config.isScalingOn));
+    std::string filename = "precice-" + participant->getName() + "-watchintegral-" + config.name + getFileExtension(config.format);
+    participant->addWatchIntegral(std::make_shared<impl::WatchIntegral>(meshContext.mesh, std::move(filename), config.isScalingOn, config.format));
   }
   _watchIntegralConfigs.clear();
 
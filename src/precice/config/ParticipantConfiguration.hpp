@@ -5,6 +5,7 @@
 #include <vector>
 #include "action/SharedPointer.hpp"
 #include "io/SharedPointer.hpp"
+#include "io/TXTTableWriter.hpp"
 #include "logging/Logger.hpp"
 #include "mapping/SharedPointer.hpp"
 #include "mapping/config/MappingConfigurationTypes.hpp"
@@ -58,19 +59,28 @@ public:
 
   bool hasParticipant(std::string_view name) const;
 
+  /**
+   * @brief Reads whether a participant enables split-advance from a configuration file, without processing it.
+   *
+   * The thread support of MPI depends on this option, but MPI needs to be initialized before the configuration is processed.
+   */
+  static bool readSplitAdvance(std::string_view configurationFileName, std::string_view participantName);
+
   std::string hintFor(std::string_view wrongName) const;
 
 private:
   struct WatchPointConfig {
-    std::string     name;
-    std::string     nameMesh;
-    Eigen::VectorXd coordinates;
+    std::string                name;
+    std::string                nameMesh;
+    Eigen::VectorXd            coordinates;
+    io::TXTTableWriter::Format format;
   };
 
   struct WatchIntegralConfig {
-    std::string name;
-    std::string nameMesh;
-    bool        isScalingOn;
+    std::string                name;
+    std::string                nameMesh;
+    bool                       isScalingOn;
+    io::TXTTableWriter::Format format;
   };
 
   mutable logging::Logger _log{"config::ParticipantConfiguration"};
@@ -95,6 +105,7 @@ private:
   const std::string ATTR_SAFETY_FACTOR      = "safety-factor";
   const std::string ATTR_GEOMETRIC_FILTER   = "geometric-filter";
   const std::string ATTR_DIRECT_ACCESS      = "direct-access";
+  const std::string ATTR_RANK_TREE_ARITY    = "rank-tree-arity";
   const std::string ATTR_PROVIDE            = "provide";
   const std::string ATTR_MESH               = "mesh";
   const std::string ATTR_COORDINATE         = "coordinate";
@@ -103,10 +114,17 @@ private:
   const std::string ATTR_NETWORK            = "network";
   const std::string ATTR_EXCHANGE_DIRECTORY = "exchange-directory";
   const std::string ATTR_SCALE_WITH_CONN    = "scale-with-connectivity";
+  const std::string ATTR_LAZY_MAPPING       = "lazy-mapping";
+  const std::string ATTR_FORMAT             = "format";
+  const std::string ATTR_SPLIT_ADVANCE      = "split-advance";
 
   const std::string VALUE_FILTER_ON_SECONDARY_RANKS = "on-secondary-ranks";
   const std::string VALUE_FILTER_ON_PRIMARY_RANK    = "on-primary-rank";
   const std::string VALUE_NO_FILTER                 = "no-filter";
+  const std::string VALUE_FILTER_ON_RANK_TREE       = "on-rank-tree";
+
+  const std::string VALUE_FORMAT_TEXT   = "text";
+  const std::string VALUE_FORMAT_BINARY = "binary";
 
   const std::string VALUE_VTK = "vtk";
   const std::string VALUE_VTU = "vtu";
@@ -131,6 +149,11 @@ private:
 
   partition::ReceivedPartition::GeometricFilter getGeoFilter(const std::string &geoFilter) const;
 
+  io::TXTTableWriter::Format getFormat(const std::string &format) const;
+
+  /// Returns the extension of watch point and watch integral files written in the given format
+  std::string getFileExtension(io::TXTTableWriter::Format format) const;
+
   mesh::PtrMesh copy(const mesh::PtrMesh &mesh) const;
 
   const mesh::PtrData &getData(
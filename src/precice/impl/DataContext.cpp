@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <iterator>
 #include <memory>
 #include <utility>
@@ -87,6 +88,11 @@ bool DataContext::hasMapping() const
   return hasReadMapping() || hasWriteMapping();
 }
 
+bool DataContext::mapsInto(DataID dataID) const
+{
+  return std::any_of(_mappingContexts.begin(), _mappingContexts.end(), [dataID](auto &context) { return context.toData->getID() == dataID; });
+}
+
 int DataContext::mapData(std::optional<double> after, bool skipZero)
 {
   PRECICE_TRACE(getMeshName(), getDataName());
@@ -104,6 +104,15 @@ public:
    */
   bool hasMapping() const;
 
+  /**
+   * @brief Checks whether any mapping of this DataContext writes into the given data.
+   *
+   * @param[in] dataID ID of the data to check
+   *
+   * @return True, if the given data is the target of a mapping of this DataContext.
+   */
+  bool mapsInto(DataID dataID) const;
+
   template <typename Container>
   std::optional<std::size_t> locateInvalidVertexID(const Container &c)
   {
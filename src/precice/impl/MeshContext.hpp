@@ -44,6 +44,9 @@ struct MeshContext {
   /// type of geometric filter
   partition::ReceivedPartition::GeometricFilter geoFilter = partition::ReceivedPartition::GeometricFilter::UNDEFINED;
 
+  /// Number of children of every rank in the tree of the on-rank-tree geometric filter
+  int rankTreeArity = 4;
+
   /// Partition creating the parallel decomposition of the mesh
   partition::PtrPartition partition;
 
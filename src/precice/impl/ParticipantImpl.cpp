@@ -58,6 +58,7 @@
 #include "precice/impl/ValidationMacros.hpp"
 #include "precice/impl/WatchIntegral.hpp"
 #include "precice/impl/WatchPoint.hpp"
+#include "precice/impl/WatchPointGroup.hpp"
 #include "precice/impl/WriteDataContext.hpp"
 #include "precice/impl/versions.hpp"
 #include "profiling/Event.hpp"
@@ -116,8 +117,12 @@ ParticipantImpl::ParticipantImpl(
   if (communicator.has_value()) {
     auto commptr = static_cast<utils::Parallel::Communicator *>(communicator.value());
     utils::Parallel::initializeOrDetectMPI(*commptr);
-  } else {
+  } else if (utils::Parallel::isMPIInitialized()) {
     utils::Parallel::initializeOrDetectMPI();
+  } else {
+    // The thread support can only be requested on initialization, which precedes the configuration
+    const bool splitAdvance = config::ParticipantConfiguration::readSplitAdvance(configurationFileName, _accessorName);
+    utils::Parallel::initializeOrDetectMPI(std::nullopt, splitAdvance);
   }
 
   {
@@ -158,6 +163,12 @@ ParticipantImpl::ParticipantImpl(
 
 ParticipantImpl::~ParticipantImpl()
 {
+  if (_asyncAdvance.valid()) {
+    // Wait before logging, as the background thread uses the same loggers
+    _asyncAdvance.wait();
+    _asyncAdvance = {};
+    PRECICE_INFO("Waited for the pending advance in destructor");
+  }
   if (_state != State::Finalized) {
     PRECICE_INFO("Implicitly finalizing in destructor");
     finalize();
@@ -216,6 +227,12 @@ void ParticipantImpl::configure(
                 "If you do not know exactly what an intra-participant communication is and why you want to use it "
                 "you probably just want to remove the intraComm tag from the preCICE configuration.");
 
+  PRECICE_CHECK(not _accessor->useSplitAdvance() || utils::Parallel::isMPIThreadSerialized(),
+                "The participant \"{}\" enables split-advance, which requires MPI to provide at least MPI_THREAD_SERIALIZED, "
+                "as the advance continues in a background thread which calls MPI. "
+                "Please initialize MPI using MPI_Init_thread() requesting MPI_THREAD_SERIALIZED or let preCICE initialize MPI.",
+                _accessorName);
+
   utils::IntraComm::configure(_accessorProcessRank, _accessorCommunicatorSize);
 
   _participants = config.getParticipantConfiguration()->getParticipants();
@@ -230,6 +247,7 @@ void ParticipantImpl::configure(
   cplscheme::PtrCouplingSchemeConfiguration cplSchemeConfig =
       config.getCouplingSchemeConfiguration();
   _couplingScheme = cplSchemeConfig->getCouplingScheme(_accessorName);
+  _couplingScheme->setDataPreparation([this](DataID dataID) { mapPendingWrittenData(dataID); });
 
   // Register all MeshIds to the lock, but unlock them straight away as
   // writing is allowed after configuration.
@@ -240,6 +258,7 @@ void ParticipantImpl::configure(
 
 void ParticipantImpl::initialize()
 {
+  checkNoPendingAdvance("initialize");
   PRECICE_TRACE();
   PRECICE_CHECK(_state != State::Finalized, "initialize() cannot be called after finalize().");
   PRECICE_CHECK(_state != State::Initialized, "initialize() may only be called once.");
@@ -304,8 +323,8 @@ void ParticipantImpl::initialize()
   }
 
   PRECICE_DEBUG("Initialize watchpoints");
-  for (PtrWatchPoint &watchPoint : _accessor->watchPoints()) {
-    watchPoint->initialize();
+  for (PtrWatchPointGroup &watchPointGroup : _accessor->watchPointGroups()) {
+    watchPointGroup->initialize();
   }
   for (PtrWatchIntegral &watchIntegral : _accessor->watchIntegrals()) {
     watchIntegral->initialize();
@@ -342,7 +361,7 @@ void ParticipantImpl::initialize()
 void ParticipantImpl::advance(
     double computedTimeStepSize)
 {
-
+  checkNoPendingAdvance("advance");
   PRECICE_TRACE(computedTimeStepSize);
 
   // Events for the solver time, stopped when we enter, restarted when we leave advance
@@ -352,6 +371,68 @@ void ParticipantImpl::advance(
   Event                        e("advance", profiling::Fundamental, profiling::Synchronize);
   profiling::ScopedEventPrefix sep("advance/");
 
+  const auto state = beginAdvance(computedTimeStepSize);
+  exchangeAdvance(state);
+  completeAdvance(state);
+
+  sep.pop();
+  e.stop();
+  _solverAdvanceEvent->start();
+}
+
+void ParticipantImpl::startAdvance(
+    double computedTimeStepSize)
+{
+  {
+    checkNoPendingAdvance("startAdvance");
+    PRECICE_TRACE(computedTimeStepSize);
+    PRECICE_CHECK(_accessor->useSplitAdvance(),
+                  "startAdvance() requires the participant \"{}\" to enable split-advance in the configuration. "
+                  "Please add split-advance=\"true\" to the <participant> tag or use advance() instead.",
+                  _accessorName);
+
+    // All checks are done in the calling thread, such that usage errors are reported directly
+    _pendingAdvance = beginAdvance(computedTimeStepSize);
+
+    // Events for the solver time, stopped when we enter startAdvance, restarted when we leave finishAdvance
+    PRECICE_ASSERT(_solverAdvanceEvent, "The advance event is created in initialize");
+    _solverAdvanceEvent->stop();
+  }
+
+  // The solver must not call preCICE until finishAdvance(), hence the background thread is the only one using
+  // the communication channels, the coupling scheme, the data, the loggers, and the events of this participant.
+  // This is why the tracer above has to leave its scope before the thread starts.
+  _asyncAdvance = std::async(std::launch::async, [this] {
+    Event                        e("advance", profiling::Fundamental, profiling::Synchronize);
+    profiling::ScopedEventPrefix sep("advance/");
+    exchangeAdvance(*_pendingAdvance);
+  });
+}
+
+void ParticipantImpl::finishAdvance()
+{
+  PRECICE_CHECK(_asyncAdvance.valid(), "finishAdvance() can only be called after startAdvance().");
+
+  // Rethrows errors raised in the background thread.
+  // Tracing and profiling start afterwards, as the background thread uses the same loggers and events.
+  auto asyncAdvance = std::move(_asyncAdvance);
+  asyncAdvance.get();
+
+  PRECICE_TRACE();
+  Event                        e("finishAdvance", profiling::Fundamental);
+  profiling::ScopedEventPrefix sep("finishAdvance/");
+
+  const auto state = std::move(*_pendingAdvance);
+  _pendingAdvance.reset();
+  completeAdvance(state);
+
+  sep.pop();
+  e.stop();
+  _solverAdvanceEvent->start();
+}
+
+ParticipantImpl::AdvanceState ParticipantImpl::beginAdvance(double computedTimeStepSize)
+{
   PRECICE_CHECK(_state != State::Constructed, "initialize() has to be called before advance().");
   PRECICE_CHECK(_state != State::Finalized, "advance() cannot be called after finalize().");
   PRECICE_CHECK(_state == State::Initialized, "initialize() has to be called before advance().");
@@ -371,28 +452,43 @@ void ParticipantImpl::advance(
   // Update the coupling scheme time state. Necessary to get correct remainder.
   const bool   isAtWindowEnd = _couplingScheme->addComputedTime(computedTimeStepSize);
   const double timeSteppedTo = _couplingScheme->getTime();
-  const auto   dataToReceive = _couplingScheme->implicitDataToReceive();
 
-  handleDataBeforeAdvance(isAtWindowEnd, timeSteppedTo);
+  // Meshes are locked before the exchange, which may run in a background thread
+  _meshLock.lockAll();
+
+  return {isAtWindowEnd, timeSteppedTo, _couplingScheme->implicitDataToReceive()};
+}
+
+void ParticipantImpl::exchangeAdvance(const AdvanceState &state)
+{
+  handleDataBeforeAdvance(state.isAtWindowEnd, state.timeSteppedTo);
 
   advanceCouplingScheme();
 
+  // Written data which is not sent, e.g. only exported, is mapped after the exchange
+  mapPendingWrittenData();
+}
+
+void ParticipantImpl::completeAdvance(const AdvanceState &state)
+{
   // In clase if an implicit scheme, this may be before timeSteppedTo
   const double timeAfterAdvance   = _couplingScheme->getTime();
   const bool   timeWindowComplete = _couplingScheme->isTimeWindowComplete();
 
-  handleDataAfterAdvance(isAtWindowEnd, timeWindowComplete, timeSteppedTo, timeAfterAdvance, dataToReceive);
+  handleDataAfterAdvance(state.isAtWindowEnd, timeWindowComplete, state.timeSteppedTo, timeAfterAdvance, state.dataToReceive);
 
   PRECICE_INFO(_couplingScheme->printCouplingState());
 
   PRECICE_DEBUG("Mapped {} samples in write mappings and {} samples in read mappings",
                 _executedWriteMappings, _executedReadMappings);
+}
 
-  _meshLock.lockAll();
-
-  sep.pop();
-  e.stop();
-  _solverAdvanceEvent->start();
+void ParticipantImpl::checkNoPendingAdvance(std::string_view functionName) const
+{
+  PRECICE_CHECK(!_asyncAdvance.valid(),
+                "{}() cannot be called while an advance started by startAdvance() is in progress. "
+                "Please call finishAdvance() first.",
+                functionName);
 }
 
 void ParticipantImpl::handleDataBeforeAdvance(bool reachedTimeWindowEnd, double timeSteppedTo)
@@ -407,8 +503,15 @@ void ParticipantImpl::handleDataBeforeAdvance(bool reachedTimeWindowEnd, double
   _executedWriteMappings = 0;
 
   if (reachedTimeWindowEnd) {
-    mapWrittenData(_couplingScheme->getTimeWindowStart());
-    performDataActions({action::Action::WRITE_MAPPING_POST});
+    const bool hasWriteMappingPostActions = std::any_of(_accessor->actions().begin(), _accessor->actions().end(),
+                                                        [](const auto &action) { return action->getTiming() == action::Action::WRITE_MAPPING_POST; });
+    if (hasWriteMappingPostActions) {
+      // Actions act on the mapped data before it is sent
+      mapWrittenData(_couplingScheme->getTimeWindowStart());
+      performDataActions({action::Action::WRITE_MAPPING_POST});
+    } else {
+      deferWrittenDataMapping(_couplingScheme->getTimeWindowStart());
+    }
   }
 }
 
@@ -477,6 +580,7 @@ void ParticipantImpl::trimSendDataAfter(double time)
 
 void ParticipantImpl::finalize()
 {
+  checkNoPendingAdvance("finalize");
   PRECICE_TRACE();
   PRECICE_CHECK(_state != State::Finalized, "finalize() may only be called once.");
 
@@ -519,6 +623,9 @@ void ParticipantImpl::finalize()
 #endif
   profiling::EventRegistry::instance().finalize();
 
+  // Write the records queued by asynchronous log sinks
+  logging::flushLogging();
+
   // Finally clear events and finalize MPI
   utils::Parallel::finalizeOrCleanupMPI();
   _state = State::Finalized;
@@ -526,6 +633,7 @@ void ParticipantImpl::finalize()
 
 int ParticipantImpl::getMeshDimensions(std::string_view meshName) const
 {
+  checkNoPendingAdvance("getMeshDimensions");
   PRECICE_TRACE(meshName);
   PRECICE_VALIDATE_MESH_NAME(meshName);
   return _accessor->usedMeshContext(meshName).mesh->getDimensions();
@@ -533,6 +641,7 @@ int ParticipantImpl::getMeshDimensions(std::string_view meshName) const
 
 int ParticipantImpl::getDataDimensions(std::string_view meshName, std::string_view dataName) const
 {
+  checkNoPendingAdvance("getDataDimensions");
   PRECICE_TRACE(meshName, dataName);
   PRECICE_VALIDATE_MESH_NAME(meshName);
   PRECICE_VALIDATE_DATA_NAME(meshName, dataName);
@@ -541,6 +650,7 @@ int ParticipantImpl::getDataDimensions(std::string_view meshName, std::string_vi
 
 bool ParticipantImpl::isCouplingOngoing() const
 {
+  checkNoPendingAdvance("isCouplingOngoing");
   PRECICE_TRACE();
   PRECICE_CHECK(_state != State::Finalized, "isCouplingOngoing() cannot be called after finalize().");
   PRECICE_CHECK(_state == State::Initialized, "initialize() has to be called before isCouplingOngoing() can be evaluated.");
@@ -549,6 +659,7 @@ bool ParticipantImpl::isCouplingOngoing() const
 
 bool ParticipantImpl::isTimeWindowComplete() const
 {
+  checkNoPendingAdvance("isTimeWindowComplete");
   PRECICE_TRACE();
   PRECICE_CHECK(_state != State::Constructed, "initialize() has to be called before isTimeWindowComplete().");
   PRECICE_CHECK(_state != State::Finalized, "isTimeWindowComplete() cannot be called after finalize().");
@@ -557,6 +668,7 @@ bool ParticipantImpl::isTimeWindowComplete() const
 
 double ParticipantImpl::getMaxTimeStepSize() const
 {
+  checkNoPendingAdvance("getMaxTimeStepSize");
   PRECICE_CHECK(_state != State::Finalized, "getMaxTimeStepSize() cannot be called after finalize().");
   PRECICE_CHECK(_state == State::Initialized, "initialize() has to be called before getMaxTimeStepSize() can be evaluated.");
   const double nextTimeStepSize = _couplingScheme->getNextTimeStepMaxSize();
@@ -574,6 +686,7 @@ double ParticipantImpl::getMaxTimeStepSize() const
 
 bool ParticipantImpl::requiresInitialData()
 {
+  checkNoPendingAdvance("requiresInitialData");
   PRECICE_TRACE();
   PRECICE_CHECK(_state == State::Constructed, "requiresInitialData() has to be called before initialize().");
   bool required = _couplingScheme->isActionRequired(cplscheme::CouplingScheme::Action::InitializeData);
@@ -585,6 +698,7 @@ bool ParticipantImpl::requiresInitialData()
 
 bool ParticipantImpl::requiresWritingCheckpoint()
 {
+  checkNoPendingAdvance("requiresWritingCheckpoint");
   PRECICE_TRACE();
   PRECICE_CHECK(_state == State::Initialized, "initialize() has to be called before requiresWritingCheckpoint().");
   bool required = _couplingScheme->isActionRequired(cplscheme::CouplingScheme::Action::WriteCheckpoint);
@@ -596,6 +710,7 @@ bool ParticipantImpl::requiresWritingCheckpoint()
 
 bool ParticipantImpl::requiresReadingCheckpoint()
 {
+  checkNoPendingAdvance("requiresReadingCheckpoint");
   PRECICE_TRACE();
   PRECICE_CHECK(_state == State::Initialized, "initialize() has to be called before requiresReadingCheckpoint().");
   bool required = _couplingScheme->isActionRequired(cplscheme::CouplingScheme::Action::ReadCheckpoint);
@@ -607,6 +722,7 @@ bool ParticipantImpl::requiresReadingCheckpoint()
 
 bool ParticipantImpl::requiresMeshConnectivityFor(std::string_view meshName) const
 {
+  checkNoPendingAdvance("requiresMeshConnectivityFor");
   PRECICE_VALIDATE_MESH_NAME(meshName);
   MeshContext &context = _accessor->usedMeshContext(meshName);
   return context.meshRequirement == mapping::Mapping::MeshRequirement::FULL;
@@ -615,6 +731,7 @@ bool ParticipantImpl::requiresMeshConnectivityFor(std::string_view meshName) con
 bool ParticipantImpl::requiresGradientDataFor(std::string_view meshName,
                                               std::string_view dataName) const
 {
+  checkNoPendingAdvance("requiresGradientDataFor");
   PRECICE_VALIDATE_DATA_NAME(meshName, dataName);
   // Read data never requires gradients
   if (!_accessor->isDataWrite(meshName, dataName))
@@ -627,6 +744,7 @@ bool ParticipantImpl::requiresGradientDataFor(std::string_view meshName,
 int ParticipantImpl::getMeshVertexSize(
     std::string_view meshName) const
 {
+  checkNoPendingAdvance("getMeshVertexSize");
   PRECICE_TRACE(meshName);
   PRECICE_REQUIRE_MESH_USE(meshName);
   // In case we access received mesh data: check, if the requested mesh data has already been received.
@@ -643,6 +761,7 @@ int ParticipantImpl::getMeshVertexSize(
 void ParticipantImpl::resetMesh(
     std::string_view meshName)
 {
+  checkNoPendingAdvance("resetMesh");
   PRECICE_EXPERIMENTAL_API();
   PRECICE_TRACE(meshName);
   PRECICE_VALIDATE_MESH_NAME(meshName);
@@ -657,6 +776,7 @@ VertexID ParticipantImpl::setMeshVertex(
     std::string_view              meshName,
     ::precice::span<const double> position)
 {
+  checkNoPendingAdvance("setMeshVertex");
   PRECICE_TRACE(meshName);
   PRECICE_REQUIRE_MESH_MODIFY(meshName);
   MeshContext &context = _accessor->usedMeshContext(meshName);
@@ -681,6 +801,7 @@ void ParticipantImpl::setMeshVertices(
     ::precice::span<const double> positions,
     ::precice::span<VertexID>     ids)
 {
+  checkNoPendingAdvance("setMeshVertices");
   PRECICE_TRACE(meshName, positions.size(), ids.size());
   PRECICE_REQUIRE_MESH_MODIFY(meshName);
   MeshContext &context = _accessor->usedMeshContext(meshName);
@@ -713,6 +834,7 @@ void ParticipantImpl::setMeshEdge(
     VertexID         first,
     VertexID         second)
 {
+  checkNoPendingAdvance("setMeshEdge");
   PRECICE_TRACE(meshName, first, second);
   PRECICE_REQUIRE_MESH_MODIFY(meshName);
   MeshContext &context = _accessor->usedMeshContext(meshName);
@@ -731,6 +853,7 @@ void ParticipantImpl::setMeshEdges(
     std::string_view                meshName,
     ::precice::span<const VertexID> vertices)
 {
+  checkNoPendingAdvance("setMeshEdges");
   PRECICE_TRACE(meshName, vertices.size());
   PRECICE_REQUIRE_MESH_MODIFY(meshName);
   MeshContext &context = _accessor->usedMeshContext(meshName);
@@ -767,6 +890,7 @@ void ParticipantImpl::setMeshTriangle(
     VertexID         second,
     VertexID         third)
 {
+  checkNoPendingAdvance("setMeshTriangle");
   PRECICE_TRACE(meshName, first,
                 second, third);
 
@@ -802,6 +926,7 @@ void ParticipantImpl::setMeshTriangles(
     std::string_view                meshName,
     ::precice::span<const VertexID> vertices)
 {
+  checkNoPendingAdvance("setMeshTriangles");
   PRECICE_TRACE(meshName, vertices.size());
   PRECICE_REQUIRE_MESH_MODIFY(meshName);
   MeshContext &context = _accessor->usedMeshContext(meshName);
@@ -842,6 +967,7 @@ void ParticipantImpl::setMeshQuad(
     VertexID         third,
     VertexID         fourth)
 {
+  checkNoPendingAdvance("setMeshQuad");
   PRECICE_TRACE(meshName, first,
                 second, third, fourth);
   PRECICE_REQUIRE_MESH_MODIFY(meshName);
@@ -891,6 +1017,7 @@ void ParticipantImpl::setMeshQuads(
     std::string_view                meshName,
     ::precice::span<const VertexID> vertices)
 {
+  checkNoPendingAdvance("setMeshQuads");
   PRECICE_TRACE(meshName, vertices.size());
   PRECICE_REQUIRE_MESH_MODIFY(meshName);
   MeshContext &context = _accessor->usedMeshContext(meshName);
@@ -957,6 +1084,7 @@ void ParticipantImpl::setMeshTetrahedron(
     VertexID         third,
     VertexID         fourth)
 {
+  checkNoPendingAdvance("setMeshTetrahedron");
   PRECICE_TRACE(meshName, first, second, third, fourth);
   PRECICE_REQUIRE_MESH_MODIFY(meshName);
   MeshContext &context = _accessor->usedMeshContext(meshName);
@@ -982,6 +1110,7 @@ void ParticipantImpl::setMeshTetrahedra(
     std::string_view                meshName,
     ::precice::span<const VertexID> vertices)
 {
+  checkNoPendingAdvance("setMeshTetrahedra");
   PRECICE_TRACE(meshName, vertices.size());
   PRECICE_REQUIRE_MESH_MODIFY(meshName);
   MeshContext &context = _accessor->usedMeshContext(meshName);
@@ -1023,6 +1152,7 @@ void ParticipantImpl::writeData(
     ::precice::span<const VertexID> vertices,
     ::precice::span<const double>   values)
 {
+  checkNoPendingAdvance("writeData");
   PRECICE_TRACE(meshName, dataName, vertices.size());
   PRECICE_CHECK(_state != State::Finalized, "writeData(...) cannot be called after finalize().");
   PRECICE_CHECK(_state == State::Constructed || (_state == State::Initialized && isCouplingOngoing()), "Calling writeData(...) is forbidden if coupling is not ongoing, because the data you are trying to write will not be used anymore. You can fix this by always calling writeData(...) before the advance(...) call in your simulation loop or by using Participant::isCouplingOngoing() to implement a safeguard.");
@@ -1058,8 +1188,9 @@ void ParticipantImpl::readData(
     std::string_view                dataName,
     ::precice::span<const VertexID> vertices,
     double                          relativeReadTime,
-    ::precice::span<double>         values) const
+    ::precice::span<double>         values)
 {
+  checkNoPendingAdvance("readData");
   PRECICE_TRACE(meshName, dataName, vertices.size(), relativeReadTime);
   PRECICE_CHECK(_state != State::Constructed, "readData(...) cannot be called before initialize().");
   PRECICE_CHECK(_state != State::Finalized, "readData(...) cannot be called after finalize().");
@@ -1069,12 +1200,19 @@ void ParticipantImpl::readData(
 
   PRECICE_REQUIRE_DATA_READ(meshName, dataName);
 
+  ReadDataContext &context = _accessor->readDataContext(meshName, dataName);
+
+  // Lazy read mappings are executed on the first read after receiving data.
+  // This happens before the early return below, as mappings may communicate between ranks.
+  if (context.hasPendingMapping()) {
+    _executedReadMappings += context.mapPendingData();
+  }
+
   // Inconsistent sizes will be handled below
   if (vertices.empty() && values.empty()) {
     return;
   }
 
-  ReadDataContext &context = _accessor->readDataContext(meshName, dataName);
   PRECICE_CHECK(context.hasSamples(), "Data \"{}\" cannot be read from mesh \"{}\" as it contains no samples. "
                                       "This is typically a configuration issue of the data flow. "
                                       "Check if the data is correctly exchanged to this participant \"{}\" and mapped to mesh \"{}\".",
@@ -1104,6 +1242,7 @@ void ParticipantImpl::writeGradientData(
     ::precice::span<const VertexID> vertices,
     ::precice::span<const double>   gradients)
 {
+  checkNoPendingAdvance("writeGradientData");
   PRECICE_EXPERIMENTAL_API();
 
   // Asserts and checks
@@ -1149,6 +1288,7 @@ void ParticipantImpl::setMeshAccessRegion(
     const std::string_view        meshName,
     ::precice::span<const double> boundingBox) const
 {
+  checkNoPendingAdvance("setMeshAccessRegion");
   PRECICE_TRACE(meshName, boundingBox.size());
   PRECICE_REQUIRE_MESH_USE(meshName);
   PRECICE_CHECK(_state != State::Finalized, "setMeshAccessRegion() cannot be called after finalize().");
@@ -1188,6 +1328,7 @@ void ParticipantImpl::getMeshVertexIDsAndCoordinates(
     ::precice::span<VertexID> ids,
     ::precice::span<double>   coordinates) const
 {
+  checkNoPendingAdvance("getMeshVertexIDsAndCoordinates");
   PRECICE_TRACE(meshName, ids.size(), coordinates.size());
   PRECICE_REQUIRE_MESH_USE(meshName);
   PRECICE_DEBUG("Get {} mesh vertices with IDs", ids.size());
@@ -1302,7 +1443,7 @@ void ParticipantImpl::configurePartitions(
 
       PRECICE_DEBUG("Receiving mesh from {}", provider);
 
-      context->partition = partition::PtrPartition(new partition::ReceivedPartition(context->mesh, context->geoFilter, context->safetyFactor, context->allowDirectAccess));
+      context->partition = partition::PtrPartition(new partition::ReceivedPartition(context->mesh, context->geoFilter, context->safetyFactor, context->allowDirectAccess, context->rankTreeArity));
 
       m2n::PtrM2N m2n = m2nConfig->getM2N(receiver, provider);
       m2n->createDistributedCommunication(context->mesh);
@@ -1430,6 +1571,31 @@ void ParticipantImpl::mapWrittenData(std::optional<double> after)
   }
 }
 
+void ParticipantImpl::deferWrittenDataMapping(std::optional<double> after)
+{
+  PRECICE_TRACE();
+  PRECICE_ASSERT(_pendingWriteMappings.empty());
+  computeMappings(_accessor->writeMappingContexts(), "write");
+  for (auto &context : _accessor->writeDataContexts()) {
+    if (context.hasMapping()) {
+      _pendingWriteMappings.push_back(&context);
+    }
+  }
+  _pendingWriteMappingsAfter = after;
+}
+
+void ParticipantImpl::mapPendingWrittenData(std::optional<DataID> dataID)
+{
+  PRECICE_TRACE();
+  auto isRequired = [dataID](const DataContext *context) { return !dataID || context->mapsInto(*dataID); };
+  auto required   = std::stable_partition(_pendingWriteMappings.begin(), _pendingWriteMappings.end(), [&](const DataContext *context) { return !isRequired(context); });
+  for (auto iter = required; iter != _pendingWriteMappings.end(); ++iter) {
+    PRECICE_DEBUG("Map write data \"{}\" from mesh \"{}\"", (*iter)->getDataName(), (*iter)->getMeshName());
+    _executedWriteMappings += (*iter)->mapData(_pendingWriteMappingsAfter);
+  }
+  _pendingWriteMappings.erase(required, _pendingWriteMappings.end());
+}
+
 void ParticipantImpl::trimReadMappedData(double startOfTimeWindow, bool isTimeWindowComplete, const cplscheme::ImplicitData &fromData)
 {
   PRECICE_TRACE();
@@ -1464,8 +1630,16 @@ void ParticipantImpl::mapReadData()
 {
   PRECICE_TRACE();
   computeMappings(_accessor->readMappingContexts(), "read");
+  // Actions act on the mapped data right after mapping
+  const bool hasReadMappingPostActions = std::any_of(_accessor->actions().begin(), _accessor->actions().end(),
+                                                     [](const auto &action) { return action->getTiming() == action::Action::READ_MAPPING_POST; });
   for (auto &context : _accessor->readDataContexts()) {
     if (context.hasMapping()) {
+      if (context.isMappedLazily() && !hasReadMappingPostActions) {
+        PRECICE_DEBUG("Defer mapping read data \"{}\" to mesh \"{}\" until it is read", context.getDataName(), context.getMeshName());
+        context.markMappingPending();
+        continue;
+      }
       PRECICE_DEBUG("Map read data \"{}\" to mesh \"{}\"", context.getDataName(), context.getMeshName());
       // We always ensure that all read data was mapped
       _executedReadMappings += context.mapData();
@@ -1473,6 +1647,14 @@ void ParticipantImpl::mapReadData()
   }
 }
 
+void ParticipantImpl::mapPendingReadData()
+{
+  PRECICE_TRACE();
+  for (auto &context : _accessor->readDataContexts()) {
+    _executedReadMappings += context.mapPendingData();
+  }
+}
+
 void ParticipantImpl::performDataActions(const std::set<action::Action::Timing> &timings)
 {
   PRECICE_TRACE();
@@ -1503,6 +1685,13 @@ void ParticipantImpl::handleExports(ExportTiming timing)
   exp.complete   = _couplingScheme->isTimeWindowComplete();
   exp.final      = !_couplingScheme->isCouplingOngoing();
   exp.time       = _couplingScheme->getTime();
+
+  // Exports and watch points require the lazily mapped read data
+  const bool exportsData = exp.complete || std::any_of(_accessor->exportContexts().begin(), _accessor->exportContexts().end(),
+                                                       [](const io::ExportContext &context) { return context.everyIteration; });
+  if (exportsData) {
+    mapPendingReadData();
+  }
   _accessor->exportIntermediate(exp);
 }
 
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <cstddef>
+#include <future>
 #include <map>
+#include <optional>
 #include <set>
 #include <string>
 #include <string_view>
@@ -100,6 +102,12 @@ public:
   /// @copydoc Participant::advance
   void advance(double computedTimeStepSize);
 
+  /// @copydoc Participant::startAdvance
+  void startAdvance(double computedTimeStepSize);
+
+  /// @copydoc Participant::finishAdvance
+  void finishAdvance();
+
   /// @copydoc Participant::finalize
   void finalize();
 
@@ -221,13 +229,17 @@ public:
   ///@name Data Access
   ///@{
 
-  /// @copydoc Participant::readData
+  /**
+   * @copydoc Participant::readData
+   *
+   * Not const, as lazy read mappings are executed on the first read.
+   */
   void readData(
       std::string_view                meshName,
       std::string_view                dataName,
       ::precice::span<const VertexID> vertices,
       double                          relativeReadTime,
-      ::precice::span<double>         values) const;
+      ::precice::span<double>         values);
 
   /// @copydoc Participant::writeData
   void writeData(
@@ -334,9 +346,28 @@ private:
   /// Counts the amount of samples mapped in write mappings executed in the latest advance
   int _executedWriteMappings = 0;
 
-  /// Counts the amount of samples mapped in read mappings executed in the latest advance
+  /// Counts the amount of samples mapped in read mappings executed in the latest advance, including lazy read mappings executed in readData()
   int _executedReadMappings = 0;
 
+  /// Write data contexts whose mapping is deferred until the coupling scheme sends the mapped data
+  std::vector<DataContext *> _pendingWriteMappings;
+
+  /// Only samples after this time are mapped by the pending write mappings
+  std::optional<double> _pendingWriteMappingsAfter;
+
+  /// The time state of an advance, which is carried from adding the computed time to completing the advance
+  struct AdvanceState {
+    bool                    isAtWindowEnd;
+    double                  timeSteppedTo;
+    cplscheme::ImplicitData dataToReceive;
+  };
+
+  /// The state of the advance started by startAdvance(), empty if there is none
+  std::optional<AdvanceState> _pendingAdvance;
+
+  /// Progress of the advance started by startAdvance(), running in a background thread
+  std::future<void> _asyncAdvance;
+
   /**
    * @brief Configures the coupling interface from the given xml file.
    *
@@ -385,12 +416,28 @@ private:
   /// Computes, and performs suitable write mappings either entirely or after given time
   void mapWrittenData(std::optional<double> after = std::nullopt);
 
+  /**
+   * @brief Computes write mappings, but defers performing them until the mapped data is required.
+   *
+   * The coupling scheme maps every data right before sending it, which overlaps the write
+   * mapping of one data with the asynchronous send of the previous one.
+   *
+   * @see mapPendingWrittenData()
+   */
+  void deferWrittenDataMapping(std::optional<double> after = std::nullopt);
+
+  /// Performs the pending write mappings into the given data or all pending write mappings
+  void mapPendingWrittenData(std::optional<DataID> dataID = std::nullopt);
+
   // Computes, and performs read mappings of the initial data in initialize
   void mapInitialReadData();
 
-  // Computes, and performs read mappings
+  // Computes, and performs read mappings. Lazily mapped read data is only marked as pending.
   void mapReadData();
 
+  // Performs the pending lazy read mappings of all read data
+  void mapPendingReadData();
+
   /**
    * @brief Removes samples in mapped to data connected to received data via a mapping.
    *
@@ -423,6 +470,18 @@ private:
   /// Advances the coupling schemes
   void advanceCouplingScheme();
 
+  /// Checks the preconditions of advance and adds the computed time to the coupling scheme
+  AdvanceState beginAdvance(double computedTimeStepSize);
+
+  /// Maps written data and exchanges data in the coupling scheme, including the acceleration
+  void exchangeAdvance(const AdvanceState &state);
+
+  /// Maps read data and updates the participant state after the exchange of the coupling scheme
+  void completeAdvance(const AdvanceState &state);
+
+  /// Raises an error if an advance started by startAdvance() is still in progress
+  void checkNoPendingAdvance(std::string_view functionName) const;
+
   /// Syncs the time step size between all ranks (all time steps sizes should be the same!)
   void syncTimestep(double computedTimeStepSize);
 
@@ -1,5 +1,7 @@
 #include "ParticipantState.hpp"
 #include <algorithm>
+#include <iterator>
+#include <memory>
 #include <ostream>
 #include <sstream>
 #include <string>
@@ -10,6 +12,7 @@
 #include "MeshContext.hpp"
 #include "WatchIntegral.hpp"
 #include "WatchPoint.hpp"
+#include "WatchPointGroup.hpp"
 #include "action/Action.hpp"
 #include "io/Export.hpp"
 #include "logging/LogMacros.hpp"
@@ -55,10 +58,23 @@ void ParticipantState::setUsePrimaryRank(bool useIntraComm)
   _useIntraComm = useIntraComm;
 }
 
+void ParticipantState::setSplitAdvance(bool splitAdvance)
+{
+  _useSplitAdvance = splitAdvance;
+}
+
 void ParticipantState::addWatchPoint(
     const PtrWatchPoint &watchPoint)
 {
   _watchPoints.push_back(watchPoint);
+
+  auto group = std::find_if(_watchPointGroups.begin(), _watchPointGroups.end(),
+                            [&watchPoint](const PtrWatchPointGroup &candidate) { return candidate->mesh() == watchPoint->mesh(); });
+  if (group == _watchPointGroups.end()) {
+    _watchPointGroups.push_back(std::make_shared<WatchPointGroup>(watchPoint->mesh()));
+    group = std::prev(_watchPointGroups.end());
+  }
+  (*group)->addWatchPoint(watchPoint);
 }
 
 void ParticipantState::addWatchIntegral(
@@ -84,7 +100,8 @@ void ParticipantState::receiveMesh(const mesh::PtrMesh &
                                    const std::string &                           fromParticipant,
                                    double                                        safetyFactor,
                                    partition::ReceivedPartition::GeometricFilter geoFilter,
-                                   const bool                                    allowDirectAccess)
+                                   const bool                                    allowDirectAccess,
+                                   int                                           rankTreeArity)
 {
   std::string meshName = mesh->getName();
   PRECICE_TRACE(_name, meshName);
@@ -98,6 +115,7 @@ void ParticipantState::receiveMesh(const mesh::PtrMesh &
   context->provideMesh       = false;
   context->geoFilter         = geoFilter;
   context->allowDirectAccess = allowDirectAccess;
+  context->rankTreeArity     = rankTreeArity;
 
   _meshContexts[std::move(meshName)] = context;
 
@@ -114,10 +132,11 @@ void ParticipantState::addWriteData(
 
 void ParticipantState::addReadData(
     const mesh::PtrData &data,
-    const mesh::PtrMesh &mesh)
+    const mesh::PtrMesh &mesh,
+    bool                 lazyMapping)
 {
   checkDuplicatedData(mesh->getName(), data->getName());
-  _readDataContexts.emplace(MeshDataKey{mesh->getName(), data->getName()}, ReadDataContext(data, mesh));
+  _readDataContexts.emplace(MeshDataKey{mesh->getName(), data->getName()}, ReadDataContext(data, mesh, lazyMapping));
 }
 
 void ParticipantState::addReadMappingContext(
@@ -319,6 +338,11 @@ std::vector<PtrWatchPoint> &ParticipantState::watchPoints()
   return _watchPoints;
 }
 
+std::vector<PtrWatchPointGroup> &ParticipantState::watchPointGroups()
+{
+  return _watchPointGroups;
+}
+
 std::vector<PtrWatchIntegral> &ParticipantState::watchIntegrals()
 {
   return _watchIntegrals;
@@ -329,6 +353,11 @@ bool ParticipantState::useIntraComm() const
   return _useIntraComm;
 }
 
+bool ParticipantState::useSplitAdvance() const
+{
+  return _useSplitAdvance;
+}
+
 const std::string &ParticipantState::getName() const
 {
   return _name;
@@ -371,8 +400,8 @@ void ParticipantState::exportIntermediate(IntermediateExport exp)
 
   if (exp.complete) {
     // Export watch point data
-    for (const PtrWatchPoint &watchPoint : watchPoints()) {
-      watchPoint->exportPointData(exp.time);
+    for (const PtrWatchPointGroup &watchPointGroup : watchPointGroups()) {
+      watchPointGroup->exportPointData(exp.time);
     }
 
     for (const PtrWatchIntegral &watchIntegral : watchIntegrals()) {
@@ -97,10 +97,11 @@ public:
       const mesh::PtrData &data,
       const mesh::PtrMesh &mesh);
 
-  /// Adds a configured read \ref Data to the ParticipantState
+  /// Adds a configured read \ref Data to the ParticipantState, optionally mapped on the first read
   void addReadData(
       const mesh::PtrData &data,
-      const mesh::PtrMesh &mesh);
+      const mesh::PtrMesh &mesh,
+      bool                 lazyMapping = false);
 
   /// Adds a configured read \ref Mapping to the ParticipantState
   void addReadMappingContext(const MappingContext &mappingContext);
@@ -108,7 +109,7 @@ public:
   /// Adds a configured write \ref Mapping to the ParticipantState
   void addWriteMappingContext(const MappingContext &mappingContext);
 
-  /// Adds a configured \ref WatchPoint to the ParticipantState
+  /// Adds a configured \ref WatchPoint to the ParticipantState and to the \ref WatchPointGroup of its mesh
   void addWatchPoint(const PtrWatchPoint &watchPoint);
 
   /// Adds a configured \ref WatchIntegral to the ParticipantState
@@ -117,6 +118,9 @@ public:
   /// Sets weather the participant was configured with a primary tag
   void setUsePrimaryRank(bool useIntraComm);
 
+  /// Sets whether the participant was configured to use startAdvance() and finishAdvance()
+  void setSplitAdvance(bool splitAdvance);
+
   /// Sets the manager responsible for providing unique IDs to meshes.
   void setMeshIdManager(std::unique_ptr<utils::ManageUniqueIDs> &&idm)
   {
@@ -137,7 +141,8 @@ public:
                    const std::string &                           fromParticipant,
                    double                                        safetyFactor,
                    partition::ReceivedPartition::GeometricFilter geoFilter,
-                   const bool                                    allowDirectAccess);
+                   const bool                                    allowDirectAccess,
+                   int                                           rankTreeArity);
   /// @}
 
   /// @name Data queries
@@ -282,6 +287,9 @@ public:
   /// Returns true, if the participant uses a primary tag.
   bool useIntraComm() const;
 
+  /// Returns true, if the participant may advance using startAdvance() and finishAdvance().
+  bool useSplitAdvance() const;
+
   /// Provided access to all read \ref MappingContext
   std::vector<MappingContext> &readMappingContexts();
 
@@ -291,6 +299,9 @@ public:
   /// Provided access to all \ref WatchPoints
   std::vector<PtrWatchPoint> &watchPoints();
 
+  /// Provided access to all \ref WatchPointGroup, one per watched mesh
+  std::vector<PtrWatchPointGroup> &watchPointGroups();
+
   /// Provided access to all \ref WatchIntegrals
   std::vector<PtrWatchIntegral> &watchIntegrals();
 
@@ -320,6 +331,8 @@ private:
 
   std::vector<PtrWatchPoint> _watchPoints;
 
+  std::vector<PtrWatchPointGroup> _watchPointGroups;
+
   std::vector<PtrWatchIntegral> _watchIntegrals;
 
   /// Export contexts to export meshes, data, and more.
@@ -351,6 +364,8 @@ private:
 
   bool _useIntraComm = false;
 
+  bool _useSplitAdvance = false;
+
   std::unique_ptr<utils::ManageUniqueIDs> _meshIdManager;
 
   template <typename ELEMENT_T>
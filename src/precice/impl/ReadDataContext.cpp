@@ -6,8 +6,9 @@ logging::Logger ReadDataContext::_log{"impl::ReadDataContext"};
 
 ReadDataContext::ReadDataContext(
     mesh::PtrData data,
-    mesh::PtrMesh mesh)
-    : DataContext(data, mesh)
+    mesh::PtrMesh mesh,
+    bool          lazyMapping)
+    : DataContext(data, mesh), _lazyMapping(lazyMapping)
 {
 }
 
@@ -38,6 +39,33 @@ void ReadDataContext::readValues(::precice::span<const VertexID> vertices, doubl
   }
 }
 
+bool ReadDataContext::isMappedLazily() const
+{
+  return _lazyMapping;
+}
+
+void ReadDataContext::markMappingPending()
+{
+  PRECICE_ASSERT(hasMapping());
+  _pendingMapping = true;
+}
+
+bool ReadDataContext::hasPendingMapping() const
+{
+  return _pendingMapping;
+}
+
+int ReadDataContext::mapPendingData()
+{
+  PRECICE_TRACE(getMeshName(), getDataName());
+  if (!_pendingMapping) {
+    return 0;
+  }
+  _pendingMapping = false;
+  PRECICE_DEBUG("Map pending read data \"{}\" to mesh \"{}\"", getDataName(), getMeshName());
+  return mapData();
+}
+
 int ReadDataContext::getWaveformDegree() const
 {
   return _providedData->getWaveformDegree();
@@ -21,10 +21,12 @@ public:
    *
    * @param data Data associated with this ReadDataContext.
    * @param mesh Mesh associated with this ReadDataContext.
+   * @param lazyMapping Map the data on the first read instead of after every data exchange.
    */
   ReadDataContext(
       mesh::PtrData data,
-      mesh::PtrMesh mesh);
+      mesh::PtrMesh mesh,
+      bool          lazyMapping = false);
 
   /**
    * @brief Gets degree of waveform
@@ -57,6 +59,24 @@ public:
   /// Are there samples to read from?
   bool hasSamples() const;
 
+  /// Is the read mapping executed on the first read instead of after every data exchange?
+  bool isMappedLazily() const;
+
+  /// Marks the mapped data as outdated, such that the next call to mapPendingData() maps it
+  void markMappingPending();
+
+  /// Is the mapped data outdated?
+  bool hasPendingMapping() const;
+
+  /**
+   * @brief Maps the data if it was marked as outdated
+   *
+   * Samples, which were already mapped, are not mapped again.
+   *
+   * @return the number of performed mappings
+   */
+  int mapPendingData();
+
   /// Disable copy construction
   ReadDataContext(const ReadDataContext &copy) = delete;
 
@@ -81,6 +101,12 @@ public:
 
 private:
   static logging::Logger _log;
+
+  /// Map the data on demand, see mapPendingData()
+  bool _lazyMapping;
+
+  /// Was data received since the last mapping?
+  bool _pendingMapping = false;
 };
 
 } // namespace impl
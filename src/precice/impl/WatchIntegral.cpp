@@ -13,11 +13,12 @@
 namespace precice::impl {
 
 WatchIntegral::WatchIntegral(
-    mesh::PtrMesh      meshToWatch,
-    const std::string &exportFilename,
-    bool               isScalingOn)
+    mesh::PtrMesh              meshToWatch,
+    const std::string &        exportFilename,
+    bool                       isScalingOn,
+    io::TXTTableWriter::Format format)
     : _mesh(std::move(meshToWatch)),
-      _txtWriter(exportFilename),
+      _txtWriter(exportFilename, format),
       _isScalingOn(isScalingOn)
 {
   PRECICE_ASSERT(_mesh);
@@ -64,9 +65,12 @@ void WatchIntegral::exportIntegralData(
     _txtWriter.writeData("Time", time);
   }
 
+  // The lumped areas are cached by the mesh, which resets them if the mesh changes, e.g., during remeshing
+  const Eigen::VectorXd &areas = _mesh->vertexAreas();
+
   for (auto &elem : _dataToExport) {
     const int dataDimensions = elem->getDimensions();
-    auto      integral       = calculateIntegral(elem);
+    auto      integral       = calculateIntegral(elem, areas);
 
     if (utils::IntraComm::getSize() > 1) {
       Eigen::VectorXd valueRecv = Eigen::VectorXd::Zero(dataDimensions);
@@ -86,7 +90,7 @@ void WatchIntegral::exportIntegralData(
 
   // Calculate surface area only if there is connectivity information
   if (not _mesh->edges().empty()) {
-    double surfaceArea = calculateSurfaceArea();
+    double surfaceArea = areas.sum();
     if (utils::IntraComm::getSize() > 1) {
       double surfaceAreaSum = 0.0;
       utils::IntraComm::reduceSum(surfaceArea, surfaceAreaSum);
@@ -103,9 +107,13 @@ void WatchIntegral::exportIntegralData(
       utils::IntraComm::reduceSum(surfaceArea, surfaceAreaSum);
     }
   }
+
+  if (not utils::IntraComm::isSecondary()) {
+    _txtWriter.flush();
+  }
 }
 
-Eigen::VectorXd WatchIntegral::calculateIntegral(const mesh::PtrData &data) const
+Eigen::VectorXd WatchIntegral::calculateIntegral(const mesh::PtrData &data, const Eigen::VectorXd &areas) const
 {
   int                    dim    = data->getDimensions();
   const Eigen::VectorXd &values = data->values();
@@ -120,24 +128,10 @@ Eigen::VectorXd WatchIntegral::calculateIntegral(const mesh::PtrData &data) cons
     }
     return sum;
   } else { // Connectivity information is given
-    return mesh::integrateSurface(_mesh, data->values());
-  }
-}
-
-double WatchIntegral::calculateSurfaceArea() const
-{
-  PRECICE_ASSERT(not _mesh->edges().empty());
-  double surfaceArea = 0.0;
-  if (_mesh->getDimensions() == 3) {
-    for (const auto &face : _mesh->triangles()) {
-      surfaceArea += face.getArea();
-    }
-  } else {
-    for (const auto &edge : _mesh->edges()) {
-      surfaceArea += edge.getLength();
-    }
+    PRECICE_ASSERT(areas.size() == static_cast<Eigen::Index>(_mesh->nVertices()));
+    Eigen::Map<const Eigen::MatrixXd> vertexValues(values.data(), dim, _mesh->nVertices());
+    return vertexValues * areas;
   }
-  return surfaceArea;
 }
 
 } // namespace precice::impl
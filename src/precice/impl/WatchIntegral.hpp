@@ -32,11 +32,13 @@ public:
    * @param[in] meshToWatch Mesh to be watched.
    * @param[in] exportFilename output file name
    * @param[in] isScalingOn whether the data will be scaled with area or not
+   * @param[in] format Format of the output file
    */
   WatchIntegral(
-      mesh::PtrMesh      meshToWatch,
-      const std::string &exportFilename,
-      bool               isScalingOn);
+      mesh::PtrMesh              meshToWatch,
+      const std::string &        exportFilename,
+      bool                       isScalingOn,
+      io::TXTTableWriter::Format format = io::TXTTableWriter::Format::Text);
 
   /// Writes one line with data of the integral over the mesh into the output file.
   void exportIntegralData(double time);
@@ -55,9 +57,8 @@ private:
 
   bool _isScalingOn;
 
-  Eigen::VectorXd calculateIntegral(const mesh::PtrData &data) const;
-
-  double calculateSurfaceArea() const;
+  /// Integrates the data, scaling with the given lumped vertex areas if enabled
+  Eigen::VectorXd calculateIntegral(const mesh::PtrData &data, const Eigen::VectorXd &areas) const;
 };
 
 } // namespace impl
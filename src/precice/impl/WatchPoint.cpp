@@ -22,12 +22,13 @@
 namespace precice::impl {
 
 WatchPoint::WatchPoint(
-    Eigen::VectorXd    pointCoords,
-    mesh::PtrMesh      meshToWatch,
-    const std::string &exportFilename)
+    Eigen::VectorXd            pointCoords,
+    mesh::PtrMesh              meshToWatch,
+    const std::string &        exportFilename,
+    io::TXTTableWriter::Format format)
     : _point(std::move(pointCoords)),
       _mesh(std::move(meshToWatch)),
-      _txtWriter(exportFilename)
+      _txtWriter(exportFilename, format)
 {
   PRECICE_ASSERT(_mesh);
   PRECICE_ASSERT(_point.size() == _mesh->getDimensions(), _point.size(),
@@ -95,34 +96,55 @@ void WatchPoint::exportPointData(
     return;
   }
 
-  _txtWriter.writeData("Time", time);
   // Export watch point coordinates
   Eigen::VectorXd coords = Eigen::VectorXd::Constant(_mesh->getDimensions(), 0.0);
   for (const auto &elem : _interpolation->getWeightedElements()) {
     coords += elem.weight * _mesh->vertex(elem.vertexID).getCoords();
   }
-  if (coords.size() == 2) {
-    _txtWriter.writeData("Coordinate", Eigen::Vector2d(coords));
-  } else {
-    _txtWriter.writeData("Coordinate", Eigen::Vector3d(coords));
-  }
   // Export watch point data
+  std::vector<Eigen::VectorXd> values;
   for (auto &elem : _dataToExport) {
     if (elem->getDimensions() > 1) {
       Eigen::VectorXd toExport = Eigen::VectorXd::Zero(_mesh->getDimensions());
       getValue(toExport, elem);
-      if (coords.size() == 2) {
-        _txtWriter.writeData(elem->getName(), Eigen::Vector2d(toExport));
-      } else {
-        _txtWriter.writeData(elem->getName(), Eigen::Vector3d(toExport));
-      }
-
+      values.push_back(std::move(toExport));
     } else {
       double valueToExport = 0.0;
       getValue(valueToExport, elem);
-      _txtWriter.writeData(elem->getName(), valueToExport);
+      values.push_back(Eigen::VectorXd::Constant(1, valueToExport));
+    }
+  }
+  writeRow(time, coords, values);
+}
+
+const Eigen::VectorXd &WatchPoint::point() const
+{
+  return _point;
+}
+
+void WatchPoint::writeRow(
+    double                              time,
+    const Eigen::VectorXd &             coordinates,
+    const std::vector<Eigen::VectorXd> &values)
+{
+  PRECICE_ASSERT(values.size() == _dataToExport.size(), values.size(), _dataToExport.size());
+  _txtWriter.writeData("Time", time);
+  if (coordinates.size() == 2) {
+    _txtWriter.writeData("Coordinate", Eigen::Vector2d(coordinates));
+  } else {
+    _txtWriter.writeData("Coordinate", Eigen::Vector3d(coordinates));
+  }
+  for (std::size_t i = 0; i < _dataToExport.size(); ++i) {
+    const auto &name = _dataToExport[i]->getName();
+    if (_dataToExport[i]->getDimensions() == 1) {
+      _txtWriter.writeData(name, values[i][0]);
+    } else if (coordinates.size() == 2) {
+      _txtWriter.writeData(name, Eigen::Vector2d(values[i]));
+    } else {
+      _txtWriter.writeData(name, Eigen::Vector3d(values[i]));
     }
   }
+  _txtWriter.flush();
 }
 
 void WatchPoint::getValue(
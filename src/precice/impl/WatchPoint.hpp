@@ -26,11 +26,13 @@ public:
    * @brief Constructor.
    *
    * @param[in] meshToWatch Mesh to be watched, can be empty on construction.
+   * @param[in] format Format of the output file
    */
   WatchPoint(
-      Eigen::VectorXd    pointCoords,
-      mesh::PtrMesh      meshToWatch,
-      const std::string &exportFilename);
+      Eigen::VectorXd            pointCoords,
+      mesh::PtrMesh              meshToWatch,
+      const std::string &        exportFilename,
+      io::TXTTableWriter::Format format = io::TXTTableWriter::Format::Text);
 
   const mesh::PtrMesh &mesh() const;
 
@@ -45,6 +47,16 @@ public:
   /// Writes one line with data of the watchpoint into the output file.
   void exportPointData(double time);
 
+  /// Coordinates of the point to watch.
+  const Eigen::VectorXd &point() const;
+
+  /**
+   * @brief Writes one line with given interpolated coordinates and data into the output file.
+   *
+   * @param[in] values The interpolated values of every data of the mesh, in the order of Mesh::data()
+   */
+  void writeRow(double time, const Eigen::VectorXd &coordinates, const std::vector<Eigen::VectorXd> &values);
+
   bool isClosest() const
   {
     return _isClosest;
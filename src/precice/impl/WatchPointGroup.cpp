@@ -0,0 +1,143 @@
+#include <Eigen/Core>
+#include <Eigen/SparseCore>
+#include <limits>
+#include <utility>
+
+#include "WatchPoint.hpp"
+#include "WatchPointGroup.hpp"
+#include "com/Communication.hpp"
+#include "com/SharedPointer.hpp"
+#include "logging/LogMacros.hpp"
+#include "mapping/Polation.hpp"
+#include "mesh/Data.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/Vertex.hpp"
+#include "precice/impl/Types.hpp"
+#include "query/Index.hpp"
+#include "utils/IntraComm.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice::impl {
+
+WatchPointGroup::WatchPointGroup(
+    mesh::PtrMesh meshToWatch)
+    : _mesh(std::move(meshToWatch))
+{
+  PRECICE_ASSERT(_mesh);
+}
+
+const mesh::PtrMesh &WatchPointGroup::mesh() const
+{
+  return _mesh;
+}
+
+void WatchPointGroup::addWatchPoint(
+    const PtrWatchPoint &watchPoint)
+{
+  PRECICE_ASSERT(watchPoint->mesh() == _mesh, "The watch point observes a different mesh than the group.");
+  _watchPoints.push_back(watchPoint);
+}
+
+const std::vector<PtrWatchPoint> &WatchPointGroup::watchPoints() const
+{
+  return _watchPoints;
+}
+
+void WatchPointGroup::initialize()
+{
+  PRECICE_TRACE(_mesh->getName(), _watchPoints.size());
+  const auto nPoints = _watchPoints.size();
+
+  // Locate all points on the local part of the mesh
+  std::vector<double>            distances(nPoints, std::numeric_limits<double>::max());
+  std::vector<mapping::Polation> matches;
+  if (_mesh->nVertices() > 0) {
+    auto &index = _mesh->index();
+    matches.reserve(nPoints);
+    for (std::size_t i = 0; i < nPoints; ++i) {
+      auto match   = index.findCellOrProjection(_watchPoints[i]->point(), 4);
+      distances[i] = match.polation.distance();
+      matches.push_back(std::move(match.polation));
+    }
+  }
+
+  // Determine the closest rank of all points at once
+  std::vector<int> closestRanks(nPoints, 0);
+  if (utils::IntraComm::isSecondary()) {
+    utils::IntraComm::getCommunication()->send(precice::span<const double>{distances}, 0);
+    utils::IntraComm::getCommunication()->broadcast(closestRanks, 0);
+  }
+
+  if (utils::IntraComm::isPrimary()) {
+    std::vector<double> closestDistances = distances;
+    std::vector<double> secondaryDistances(nPoints);
+    for (Rank secondaryRank : utils::IntraComm::allSecondaryRanks()) {
+      utils::IntraComm::getCommunication()->receive(precice::span<double>{secondaryDistances}, secondaryRank);
+      for (std::size_t i = 0; i < nPoints; ++i) {
+        if (secondaryDistances[i] < closestDistances[i]) {
+          closestDistances[i] = secondaryDistances[i];
+          closestRanks[i]     = secondaryRank;
+        }
+      }
+    }
+    utils::IntraComm::getCommunication()->broadcast(closestRanks);
+  }
+
+  // Assemble the interpolation of the points this rank is closest to
+  _localPoints.clear();
+  std::vector<Eigen::Triplet<double>> weights;
+  if (!matches.empty()) {
+    const Rank rank = utils::IntraComm::getRank();
+    for (std::size_t i = 0; i < nPoints; ++i) {
+      if (closestRanks[i] != rank) {
+        continue;
+      }
+      const int row = _localPoints.size();
+      _localPoints.push_back(i);
+      for (const auto &elem : matches[i].getWeightedElements()) {
+        weights.emplace_back(row, elem.vertexID, elem.weight);
+      }
+    }
+  }
+  _interpolation.resize(_localPoints.size(), _mesh->nVertices());
+  _interpolation.setFromTriplets(weights.begin(), weights.end());
+
+  PRECICE_DEBUG("Rank: {}, closest to {} of {} watch points", utils::IntraComm::getRank(), _localPoints.size(), nPoints);
+}
+
+void WatchPointGroup::exportPointData(
+    double time)
+{
+  if (_localPoints.empty()) {
+    return;
+  }
+  PRECICE_ASSERT(static_cast<std::size_t>(_interpolation.cols()) == _mesh->nVertices());
+
+  const int dimensions = _mesh->getDimensions();
+
+  // The mesh may move, hence the coordinates are interpolated on every export
+  Eigen::MatrixXd coordinates = Eigen::MatrixXd::Zero(dimensions, _localPoints.size());
+  for (int row = 0; row < _interpolation.outerSize(); ++row) {
+    for (decltype(_interpolation)::InnerIterator it(_interpolation, row); it; ++it) {
+      coordinates.col(row) += it.value() * _mesh->vertex(it.col()).getCoords();
+    }
+  }
+
+  // Values are stored interleaved per vertex, which is a row-major matrix of vertices times components
+  using VertexValues = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+  std::vector<Eigen::MatrixXd> interpolated;
+  for (const auto &data : _mesh->data()) {
+    Eigen::Map<const VertexValues> values(data->values().data(), _mesh->nVertices(), data->getDimensions());
+    interpolated.push_back(_interpolation * values);
+  }
+
+  std::vector<Eigen::VectorXd> pointValues(interpolated.size());
+  for (std::size_t row = 0; row < _localPoints.size(); ++row) {
+    for (std::size_t i = 0; i < interpolated.size(); ++i) {
+      pointValues[i] = interpolated[i].row(row).transpose();
+    }
+    _watchPoints[_localPoints[row]]->writeRow(time, coordinates.col(row), pointValues);
+  }
+}
+
+} // namespace precice::impl
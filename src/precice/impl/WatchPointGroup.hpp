@@ -0,0 +1,57 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <Eigen/SparseCore>
+#include <vector>
+#include "SharedPointer.hpp"
+#include "logging/Logger.hpp"
+#include "mesh/SharedPointer.hpp"
+
+namespace precice {
+namespace impl {
+
+/**
+ * @brief Observes and exports several WatchPoint on the same mesh at once.
+ *
+ * All points are located with one pass over the index of the mesh, and the closest rank
+ * of every point is determined by a single exchange between the primary and the secondary ranks.
+ * The interpolations of the points this rank is closest to form the rows of a sparse matrix,
+ * which evaluates all of them per export.
+ */
+class WatchPointGroup {
+public:
+  /// Constructor, creates an empty group observing the given mesh.
+  explicit WatchPointGroup(mesh::PtrMesh meshToWatch);
+
+  const mesh::PtrMesh &mesh() const;
+
+  /// Adds a WatchPoint observing the mesh of the group.
+  void addWatchPoint(const PtrWatchPoint &watchPoint);
+
+  const std::vector<PtrWatchPoint> &watchPoints() const;
+
+  /** Initializes all watch points for exporting point data.
+   *
+   * This can be called repeatedly to reinitialize the group.
+   */
+  void initialize();
+
+  /// Writes one line with data into the output file of each watch point this rank is closest to.
+  void exportPointData(double time);
+
+private:
+  logging::Logger _log{"impl::WatchPointGroup"};
+
+  mesh::PtrMesh _mesh;
+
+  std::vector<PtrWatchPoint> _watchPoints;
+
+  /// Indices of the watch points this rank is the closest to
+  std::vector<int> _localPoints;
+
+  /// Interpolation weights of the local watch points (rows) from the mesh vertices (columns)
+  Eigen::SparseMatrix<double, Eigen::RowMajor> _interpolation;
+};
+
+} // namespace impl
+} // namespace precice
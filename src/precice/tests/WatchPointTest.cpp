@@ -6,6 +6,7 @@
 #include <string>
 #include <vector>
 #include "../impl/WatchPoint.hpp"
+#include "../impl/WatchPointGroup.hpp"
 #include "mesh/Data.hpp"
 #include "mesh/Mesh.hpp"
 #include "mesh/SharedPointer.hpp"
@@ -617,6 +618,101 @@ BOOST_AUTO_TEST_CASE(VolumetricParallel)
   }
 }
 
+void testWatchPointGroup(const TestContext &context)
+{
+  using namespace mesh;
+  // A line of vertices along the x-axis, which is split between the ranks in parallel
+  PtrMesh   mesh(new Mesh("line", 2, testing::nextMeshID()));
+  const int first = (context.size > 1 && !context.isPrimary()) ? 5 : 0;
+  const int last  = (context.size > 1 && context.isPrimary()) ? 5 : 10;
+  for (int x = first; x <= last; ++x) {
+    mesh->createVertex(Eigen::Vector2d(x, 0.0));
+  }
+  for (int i = 0; i < last - first; ++i) {
+    mesh->createEdge(mesh->vertex(i), mesh->vertex(i + 1));
+  }
+
+  using precice::testing::operator""_dataID;
+  PtrData doubleData = mesh->createData("DoubleData", 1, 0_dataID);
+  PtrData vectorData = mesh->createData("VectorData", 2, 1_dataID);
+  mesh->allocateDataValues();
+  auto setValues = [&](double offset) {
+    for (int i = 0; i <= last - first; ++i) {
+      const double x                  = first + i;
+      doubleData->values()(i)         = x * x + offset;
+      vectorData->values()(2 * i)     = x + offset;
+      vectorData->values()(2 * i + 1) = -x;
+    }
+  };
+  setValues(0.0);
+
+  const std::vector<Eigen::Vector2d> points{{0.5, 0.3}, {2.25, -1.0}, {4.9, 0.1}, {7.5, 0.5}, {12.0, 0.0}};
+  auto filename = [&context](const std::string &kind, std::size_t point) {
+    return "precice-WatchPointTest-group-" + kind + "-" + std::to_string(point) + "-" + std::to_string(context.rank) + ".log";
+  };
+
+  std::vector<bool> isClosest;
+  // this scope forces the filestreams to be closed
+  {
+    std::vector<impl::PtrWatchPoint> singles;
+    impl::WatchPointGroup            group(mesh);
+    for (std::size_t i = 0; i < points.size(); ++i) {
+      singles.push_back(std::make_shared<impl::WatchPoint>(points[i], mesh, filename("single", i)));
+      group.addWatchPoint(std::make_shared<impl::WatchPoint>(points[i], mesh, filename("group", i)));
+    }
+
+    for (auto &single : singles) {
+      single->initialize();
+      isClosest.push_back(single->isClosest());
+    }
+    group.initialize();
+
+    for (auto &single : singles) {
+      single->exportPointData(0.0);
+    }
+    group.exportPointData(0.0);
+
+    setValues(1.0);
+    for (auto &single : singles) {
+      single->exportPointData(1.0);
+    }
+    group.exportPointData(1.0);
+  }
+
+  // Both evaluations write the same rows on the closest rank
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    if (!isClosest[i]) {
+      continue;
+    }
+    BOOST_TEST_CONTEXT("Validating watchpoint " << i)
+    {
+      auto expected = readDoublesFromTXTFile(filename("single", i), 6);
+      auto result   = readDoublesFromTXTFile(filename("group", i), 6);
+      BOOST_TEST(expected.size() == 12);
+      BOOST_TEST(result.size() == expected.size());
+      for (size_t j = 0; j < std::min(result.size(), expected.size()); ++j) {
+        BOOST_TEST_CONTEXT("entry index: " << j)
+        {
+          using testing::equals;
+          BOOST_TEST(equals(result.at(j), expected.at(j)));
+        }
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(GroupSerial)
+{
+  PRECICE_TEST(1_rank);
+  testWatchPointGroup(context);
+}
+
+BOOST_AUTO_TEST_CASE(GroupParallel)
+{
+  PRECICE_TEST(""_on(2_ranks).setupIntraComm(), Require::Events);
+  testWatchPointGroup(context);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END() // Precice
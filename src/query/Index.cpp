@@ -309,6 +309,21 @@ ProjectionMatch Index::findCellOrProjection(const Eigen::VectorXd &location, int
   }
 }
 
+void Index::buildProjectionTrees(bool withCells)
+{
+  PRECICE_TRACE(withCells);
+  _pimpl->getVertexRTree(*_mesh);
+  _pimpl->getEdgeRTree(*_mesh);
+  if (_mesh->getDimensions() == 3) {
+    _pimpl->getTriangleRTree(*_mesh);
+    if (withCells) {
+      _pimpl->getTetraRTree(*_mesh);
+    }
+  } else if (withCells) {
+    _pimpl->getTriangleRTree(*_mesh);
+  }
+}
+
 ProjectionMatch Index::findVertexProjection(const Eigen::VectorXd &location)
 {
   auto match = getClosestVertex(location);
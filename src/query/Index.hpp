@@ -107,6 +107,16 @@ public:
 
   ProjectionMatch findCellOrProjection(const Eigen::VectorXd &location, int n);
 
+  /**
+   * @brief Builds the index trees used by findNearestProjection() and, optionally, findCellOrProjection() upfront.
+   *
+   * The trees are otherwise built lazily by the first query, which is not thread-safe.
+   * Afterwards, these queries only read the trees and the mesh and may run concurrently.
+   *
+   * @param[in] withCells also build the trees required by findCellOrProjection()
+   */
+  void buildProjectionTrees(bool withCells);
+
   // Index tree, bounds
   mesh::BoundingBox getRtreeBounds();
 
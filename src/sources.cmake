@@ -23,6 +23,8 @@ target_sources(preciceCore
     src/acceleration/config/AccelerationConfiguration.hpp
     src/acceleration/impl/ConstantPreconditioner.cpp
     src/acceleration/impl/ConstantPreconditioner.hpp
+    src/acceleration/impl/HistoryMatrix.cpp
+    src/acceleration/impl/HistoryMatrix.hpp
     src/acceleration/impl/ParallelMatrixOperations.cpp
     src/acceleration/impl/ParallelMatrixOperations.hpp
     src/acceleration/impl/Preconditioner.hpp
@@ -78,6 +80,10 @@ target_sources(preciceCore
     src/com/SerializedPartitioning.hpp
     src/com/SerializedStamples.cpp
     src/com/SerializedStamples.hpp
+    src/com/SharedMemoryCommunication.cpp
+    src/com/SharedMemoryCommunication.hpp
+    src/com/SharedMemoryCommunicationFactory.cpp
+    src/com/SharedMemoryCommunicationFactory.hpp
     src/com/SharedPointer.hpp
     src/com/SocketCommunication.cpp
     src/com/SocketCommunication.hpp
@@ -116,6 +122,7 @@ target_sources(preciceCore
     src/cplscheme/impl/AbsoluteConvergenceMeasure.hpp
     src/cplscheme/impl/AbsoluteOrRelativeConvergenceMeasure.cpp
     src/cplscheme/impl/AbsoluteOrRelativeConvergenceMeasure.hpp
+    src/cplscheme/impl/ConvergenceMeasure.cpp
     src/cplscheme/impl/ConvergenceMeasure.hpp
     src/cplscheme/impl/RelativeConvergenceMeasure.cpp
     src/cplscheme/impl/RelativeConvergenceMeasure.hpp
@@ -276,6 +283,8 @@ target_sources(preciceCore
     src/precice/impl/WatchIntegral.hpp
     src/precice/impl/WatchPoint.cpp
     src/precice/impl/WatchPoint.hpp
+    src/precice/impl/WatchPointGroup.cpp
+    src/precice/impl/WatchPointGroup.hpp
     src/precice/impl/WriteDataContext.cpp
     src/precice/impl/WriteDataContext.hpp
     src/precice/precice.hpp
@@ -315,6 +324,7 @@ target_sources(preciceCore
     src/utils/MultiLock.hpp
     src/utils/Parallel.cpp
     src/utils/Parallel.hpp
+    src/utils/ParallelFor.hpp
     src/utils/Petsc.cpp
     src/utils/Petsc.hpp
     src/utils/Statistics.hpp
@@ -7,6 +7,7 @@
 #include <iostream>
 
 #include "logging/LogConfiguration.hpp"
+#include "testing/Testing.hpp"
 #include "utils/ArgumentFormatter.hpp"
 
 namespace precice::testing {
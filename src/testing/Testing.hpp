@@ -117,4 +117,7 @@ std::string getTestPath();
  */
 int nextMeshID();
 
+/// Configures the logging of the test runner and locks the configuration, see GlobalFixtures.cpp
+void setupTestLogging();
+
 } // namespace precice::testing
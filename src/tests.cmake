@@ -5,6 +5,7 @@ target_sources(testprecice
     PRIVATE
     src/acceleration/test/AccelerationIntraCommTest.cpp
     src/acceleration/test/AccelerationSerialTest.cpp
+    src/acceleration/test/HistoryMatrixTest.cpp
     src/acceleration/test/ParallelMatrixOperationsTest.cpp
     src/acceleration/test/PreconditionerTest.cpp
     src/acceleration/test/QRFactorizationTest.cpp
@@ -20,6 +21,7 @@ target_sources(testprecice
     src/com/tests/MPIPortsCommunicationTest.cpp
     src/com/tests/MPISinglePortsCommunicationTest.cpp
     src/com/tests/SerializedStamplesTest.cpp
+    src/com/tests/SharedMemoryCommunicationTest.cpp
     src/com/tests/SocketCommunicationTest.cpp
     src/com/tests/helper.hpp
     src/cplscheme/tests/AbsoluteConvergenceMeasureTest.cpp
@@ -40,6 +42,8 @@ target_sources(testprecice
     src/io/tests/ExportVTUTest.cpp
     src/io/tests/TXTTableWriterTest.cpp
     src/io/tests/TXTWriterReaderTest.cpp
+    src/logging/tests/LogConfigurationTest.cpp
+    src/logging/tests/LoggerTest.cpp
     src/m2n/tests/GatherScatterCommunicationTest.cpp
     src/m2n/tests/PointToPointCommunicationTest.cpp
     src/mapping/tests/AxialGeoMultiscaleMappingTest.cpp
@@ -105,6 +109,7 @@ target_sources(testprecice
     src/utils/tests/IntraCommTest.cpp
     src/utils/tests/ManageUniqueIDsTest.cpp
     src/utils/tests/MultiLockTest.cpp
+    src/utils/tests/ParallelForTest.cpp
     src/utils/tests/ParallelTest.cpp
     src/utils/tests/StatisticsTest.cpp
     src/utils/tests/StringTest.cpp
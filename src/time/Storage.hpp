@@ -77,8 +77,10 @@ public:
     return boost::make_iterator_range(_stampleStorage);
   }
 
+  /// Mutable access to the stamples, which discards the cached interpolation
   auto stamples()
   {
+    _bspline.reset();
     return boost::make_iterator_range(_stampleStorage);
   }
 
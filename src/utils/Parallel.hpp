@@ -122,6 +122,13 @@ public:
   /// Return true if MPI is initialized
   static bool isMPIInitialized();
 
+  /** Return true if MPI may be called from multiple threads, one at a time.
+   *
+   * This requires MPI to provide at least MPI_THREAD_SERIALIZED.
+   * Returns true if MPI is not initialized or preCICE is built without MPI.
+   */
+  static bool isMPIThreadSerialized();
+
   /** Initializes or detects an existing MPI environment
    *
    * If a custom MPI Communicator is provided via \ref userProvided then this registers a user-provided MPI session.
@@ -135,10 +142,11 @@ public:
    * As MPI forbids reinitialization, this prevents reconstruction.
    *
    * @param[in] userProvided an optional user-provided Communicator
+   * @param[in] threadSerialized request MPI_THREAD_SERIALIZED if preCICE initializes MPI, see isMPIThreadSerialized()
    *
    * @see finalizeOrCleanupMPI()
    */
-  static void initializeOrDetectMPI(std::optional<Communicator> userProvided = std::nullopt);
+  static void initializeOrDetectMPI(std::optional<Communicator> userProvided = std::nullopt, bool threadSerialized = false);
 
   /**
    * @brief Finalized a managed MPI environment or cleans up after an non-managed session.
@@ -153,9 +161,10 @@ public:
   /** Unconditionally initializes the MPI environment.
    *
    * Alters the \ref _currentState, which indicates a testing session.
+   * Requests MPI_THREAD_SERIALIZED, such that tests can advance participants in the background.
    *
    * @param[in] argc Parameter count
-   * @param[in] argv Parameter values, is passed to MPI_Init
+   * @param[in] argv Parameter values, is passed to MPI_Init_thread
    */
   static void initializeTestingMPI(
       int *   argc,
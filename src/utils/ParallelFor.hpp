@@ -0,0 +1,75 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace precice {
+namespace utils {
+
+/** Computes the bounds [begin, end) of a chunk of a range split into nChunks contiguous chunks.
+ *
+ * The first (size % nChunks) chunks are one element larger than the remaining ones.
+ */
+inline std::pair<std::size_t, std::size_t> chunkBounds(std::size_t size, std::size_t nChunks, std::size_t chunk)
+{
+  const std::size_t chunkSize = size / nChunks;
+  const std::size_t remainder = size % nChunks;
+  const std::size_t begin     = chunk * chunkSize + std::min(chunk, remainder);
+  const std::size_t end       = begin + chunkSize + (chunk < remainder ? 1 : 0);
+  return {begin, end};
+}
+
+/** Executes func(begin, end) on contiguous chunks of the range [0, size) using up to nThreads threads.
+ *
+ * The calling thread processes the first chunk, additional threads are spawned for the remaining ones.
+ * The chunking only depends on size and nThreads, hence results written per index are deterministic.
+ * An exception thrown by any chunk is rethrown in the calling thread after all threads joined.
+ *
+ * @param[in] size the size of the range
+ * @param[in] nThreads the maximal amount of threads to use, 0 and 1 run in the calling thread only
+ * @param[in] func the callable to execute for every chunk with signature void(std::size_t begin, std::size_t end)
+ */
+template <typename Func>
+void parallelForChunks(std::size_t size, unsigned int nThreads, Func &&func)
+{
+  const std::size_t nChunks = std::min<std::size_t>(std::max(nThreads, 1u), size);
+  if (nChunks <= 1) {
+    if (size > 0) {
+      func(std::size_t{0}, size);
+    }
+    return;
+  }
+
+  std::vector<std::exception_ptr> errors(nChunks);
+  auto                            runChunk = [&](std::size_t chunk) {
+    try {
+      const auto bounds = chunkBounds(size, nChunks, chunk);
+      func(bounds.first, bounds.second);
+    } catch (...) {
+      errors[chunk] = std::current_exception();
+    }
+  };
+
+  std::vector<std::thread> workers;
+  workers.reserve(nChunks - 1);
+  for (std::size_t chunk = 1; chunk < nChunks; ++chunk) {
+    workers.emplace_back(runChunk, chunk);
+  }
+  runChunk(0);
+  for (auto &worker : workers) {
+    worker.join();
+  }
+
+  for (const auto &error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+}
+
+} // namespace utils
+} // namespace precice
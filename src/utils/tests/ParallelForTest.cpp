@@ -0,0 +1,68 @@
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+#include "utils/ParallelFor.hpp"
+
+using namespace precice;
+
+BOOST_AUTO_TEST_SUITE(UtilsTests)
+BOOST_AUTO_TEST_SUITE(ParallelForTests)
+
+BOOST_AUTO_TEST_CASE(ChunkBounds)
+{
+  PRECICE_TEST(1_rank);
+  // 10 elements in 4 chunks: 3, 3, 2, 2
+  BOOST_TEST(utils::chunkBounds(10, 4, 0).first == 0u);
+  BOOST_TEST(utils::chunkBounds(10, 4, 0).second == 3u);
+  BOOST_TEST(utils::chunkBounds(10, 4, 1).first == 3u);
+  BOOST_TEST(utils::chunkBounds(10, 4, 1).second == 6u);
+  BOOST_TEST(utils::chunkBounds(10, 4, 2).first == 6u);
+  BOOST_TEST(utils::chunkBounds(10, 4, 2).second == 8u);
+  BOOST_TEST(utils::chunkBounds(10, 4, 3).first == 8u);
+  BOOST_TEST(utils::chunkBounds(10, 4, 3).second == 10u);
+}
+
+BOOST_AUTO_TEST_CASE(CoversRangeOnce)
+{
+  PRECICE_TEST(1_rank);
+  for (unsigned int nThreads : {0u, 1u, 3u, 8u, 20u}) {
+    std::vector<int> visits(13, 0);
+    std::atomic<int> calls{0};
+    utils::parallelForChunks(visits.size(), nThreads, [&](std::size_t begin, std::size_t end) {
+      ++calls;
+      for (std::size_t i = begin; i < end; ++i) {
+        ++visits[i];
+      }
+    });
+    BOOST_TEST(calls.load() == std::max(1, std::min<int>(nThreads, visits.size())));
+    for (int visit : visits) {
+      BOOST_TEST(visit == 1);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(EmptyRange)
+{
+  PRECICE_TEST(1_rank);
+  bool called = false;
+  utils::parallelForChunks(0, 4, [&](std::size_t, std::size_t) { called = true; });
+  BOOST_TEST(!called);
+}
+
+BOOST_AUTO_TEST_CASE(RethrowsException)
+{
+  PRECICE_TEST(1_rank);
+  auto throwInLastChunk = [](std::size_t, std::size_t end) {
+    if (end == 8) {
+      throw std::runtime_error("chunk failed");
+    }
+  };
+  BOOST_CHECK_THROW(utils::parallelForChunks(8, 4, throwInLastChunk), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -52,6 +52,12 @@ public:
   /// Reads the xml file
   int readXmlFile(std::string const &filePath);
 
+  /// Returns all tags read from the file in document order
+  const CTagPtrVec &getAllTags() const
+  {
+    return m_AllTags;
+  }
+
   /**
    * @brief Connects the actual tags of an xml layer with the predefined tags
    * @param DefTags predefined tags
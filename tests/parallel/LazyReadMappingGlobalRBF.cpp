@@ -0,0 +1,24 @@
+#ifndef PRECICE_NO_MPI
+
+#include "testing/Testing.hpp"
+
+#include <precice/precice.hpp>
+
+BOOST_AUTO_TEST_SUITE(Integration)
+BOOST_AUTO_TEST_SUITE(Parallel)
+BOOST_AUTO_TEST_CASE(LazyReadMappingGlobalRBF)
+{
+  PRECICE_TEST("SolverOne"_on(2_ranks), "SolverTwo"_on(1_rank));
+
+  // Global RBF mappings communicate between all ranks, which would deadlock when executed lazily in readData()
+  if (context.isNamed("SolverOne")) {
+    BOOST_CHECK_THROW((precice::Participant{context.name, context.config(), context.rank, context.size}), ::precice::Error);
+  } else {
+    precice::Participant interface(context.name, context.config(), context.rank, context.size);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Integration
+BOOST_AUTO_TEST_SUITE_END() // Parallel
+
+#endif // PRECICE_NO_MPI
@@ -0,0 +1,72 @@
+#ifndef PRECICE_NO_MPI
+
+#include "precice/impl/ParticipantImpl.hpp"
+#include "testing/Testing.hpp"
+
+#include <precice/precice.hpp>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(Integration)
+BOOST_AUTO_TEST_SUITE(Serial)
+BOOST_AUTO_TEST_SUITE(MapIfNecessary)
+
+// One reads its data only every second time window, which is thus only mapped every second time window
+BOOST_AUTO_TEST_CASE(LazyReadMapping)
+{
+  PRECICE_TEST("One"_on(1_rank), "Two"_on(1_rank));
+
+  precice::Participant participant(context.name, context.config(), context.rank, context.size);
+
+  std::vector<double>            coords{0, 0, 1, 1};
+  std::vector<precice::VertexID> vertexIDs(2);
+  std::string                    meshName = "Mesh" + context.name;
+  participant.setMeshVertices(meshName, coords, vertexIDs);
+
+  if (context.isNamed("Two")) {
+    participant.initialize();
+    double value = 1;
+    while (participant.isCouplingOngoing()) {
+      std::vector<double> values(2, value);
+      participant.writeData(meshName, "DataTwo", vertexIDs, values);
+      participant.advance(participant.getMaxTimeStepSize());
+      ++value;
+    }
+    return;
+  }
+
+  participant.initialize();
+  auto &impl = precice::testing::WhiteboxAccessor::impl(participant);
+
+  int timeWindow = 0;
+  while (participant.isCouplingOngoing()) {
+    participant.advance(participant.getMaxTimeStepSize());
+    ++timeWindow;
+
+    BOOST_TEST_CONTEXT("TW = " << timeWindow)
+    {
+      // The received data isn't mapped during advance
+      BOOST_TEST(impl.mappedSamples().read == 0);
+
+      if (timeWindow % 2 == 0 || !participant.isCouplingOngoing()) {
+        continue;
+      }
+
+      // The first read executes the mapping. After skipping a time window, this includes the start of the time window.
+      const int           expectedMappings = timeWindow == 1 ? 1 : 2;
+      std::vector<double> values(2);
+      participant.readData(meshName, "DataTwo", vertexIDs, participant.getMaxTimeStepSize(), values);
+      BOOST_TEST(impl.mappedSamples().read == expectedMappings);
+      BOOST_TEST(values == std::vector<double>(2, timeWindow + 1), boost::test_tools::per_element());
+
+      // Further reads use the mapped data
+      participant.readData(meshName, "DataTwo", vertexIDs, 0.0, values);
+      BOOST_TEST(impl.mappedSamples().read == expectedMappings);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // MapIfNecessary
+BOOST_AUTO_TEST_SUITE_END() // Serial
+BOOST_AUTO_TEST_SUITE_END() // Integration
+
+#endif // PRECICE_NO_MPI
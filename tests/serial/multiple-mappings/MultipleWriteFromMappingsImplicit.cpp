@@ -0,0 +1,96 @@
+#ifndef PRECICE_NO_MPI
+
+#include "testing/Testing.hpp"
+
+#include <precice/precice.hpp>
+#include <vector>
+#include "precice/impl/ParticipantImpl.hpp"
+
+// The write mappings of B are performed by the coupling scheme right before sending each data.
+// The second participant of the implicit scheme measures convergence of the mapped data before sending it.
+BOOST_AUTO_TEST_SUITE(Integration)
+BOOST_AUTO_TEST_SUITE(Serial)
+BOOST_AUTO_TEST_SUITE(MultipleMappings)
+BOOST_AUTO_TEST_CASE(MultipleWriteFromMappingsImplicit)
+{
+  PRECICE_TEST("A"_on(1_rank), "B"_on(1_rank));
+
+  using Eigen::Vector2d;
+
+  precice::Participant interface(context.name, context.config(), context.rank, context.size);
+  Vector2d             vertex1{0.0, 0.0};
+  Vector2d             vertex2{2.0, 0.0};
+  Vector2d             vertex3{4.0, 0.0};
+
+  if (context.isNamed("A")) {
+    auto meshNameTop    = "MeshATop";
+    auto meshNameBottom = "MeshABottom";
+    int  vertexIDTop    = interface.setMeshVertex(meshNameTop, vertex1);
+    int  vertexIDBottom = interface.setMeshVertex(meshNameBottom, vertex3);
+
+    interface.initialize();
+    int window     = 1;
+    int iterations = 0;
+    while (interface.isCouplingOngoing()) {
+      interface.requiresWritingCheckpoint();
+      double force = 1.0;
+      interface.writeData(meshNameTop, "Force", {&vertexIDTop, 1}, {&force, 1});
+      double dt = interface.getMaxTimeStepSize();
+      interface.advance(dt);
+      iterations++;
+
+      double pressure    = -1.0;
+      double temperature = -1.0;
+      interface.readData(meshNameTop, "Pressure", {&vertexIDTop, 1}, interface.getMaxTimeStepSize(), {&pressure, 1});
+      interface.readData(meshNameTop, "Temperature", {&vertexIDTop, 1}, interface.getMaxTimeStepSize(), {&temperature, 1});
+      BOOST_TEST(pressure == 1.0 * window);
+      BOOST_TEST(temperature == 300.0 + window);
+      interface.readData(meshNameBottom, "Pressure", {&vertexIDBottom, 1}, interface.getMaxTimeStepSize(), {&pressure, 1});
+      interface.readData(meshNameBottom, "Temperature", {&vertexIDBottom, 1}, interface.getMaxTimeStepSize(), {&temperature, 1});
+      BOOST_TEST(pressure == 5.0 * window);
+      BOOST_TEST(temperature == 310.0 + window);
+
+      if (!interface.requiresReadingCheckpoint()) {
+        window++;
+      }
+    }
+    // The constant values converge in the second iteration of each time window
+    BOOST_TEST(iterations == 4);
+    interface.finalize();
+
+  } else {
+    BOOST_TEST(context.isNamed("B"));
+    auto meshName = "MeshB";
+    int  vertexID1 = interface.setMeshVertex(meshName, vertex1);
+    int  vertexID2 = interface.setMeshVertex(meshName, vertex2);
+    int  vertexID3 = interface.setMeshVertex(meshName, vertex3);
+
+    interface.initialize();
+    int window = 1;
+    while (interface.isCouplingOngoing()) {
+      interface.requiresWritingCheckpoint();
+      std::vector<int>    vertexIDs{vertexID1, vertexID2, vertexID3};
+      std::vector<double> pressures{1.0 * window, 4.0 * window, 5.0 * window};
+      std::vector<double> temperatures{300.0 + window, 305.0 + window, 310.0 + window};
+      interface.writeData(meshName, "Pressure", vertexIDs, pressures);
+      interface.writeData(meshName, "Temperature", vertexIDs, temperatures);
+      double dt = interface.getMaxTimeStepSize();
+      interface.advance(dt);
+
+      // Both data are mapped to both meshes
+      auto mapped = precice::testing::WhiteboxAccessor::impl(interface).mappedSamples();
+      BOOST_TEST(mapped.write == 4);
+
+      if (!interface.requiresReadingCheckpoint()) {
+        window++;
+      }
+    }
+    interface.finalize();
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Integration
+BOOST_AUTO_TEST_SUITE_END() // Serial
+BOOST_AUTO_TEST_SUITE_END() // MultipleMappings
+
+#endif // PRECICE_NO_MPI
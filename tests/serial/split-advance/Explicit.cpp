@@ -0,0 +1,54 @@
+#ifndef PRECICE_NO_MPI
+
+#include "testing/Testing.hpp"
+
+#include <precice/precice.hpp>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(Integration)
+BOOST_AUTO_TEST_SUITE(Serial)
+BOOST_AUTO_TEST_SUITE(SplitAdvance)
+// Serial-explicit coupling advancing with startAdvance() and finishAdvance() instead of advance()
+BOOST_AUTO_TEST_CASE(Explicit)
+{
+  PRECICE_TEST("SolverOne"_on(1_rank), "SolverTwo"_on(1_rank));
+  precice::Participant participant(context.name, context.config(), 0, 1);
+
+  const bool isOne     = context.isNamed("SolverOne");
+  const auto meshName  = isOne ? "MeshOne" : "MeshTwo";
+  const auto writeName = isOne ? "DataOne" : "DataTwo";
+  const auto readName  = isOne ? "DataTwo" : "DataOne";
+  const int  vertexID  = participant.setMeshVertex(meshName, std::vector<double>{0.0, 0.0});
+
+  participant.initialize();
+
+  int window = 0;
+  while (participant.isCouplingOngoing()) {
+    window++;
+    const double written = isOne ? window : 10.0 * window;
+    participant.writeData(meshName, writeName, {&vertexID, 1}, {&written, 1});
+
+    participant.startAdvance(participant.getMaxTimeStepSize());
+    // The participant may not be used while the advance is in progress
+    double dummy = 0;
+    BOOST_CHECK_THROW(participant.readData(meshName, readName, {&vertexID, 1}, 0.0, {&dummy, 1}), ::precice::Error);
+    participant.finishAdvance();
+
+    if (participant.isCouplingOngoing()) {
+      double read = -1;
+      participant.readData(meshName, readName, {&vertexID, 1}, participant.getMaxTimeStepSize(), {&read, 1});
+      // SolverOne receives the data of SolverTwo from the same window, SolverTwo the data of SolverOne from the next window
+      BOOST_TEST(read == (isOne ? 10.0 * window : window + 1.0));
+    }
+  }
+  BOOST_TEST(window == 5);
+  BOOST_CHECK_THROW(participant.finishAdvance(), ::precice::Error);
+
+  participant.finalize();
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Integration
+BOOST_AUTO_TEST_SUITE_END() // Serial
+BOOST_AUTO_TEST_SUITE_END() // SplitAdvance
+
+#endif // PRECICE_NO_MPI
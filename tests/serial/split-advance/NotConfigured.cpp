@@ -0,0 +1,37 @@
+#ifndef PRECICE_NO_MPI
+
+#include "testing/Testing.hpp"
+
+#include <precice/precice.hpp>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(Integration)
+BOOST_AUTO_TEST_SUITE(Serial)
+BOOST_AUTO_TEST_SUITE(SplitAdvance)
+// startAdvance() fails without split-advance in the configuration, but leaves the participant usable
+BOOST_AUTO_TEST_CASE(NotConfigured)
+{
+  PRECICE_TEST("SolverOne"_on(1_rank), "SolverTwo"_on(1_rank));
+  precice::Participant participant(context.name, context.config(), 0, 1);
+
+  const auto meshName = context.isNamed("SolverOne") ? "MeshOne" : "MeshTwo";
+  participant.setMeshVertex(meshName, std::vector<double>{0.0, 0.0});
+
+  participant.initialize();
+
+  int window = 0;
+  while (participant.isCouplingOngoing()) {
+    window++;
+    BOOST_CHECK_THROW(participant.startAdvance(participant.getMaxTimeStepSize()), ::precice::Error);
+    participant.advance(participant.getMaxTimeStepSize());
+  }
+  BOOST_TEST(window == 2);
+
+  participant.finalize();
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Integration
+BOOST_AUTO_TEST_SUITE_END() // Serial
+BOOST_AUTO_TEST_SUITE_END() // SplitAdvance
+
+#endif // PRECICE_NO_MPI
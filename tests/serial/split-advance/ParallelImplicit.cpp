@@ -0,0 +1,59 @@
+#ifndef PRECICE_NO_MPI
+
+#include "testing/Testing.hpp"
+
+#include <precice/precice.hpp>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(Integration)
+BOOST_AUTO_TEST_SUITE(Serial)
+BOOST_AUTO_TEST_SUITE(SplitAdvance)
+// Parallel-implicit coupling with acceleration advancing with startAdvance() and finishAdvance() instead of advance()
+BOOST_AUTO_TEST_CASE(ParallelImplicit)
+{
+  PRECICE_TEST("SolverOne"_on(1_rank), "SolverTwo"_on(1_rank));
+  precice::Participant participant(context.name, context.config(), 0, 1);
+
+  const bool isOne     = context.isNamed("SolverOne");
+  const auto meshName  = isOne ? "MeshOne" : "MeshTwo";
+  const auto writeName = isOne ? "DataOne" : "DataTwo";
+  const auto readName  = isOne ? "DataTwo" : "DataOne";
+  const int  vertexID  = participant.setMeshVertex(meshName, std::vector<double>{0.0, 0.0});
+
+  participant.initialize();
+
+  // Fixed-point problem per time window w: one = 0.5 * two + w, two = 0.5 * one
+  int window     = 1;
+  int iterations = 0;
+  while (participant.isCouplingOngoing()) {
+    if (participant.requiresWritingCheckpoint()) {
+      iterations = 0;
+    }
+    const double dt   = participant.getMaxTimeStepSize();
+    double       read = 0;
+    participant.readData(meshName, readName, {&vertexID, 1}, dt, {&read, 1});
+    const double written = isOne ? 0.5 * read + window : 0.5 * read;
+    participant.writeData(meshName, writeName, {&vertexID, 1}, {&written, 1});
+
+    participant.startAdvance(dt);
+    participant.finishAdvance();
+    iterations++;
+
+    if (!participant.requiresReadingCheckpoint()) {
+      BOOST_TEST_MESSAGE(context.name << " converged in window " << window << " after " << iterations << " iterations");
+      const double one = window / 0.75;
+      BOOST_TEST(written == (isOne ? one : 0.5 * one), boost::test_tools::tolerance(1e-6));
+      BOOST_TEST(iterations < 30);
+      window++;
+    }
+  }
+  BOOST_TEST(window == 4);
+
+  participant.finalize();
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Integration
+BOOST_AUTO_TEST_SUITE_END() // Serial
+BOOST_AUTO_TEST_SUITE_END() // SplitAdvance
+
+#endif // PRECICE_NO_MPI
@@ -0,0 +1,88 @@
+#ifndef PRECICE_NO_MPI
+
+#include "testing/Testing.hpp"
+
+#include <precice/precice.hpp>
+#include <vector>
+#include "helpers.hpp"
+
+BOOST_AUTO_TEST_SUITE(Integration)
+BOOST_AUTO_TEST_SUITE(Serial)
+BOOST_AUTO_TEST_CASE(WatchIntegralBinaryFormat)
+{
+  PRECICE_TEST("SolverOne"_on(1_rank), "SolverTwo"_on(1_rank));
+
+  using Eigen::Vector2d;
+
+  precice::Participant interface(context.name, context.config(), 0, 1);
+
+  const auto meshName = context.isNamed("SolverOne") ? "MeshOne" : "MeshTwo";
+  auto       dataName = "DataOne";
+
+  int idA = interface.setMeshVertex(meshName, Vector2d{0.0, 0.0});
+  int idB = interface.setMeshVertex(meshName, Vector2d{1.0, 0.0});
+  int idC = interface.setMeshVertex(meshName, Vector2d{1.0, 2.0});
+  interface.setMeshEdge(meshName, idA, idB);
+  interface.setMeshEdge(meshName, idB, idC);
+
+  interface.initialize();
+
+  std::vector<int> ids{idA, idB, idC};
+  if (context.isNamed("SolverOne")) {
+    std::vector<double> values{1.0, 2.0, 3.0};
+    while (interface.isCouplingOngoing()) {
+      interface.writeData(meshName, dataName, ids, values);
+      interface.advance(interface.getMaxTimeStepSize());
+      for (double &value : values) {
+        value += 1.0;
+      }
+    }
+    interface.finalize();
+    return;
+  }
+
+  std::vector<double> values(3);
+  while (interface.isCouplingOngoing()) {
+    const double dt = interface.getMaxTimeStepSize();
+    interface.readData(meshName, dataName, ids, dt, values);
+    interface.advance(dt);
+  }
+  interface.finalize();
+
+  // Same values as the text output of WatchIntegralScaleAndNoScale: Time, DataOne, SurfaceArea
+  {
+    const auto result   = readDoublesFromBinaryFile("precice-SolverTwo-watchintegral-WatchIntegral.bin");
+    const auto expected = std::vector<double>{
+        1.0, 9.5, 3.0,
+        2.0, 12.5, 3.0,
+        3.0, 12.5, 3.0};
+    BOOST_TEST_REQUIRE(result.size() == expected.size());
+    for (size_t i = 0; i < result.size(); ++i) {
+      BOOST_TEST_CONTEXT("entry index: " << i)
+      {
+        using testing::equals;
+        BOOST_TEST(equals(result.at(i), expected.at(i)));
+      }
+    }
+  }
+
+  // Rows of Time, Coordinate0, Coordinate1, DataOne
+  {
+    const auto result = readDoublesFromBinaryFile("precice-SolverTwo-watchpoint-WatchPoint.bin");
+    BOOST_TEST_REQUIRE(!result.empty());
+    BOOST_TEST_REQUIRE(result.size() % 4 == 0);
+    for (size_t row = 0; row < result.size() / 4; ++row) {
+      BOOST_TEST_CONTEXT("row: " << row)
+      {
+        using testing::equals;
+        BOOST_TEST(equals(result.at(4 * row + 1), 1.0));
+        BOOST_TEST(equals(result.at(4 * row + 2), 0.0));
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Integration
+BOOST_AUTO_TEST_SUITE_END() // Serial
+
+#endif // PRECICE_NO_MPI
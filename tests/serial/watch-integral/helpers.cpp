@@ -3,6 +3,7 @@
 #include "helpers.hpp"
 #include "testing/Testing.hpp"
 
+#include <cstdint>
 #include <fstream>
 #include "precice/precice.hpp"
 
@@ -18,4 +19,36 @@ std::vector<double> readDoublesFromTXTFile(const std::string &filename, int skip
   return {std::istream_iterator<double>{is}, std::istream_iterator<double>{}};
 }
 
+std::vector<double> readDoublesFromBinaryFile(const std::string &filename)
+{
+  std::ifstream is{filename, std::ios::binary};
+  auto          read = [&is](auto value) {
+    is.read(reinterpret_cast<char *>(&value), sizeof(value));
+    return value;
+  };
+
+  std::vector<bool>   isInt;
+  std::vector<double> values;
+  for (int tag = is.get(); is; tag = is.get()) {
+    if (tag == 'H') {
+      isInt.resize(read(std::uint32_t{}));
+      for (std::size_t column = 0; column < isInt.size(); ++column) {
+        is.ignore(read(std::uint32_t{}));
+        isInt[column] = read(std::uint8_t{}) == 0;
+      }
+    } else {
+      BOOST_TEST_REQUIRE(tag == 'R');
+      const auto rows  = read(std::uint64_t{});
+      const auto first = values.size();
+      values.resize(first + rows * isInt.size());
+      for (std::size_t column = 0; column < isInt.size(); ++column) {
+        for (std::uint64_t row = 0; row < rows; ++row) {
+          values[first + row * isInt.size() + column] = isInt[column] ? read(std::int32_t{}) : read(double{});
+        }
+      }
+    }
+  }
+  return values;
+}
+
 #endif
@@ -9,4 +9,7 @@ using precice::testing::TestContext;
 
 std::vector<double> readDoublesFromTXTFile(const std::string &filename, int skip = 0);
 
+/// Reads all rows of a binary table written by io::TXTTableWriter, row by row
+std::vector<double> readDoublesFromBinaryFile(const std::string &filename);
+
 #endif
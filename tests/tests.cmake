@@ -9,6 +9,7 @@ target_sources(testprecice
     tests/parallel/ExportTimeseries.cpp
     tests/parallel/GlobalRBFPartitioning.cpp
     tests/parallel/GlobalRBFPartitioningPETSc.cpp
+    tests/parallel/LazyReadMappingGlobalRBF.cpp
     tests/parallel/LocalRBFPartitioning.cpp
     tests/parallel/LocalRBFPartitioningPETSc.cpp
     tests/parallel/MappingTypeRestriction.cpp
@@ -154,6 +155,7 @@ target_sources(testprecice
     tests/serial/lifecycle/reconstruction/ConstructOnly.cpp
     tests/serial/lifecycle/reconstruction/Full.cpp
     tests/serial/lifecycle/reconstruction/ImplicitFinalize.cpp
+    tests/serial/map-if-necessary/LazyReadMapping.cpp
     tests/serial/map-if-necessary/three-solvers/helper.hpp
     tests/serial/map-if-necessary/three-solvers/mixed-substeps/Multi.cpp
     tests/serial/map-if-necessary/three-solvers/mixed-substeps/ParallelExplicit.cpp
@@ -256,6 +258,7 @@ target_sources(testprecice
     tests/serial/multiple-mappings/MultipleReadToMappings.cpp
     tests/serial/multiple-mappings/MultipleWriteFromMappings.cpp
     tests/serial/multiple-mappings/MultipleWriteFromMappingsAndData.cpp
+    tests/serial/multiple-mappings/MultipleWriteFromMappingsImplicit.cpp
     tests/serial/multiple-mappings/MultipleWriteToMappings.cpp
     tests/serial/parallel-coupling/SolverAFirst.cpp
     tests/serial/parallel-coupling/SolverAFirstSubsteps.cpp
@@ -263,6 +266,9 @@ target_sources(testprecice
     tests/serial/parallel-coupling/SolverBFirstSubsteps.cpp
     tests/serial/parallel-coupling/helpers.cpp
     tests/serial/parallel-coupling/helpers.hpp
+    tests/serial/split-advance/Explicit.cpp
+    tests/serial/split-advance/NotConfigured.cpp
+    tests/serial/split-advance/ParallelImplicit.cpp
     tests/serial/three-solvers/ThreeSolversExplicitExplicit.cpp
     tests/serial/three-solvers/ThreeSolversExplicitImplicit.cpp
     tests/serial/three-solvers/ThreeSolversFirstParticipant.cpp
@@ -317,6 +323,7 @@ target_sources(testprecice
     tests/serial/time/implicit/serial-coupling/ReadWriteScalarDataWithWaveformSubcyclingThird.cpp
     tests/serial/time/implicit/serial-coupling/WaveformSubcyclingWithConstantAcceleration.cpp
     tests/serial/time/implicit/serial-coupling/WaveformSubcyclingWithConstantAccelerationNoInit.cpp
+    tests/serial/watch-integral/WatchIntegralBinaryFormat.cpp
     tests/serial/watch-integral/WatchIntegralScaleAndNoScale.cpp
     tests/serial/watch-integral/helpers.cpp
     tests/serial/watch-integral/helpers.hpp